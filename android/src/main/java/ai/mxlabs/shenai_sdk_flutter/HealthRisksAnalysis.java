@@ -0,0 +1,434 @@
+package ai.mxlabs.shenai_sdk_flutter;
+
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.function.Consumer;
+import java.util.function.Function;
+import java.util.stream.IntStream;
+
+/** Analyses built on top of repeated health risks computations, mirroring the iOS health_risks module. */
+final class HealthRisksAnalysis {
+
+  private static final double SBP_STEP = -10.0;
+  private static final double CHOLESTEROL_RELATIVE_STEP = -0.1;
+  private static final double CHOLESTEROL_HDL_RELATIVE_STEP = 0.1;
+  private static final double BMI_STEP = -1.0;
+
+  // largest grid accepted, a full one is 1 MB of output and as many SDK calls as cells
+  private static final long MAX_GRID_AXIS_STEPS = 1024;
+  private static final long MAX_GRID_CELLS = 1 << 18;
+
+  // samples per random stream, as on iOS
+  private static final int UNCERTAINTY_CHUNK_SAMPLES = 256;
+  // every sample is one SDK call
+  private static final long MAX_UNCERTAINTY_SAMPLES = 100000;
+  private static final double LOWER_PERCENTILE = 2.5;
+  private static final double UPPER_PERCENTILE = 97.5;
+
+  private HealthRisksAnalysis() {}
+
+  static Pigeon.RisksFactors copy(@NonNull Pigeon.RisksFactors factors) {
+    return Pigeon.RisksFactors.fromList(factors.toList());
+  }
+
+  /**
+   * Finite differences of every HealthRisks field with respect to every modifiable factor present in the input:
+   * SBP -10 mmHg, cholesterol -10%, HDL +10%, BMI -1 kg/m2 (through body weight), smoking, diabetes and
+   * hypertension treatment toggled.
+   */
+  static Pigeon.HealthRisksSensitivity computeSensitivity(
+      @NonNull Pigeon.RisksFactors factors, @NonNull Function<Pigeon.RisksFactors, Pigeon.HealthRisks> compute) {
+    Pigeon.HealthRisks risks = compute.apply(factors);
+    ArrayList<Pigeon.RiskFactorSensitivity> sensitivities = new ArrayList<>();
+
+    if (factors.getSbp() != null) {
+      addSensitivity(sensitivities, Pigeon.ModifiableRiskFactor.SBP, SBP_STEP,
+          changed(factors, f -> f.setSbp(factors.getSbp() + SBP_STEP)), risks, compute);
+    }
+    if (factors.getCholesterol() != null) {
+      double step = factors.getCholesterol() * CHOLESTEROL_RELATIVE_STEP;
+      addSensitivity(sensitivities, Pigeon.ModifiableRiskFactor.CHOLESTEROL, step,
+          changed(factors, f -> f.setCholesterol(factors.getCholesterol() + step)), risks, compute);
+    }
+    if (factors.getCholesterolHdl() != null) {
+      double step = factors.getCholesterolHdl() * CHOLESTEROL_HDL_RELATIVE_STEP;
+      addSensitivity(sensitivities, Pigeon.ModifiableRiskFactor.CHOLESTEROL_HDL, step,
+          changed(factors, f -> f.setCholesterolHdl(factors.getCholesterolHdl() + step)), risks, compute);
+    }
+    if (factors.getBodyWeight() != null && factors.getBodyHeight() != null && factors.getBodyHeight() > 0) {
+      double heightMeters = factors.getBodyHeight() / 100.0;
+      double weightStep = BMI_STEP * heightMeters * heightMeters;
+      addSensitivity(sensitivities, Pigeon.ModifiableRiskFactor.BMI, BMI_STEP,
+          changed(factors, f -> f.setBodyWeight(factors.getBodyWeight() + weightStep)), risks, compute);
+    }
+    if (factors.getIsSmoker() != null) {
+      addSensitivity(sensitivities, Pigeon.ModifiableRiskFactor.SMOKING, factors.getIsSmoker() ? -1.0 : 1.0,
+          changed(factors, f -> f.setIsSmoker(!factors.getIsSmoker())), risks, compute);
+    }
+    if (factors.getHasDiabetes() != null) {
+      addSensitivity(sensitivities, Pigeon.ModifiableRiskFactor.DIABETES, factors.getHasDiabetes() ? -1.0 : 1.0,
+          changed(factors, f -> f.setHasDiabetes(!factors.getHasDiabetes())), risks, compute);
+    }
+    if (factors.getHypertensionTreatment() != null) {
+      addSensitivity(sensitivities, Pigeon.ModifiableRiskFactor.HYPERTENSION_TREATMENT,
+          factors.getHypertensionTreatment() ? -1.0 : 1.0,
+          changed(factors, f -> f.setHypertensionTreatment(!factors.getHypertensionTreatment())), risks, compute);
+    }
+
+    Pigeon.HealthRisksSensitivity.Builder sensitivityBuilder = new Pigeon.HealthRisksSensitivity.Builder();
+    sensitivityBuilder.setRisks(risks);
+    sensitivityBuilder.setSensitivities(sensitivities);
+    return sensitivityBuilder.build();
+  }
+
+  /**
+   * One metric over a regular grid of two factors, row-major with yAxis rows and xAxis columns, as native-order float
+   * bytes. Axes include both ends of their range, cells where the metric could not be computed are NaN. Fails for
+   * axes above MAX_GRID_AXIS_STEPS steps or grids above MAX_GRID_CELLS cells.
+   */
+  static byte[] computeGrid(@NonNull Pigeon.RisksFactors base, @NonNull Pigeon.HealthRisksGridAxis xAxis,
+      @NonNull Pigeon.HealthRisksGridAxis yAxis, @NonNull Pigeon.HealthRisksMetric metric,
+      @NonNull Function<Pigeon.RisksFactors, Pigeon.HealthRisks> compute) {
+    long columnSteps = xAxis.getSteps();
+    long rowSteps = yAxis.getSteps();
+    if (columnSteps < 0 || rowSteps < 0 || columnSteps > MAX_GRID_AXIS_STEPS || rowSteps > MAX_GRID_AXIS_STEPS
+        || columnSteps * rowSteps > MAX_GRID_CELLS) {
+      throw new Pigeon.FlutterError("invalid-argument", "grid axes take 0 to " + MAX_GRID_AXIS_STEPS + " steps and "
+          + MAX_GRID_CELLS + " cells in total, got " + columnSteps + " x " + rowSteps, null);
+    }
+    int columns = (int) columnSteps;
+    int rows = (int) rowSteps;
+    ByteBuffer bytes = ByteBuffer.allocate(rows * columns * Float.BYTES).order(ByteOrder.nativeOrder());
+    FloatBuffer grid = bytes.asFloatBuffer();
+    for (int row = 0; row < rows; ++row) {
+      Pigeon.RisksFactors rowFactors = copy(base);
+      setGridFactor(rowFactors, yAxis.getFactor(), axisValue(yAxis, row));
+      for (int column = 0; column < columns; ++column) {
+        Pigeon.RisksFactors factors = copy(rowFactors);
+        setGridFactor(factors, xAxis.getFactor(), axisValue(xAxis, column));
+        grid.put(row * columns + column, metricValue(compute.apply(factors), metric));
+      }
+    }
+    return bytes.array();
+  }
+
+  /**
+   * Monte Carlo propagation of measurement errors: the measured factors are drawn from normal distributions truncated
+   * at zero (means from the factors, deviations from the uncertainty) and the 2.5th, 50th and 97.5th percentiles of
+   * every field are reported. Chunks of samples run in parallel, each with its own random stream derived from the
+   * seed, so results only depend on the seed. The compute function must be reentrant, see computeHealthRisksBatch in
+   * ios/Classes/health_risks/health_risks_batch.h. Fails for fewer than 1 or more than MAX_UNCERTAINTY_SAMPLES
+   * samples.
+   */
+  static Pigeon.HealthRisksInterval computeUncertainty(@NonNull Pigeon.RisksFactors factors,
+      @NonNull Pigeon.RisksFactorsUncertainty uncertainty, long samples, long seed,
+      @NonNull Function<Pigeon.RisksFactors, Pigeon.HealthRisks> compute) {
+    if (samples < 1 || samples > MAX_UNCERTAINTY_SAMPLES) {
+      throw new Pigeon.FlutterError("invalid-argument",
+          "samples must be between 1 and " + MAX_UNCERTAINTY_SAMPLES + ", got " + samples, null);
+    }
+    int count = (int) samples;
+    int chunks = (count + UNCERTAINTY_CHUNK_SAMPLES - 1) / UNCERTAINTY_CHUNK_SAMPLES;
+    Pigeon.HealthRisksMetric[] metrics = Pigeon.HealthRisksMetric.values();
+    float[][] values = new float[metrics.length][count];
+
+    IntStream.range(0, chunks).parallel().forEach(chunk -> {
+      NormalStream stream = new NormalStream(seed, chunk);
+      // only the sampled fields change, so one copy is reused for every sample of the chunk
+      Pigeon.RisksFactors sample = copy(factors);
+      int end = Math.min(count, (chunk + 1) * UNCERTAINTY_CHUNK_SAMPLES);
+      for (int i = chunk * UNCERTAINTY_CHUNK_SAMPLES; i < end; ++i) {
+        sample.setSbp(stream.sample(factors.getSbp(), uncertainty.getSbp()));
+        sample.setCholesterol(stream.sample(factors.getCholesterol(), uncertainty.getCholesterol()));
+        sample.setCholesterolHdl(stream.sample(factors.getCholesterolHdl(), uncertainty.getCholesterolHdl()));
+        sample.setBodyHeight(stream.sample(factors.getBodyHeight(), uncertainty.getBodyHeight()));
+        sample.setBodyWeight(stream.sample(factors.getBodyWeight(), uncertainty.getBodyWeight()));
+        Pigeon.HealthRisks risks = compute.apply(sample);
+        for (Pigeon.HealthRisksMetric metric : metrics) {
+          values[metric.ordinal()][i] = metricValue(risks, metric);
+        }
+      }
+    });
+
+    Float[] lower = new Float[metrics.length];
+    Float[] median = new Float[metrics.length];
+    Float[] upper = new Float[metrics.length];
+    for (Pigeon.HealthRisksMetric metric : metrics) {
+      float[] present = values[metric.ordinal()];
+      int presentCount = 0;
+      for (float value : present) {
+        if (!Float.isNaN(value)) {
+          present[presentCount++] = value;
+        }
+      }
+      if (presentCount == 0) {
+        continue;
+      }
+      present = Arrays.copyOf(present, presentCount);
+      Arrays.sort(present);
+      lower[metric.ordinal()] = present[rank(LOWER_PERCENTILE, present.length)];
+      median[metric.ordinal()] = present[rank(50.0, present.length)];
+      upper[metric.ordinal()] = present[rank(UPPER_PERCENTILE, present.length)];
+    }
+
+    Pigeon.HealthRisksInterval.Builder intervalBuilder = new Pigeon.HealthRisksInterval.Builder();
+    intervalBuilder.setLower(fromMetrics(lower));
+    intervalBuilder.setMedian(fromMetrics(median));
+    intervalBuilder.setUpper(fromMetrics(upper));
+    return intervalBuilder.build();
+  }
+
+  /** Field-wise difference a - b, null where either side is null. */
+  static Pigeon.HealthRisks subtract(@NonNull Pigeon.HealthRisks a, @NonNull Pigeon.HealthRisks b) {
+    Pigeon.HardAndFatalEventsRisks aHard = a.getHardAndFatalEvents();
+    Pigeon.HardAndFatalEventsRisks bHard = b.getHardAndFatalEvents();
+    Pigeon.HardAndFatalEventsRisks.Builder hardAndFatalBuilder = new Pigeon.HardAndFatalEventsRisks.Builder();
+    hardAndFatalBuilder.setCoronaryDeathEventRisk(
+        subtract(aHard.getCoronaryDeathEventRisk(), bHard.getCoronaryDeathEventRisk()));
+    hardAndFatalBuilder.setFatalStrokeEventRisk(
+        subtract(aHard.getFatalStrokeEventRisk(), bHard.getFatalStrokeEventRisk()));
+    hardAndFatalBuilder.setTotalCVMortalityRisk(
+        subtract(aHard.getTotalCVMortalityRisk(), bHard.getTotalCVMortalityRisk()));
+    hardAndFatalBuilder.setHardCVEventRisk(subtract(aHard.getHardCVEventRisk(), bHard.getHardCVEventRisk()));
+
+    Pigeon.CVDiseasesRisks aCvd = a.getCvDiseases();
+    Pigeon.CVDiseasesRisks bCvd = b.getCvDiseases();
+    Pigeon.CVDiseasesRisks.Builder cvDiseasesBuilder = new Pigeon.CVDiseasesRisks.Builder();
+    cvDiseasesBuilder.setOverallRisk(subtract(aCvd.getOverallRisk(), bCvd.getOverallRisk()));
+    cvDiseasesBuilder.setCoronaryHeartDiseaseRisk(
+        subtract(aCvd.getCoronaryHeartDiseaseRisk(), bCvd.getCoronaryHeartDiseaseRisk()));
+    cvDiseasesBuilder.setStrokeRisk(subtract(aCvd.getStrokeRisk(), bCvd.getStrokeRisk()));
+    cvDiseasesBuilder.setHeartFailureRisk(subtract(aCvd.getHeartFailureRisk(), bCvd.getHeartFailureRisk()));
+    cvDiseasesBuilder.setPeripheralVascularDiseaseRisk(
+        subtract(aCvd.getPeripheralVascularDiseaseRisk(), bCvd.getPeripheralVascularDiseaseRisk()));
+
+    Pigeon.RisksFactorsScores aScores = a.getScores();
+    Pigeon.RisksFactorsScores bScores = b.getScores();
+    Pigeon.RisksFactorsScores.Builder scoresBuilder = new Pigeon.RisksFactorsScores.Builder();
+    scoresBuilder.setAgeScore(subtract(aScores.getAgeScore(), bScores.getAgeScore()));
+    scoresBuilder.setSbpScore(subtract(aScores.getSbpScore(), bScores.getSbpScore()));
+    scoresBuilder.setSmokingScore(subtract(aScores.getSmokingScore(), bScores.getSmokingScore()));
+    scoresBuilder.setDiabetesScore(subtract(aScores.getDiabetesScore(), bScores.getDiabetesScore()));
+    scoresBuilder.setBmiScore(subtract(aScores.getBmiScore(), bScores.getBmiScore()));
+    scoresBuilder.setCholesterolScore(subtract(aScores.getCholesterolScore(), bScores.getCholesterolScore()));
+    scoresBuilder.setCholesterolHdlScore(
+        subtract(aScores.getCholesterolHdlScore(), bScores.getCholesterolHdlScore()));
+    scoresBuilder.setTotalScore(subtract(aScores.getTotalScore(), bScores.getTotalScore()));
+
+    Pigeon.HealthRisks.Builder risksBuilder = new Pigeon.HealthRisks.Builder();
+    risksBuilder.setHardAndFatalEvents(hardAndFatalBuilder.build());
+    risksBuilder.setCvDiseases(cvDiseasesBuilder.build());
+    risksBuilder.setVascularAge(subtract(a.getVascularAge(), b.getVascularAge()));
+    risksBuilder.setScores(scoresBuilder.build());
+    return risksBuilder.build();
+  }
+
+  private static @Nullable Double subtract(@Nullable Double a, @Nullable Double b) {
+    return a == null || b == null ? null : a - b;
+  }
+
+  private static @Nullable Long subtract(@Nullable Long a, @Nullable Long b) {
+    return a == null || b == null ? null : a - b;
+  }
+
+  private static double axisValue(@NonNull Pigeon.HealthRisksGridAxis axis, int index) {
+    if (axis.getSteps() <= 1) {
+      return axis.getMin();
+    }
+    return axis.getMin() + (axis.getMax() - axis.getMin()) * index / (axis.getSteps() - 1);
+  }
+
+  private static void setGridFactor(
+      @NonNull Pigeon.RisksFactors factors, @NonNull Pigeon.HealthRisksGridFactor factor, double value) {
+    switch (factor) {
+      case AGE:
+        factors.setAge(Math.round(value));
+        break;
+      case SBP:
+        factors.setSbp(value);
+        break;
+      case CHOLESTEROL:
+        factors.setCholesterol(value);
+        break;
+      case CHOLESTEROL_HDL:
+        factors.setCholesterolHdl(value);
+        break;
+      case BODY_WEIGHT:
+        factors.setBodyWeight(value);
+        break;
+      case BODY_HEIGHT:
+        factors.setBodyHeight(value);
+        break;
+    }
+  }
+
+  private static float metricValue(@NonNull Pigeon.HealthRisks risks, @NonNull Pigeon.HealthRisksMetric metric) {
+    Pigeon.HardAndFatalEventsRisks hardAndFatal = risks.getHardAndFatalEvents();
+    Pigeon.CVDiseasesRisks cvDiseases = risks.getCvDiseases();
+    Pigeon.RisksFactorsScores scores = risks.getScores();
+    switch (metric) {
+      case CORONARY_DEATH_EVENT_RISK:
+        return toFloat(hardAndFatal.getCoronaryDeathEventRisk());
+      case FATAL_STROKE_EVENT_RISK:
+        return toFloat(hardAndFatal.getFatalStrokeEventRisk());
+      case TOTAL_CVMORTALITY_RISK:
+        return toFloat(hardAndFatal.getTotalCVMortalityRisk());
+      case HARD_CVEVENT_RISK:
+        return toFloat(hardAndFatal.getHardCVEventRisk());
+      case OVERALL_RISK:
+        return toFloat(cvDiseases.getOverallRisk());
+      case CORONARY_HEART_DISEASE_RISK:
+        return toFloat(cvDiseases.getCoronaryHeartDiseaseRisk());
+      case STROKE_RISK:
+        return toFloat(cvDiseases.getStrokeRisk());
+      case HEART_FAILURE_RISK:
+        return toFloat(cvDiseases.getHeartFailureRisk());
+      case PERIPHERAL_VASCULAR_DISEASE_RISK:
+        return toFloat(cvDiseases.getPeripheralVascularDiseaseRisk());
+      case VASCULAR_AGE:
+        return toFloat(risks.getVascularAge());
+      case AGE_SCORE:
+        return toFloat(scores.getAgeScore());
+      case SBP_SCORE:
+        return toFloat(scores.getSbpScore());
+      case SMOKING_SCORE:
+        return toFloat(scores.getSmokingScore());
+      case DIABETES_SCORE:
+        return toFloat(scores.getDiabetesScore());
+      case BMI_SCORE:
+        return toFloat(scores.getBmiScore());
+      case CHOLESTEROL_SCORE:
+        return toFloat(scores.getCholesterolScore());
+      case CHOLESTEROL_HDL_SCORE:
+        return toFloat(scores.getCholesterolHdlScore());
+      case TOTAL_SCORE:
+        return toFloat(scores.getTotalScore());
+    }
+    return Float.NaN;
+  }
+
+  private static float toFloat(@Nullable Number value) {
+    return value == null ? Float.NaN : value.floatValue();
+  }
+
+  // Nearest-rank percentile of sorted values
+  private static int rank(double percentile, int count) {
+    return (int) Math.round(Math.max(0.0, Math.min(100.0, percentile)) / 100.0 * (count - 1));
+  }
+
+  private static @Nullable Double toDouble(@Nullable Float value) {
+    return value == null ? null : value.doubleValue();
+  }
+
+  private static @Nullable Long toLong(@Nullable Float value) {
+    return value == null ? null : (long) Math.round(value);
+  }
+
+  /** HealthRisks with every field taken from values indexed by HealthRisksMetric. */
+  private static Pigeon.HealthRisks fromMetrics(@NonNull Float[] values) {
+    Pigeon.HardAndFatalEventsRisks.Builder hardAndFatalBuilder = new Pigeon.HardAndFatalEventsRisks.Builder();
+    hardAndFatalBuilder.setCoronaryDeathEventRisk(
+        toDouble(values[Pigeon.HealthRisksMetric.CORONARY_DEATH_EVENT_RISK.ordinal()]));
+    hardAndFatalBuilder.setFatalStrokeEventRisk(
+        toDouble(values[Pigeon.HealthRisksMetric.FATAL_STROKE_EVENT_RISK.ordinal()]));
+    hardAndFatalBuilder.setTotalCVMortalityRisk(
+        toDouble(values[Pigeon.HealthRisksMetric.TOTAL_CVMORTALITY_RISK.ordinal()]));
+    hardAndFatalBuilder.setHardCVEventRisk(toDouble(values[Pigeon.HealthRisksMetric.HARD_CVEVENT_RISK.ordinal()]));
+
+    Pigeon.CVDiseasesRisks.Builder cvDiseasesBuilder = new Pigeon.CVDiseasesRisks.Builder();
+    cvDiseasesBuilder.setOverallRisk(toDouble(values[Pigeon.HealthRisksMetric.OVERALL_RISK.ordinal()]));
+    cvDiseasesBuilder.setCoronaryHeartDiseaseRisk(
+        toDouble(values[Pigeon.HealthRisksMetric.CORONARY_HEART_DISEASE_RISK.ordinal()]));
+    cvDiseasesBuilder.setStrokeRisk(toDouble(values[Pigeon.HealthRisksMetric.STROKE_RISK.ordinal()]));
+    cvDiseasesBuilder.setHeartFailureRisk(toDouble(values[Pigeon.HealthRisksMetric.HEART_FAILURE_RISK.ordinal()]));
+    cvDiseasesBuilder.setPeripheralVascularDiseaseRisk(
+        toDouble(values[Pigeon.HealthRisksMetric.PERIPHERAL_VASCULAR_DISEASE_RISK.ordinal()]));
+
+    Pigeon.RisksFactorsScores.Builder scoresBuilder = new Pigeon.RisksFactorsScores.Builder();
+    scoresBuilder.setAgeScore(toLong(values[Pigeon.HealthRisksMetric.AGE_SCORE.ordinal()]));
+    scoresBuilder.setSbpScore(toLong(values[Pigeon.HealthRisksMetric.SBP_SCORE.ordinal()]));
+    scoresBuilder.setSmokingScore(toLong(values[Pigeon.HealthRisksMetric.SMOKING_SCORE.ordinal()]));
+    scoresBuilder.setDiabetesScore(toLong(values[Pigeon.HealthRisksMetric.DIABETES_SCORE.ordinal()]));
+    scoresBuilder.setBmiScore(toLong(values[Pigeon.HealthRisksMetric.BMI_SCORE.ordinal()]));
+    scoresBuilder.setCholesterolScore(toLong(values[Pigeon.HealthRisksMetric.CHOLESTEROL_SCORE.ordinal()]));
+    scoresBuilder.setCholesterolHdlScore(toLong(values[Pigeon.HealthRisksMetric.CHOLESTEROL_HDL_SCORE.ordinal()]));
+    scoresBuilder.setTotalScore(toLong(values[Pigeon.HealthRisksMetric.TOTAL_SCORE.ordinal()]));
+
+    Pigeon.HealthRisks.Builder risksBuilder = new Pigeon.HealthRisks.Builder();
+    risksBuilder.setHardAndFatalEvents(hardAndFatalBuilder.build());
+    risksBuilder.setCvDiseases(cvDiseasesBuilder.build());
+    risksBuilder.setVascularAge(toLong(values[Pigeon.HealthRisksMetric.VASCULAR_AGE.ordinal()]));
+    risksBuilder.setScores(scoresBuilder.build());
+    return risksBuilder.build();
+  }
+
+  private static Pigeon.RisksFactors changed(
+      @NonNull Pigeon.RisksFactors factors, @NonNull Consumer<Pigeon.RisksFactors> change) {
+    Pigeon.RisksFactors result = copy(factors);
+    change.accept(result);
+    return result;
+  }
+
+  private static void addSensitivity(@NonNull ArrayList<Pigeon.RiskFactorSensitivity> sensitivities,
+      @NonNull Pigeon.ModifiableRiskFactor factor, double step, @NonNull Pigeon.RisksFactors changedFactors,
+      @NonNull Pigeon.HealthRisks risks, @NonNull Function<Pigeon.RisksFactors, Pigeon.HealthRisks> compute) {
+    Pigeon.RiskFactorSensitivity.Builder sensitivityBuilder = new Pigeon.RiskFactorSensitivity.Builder();
+    sensitivityBuilder.setFactor(factor);
+    sensitivityBuilder.setStep(step);
+    sensitivityBuilder.setDelta(subtract(compute.apply(changedFactors), risks));
+    sensitivities.add(sensitivityBuilder.build());
+  }
+
+  /** Independent normal stream per (seed, chunk), Box-Muller over splitmix64 like the iOS implementation. */
+  private static final class NormalStream {
+    private long state;
+    private double spare = Double.NaN;
+
+    NormalStream(long seed, long chunk) {
+      state = seed ^ mix(chunk + 0x9E3779B97F4A7C15L);
+    }
+
+    /** Normal draw truncated at zero, or the mean itself when it is missing or not uncertain. */
+    @Nullable Double sample(@Nullable Double mean, @Nullable Double sd) {
+      if (mean == null || mean <= 0 || sd == null || sd <= 0) {
+        return mean;
+      }
+      while (true) {
+        double value = mean + sd * next();
+        if (value > 0) {
+          return value;
+        }
+      }
+    }
+
+    private double next() {
+      if (!Double.isNaN(spare)) {
+        double value = spare;
+        spare = Double.NaN;
+        return value;
+      }
+      // 53 random bits in (0, 1], so the logarithm is finite
+      double u1 = ((nextLong() >>> 11) + 1) * 0x1.0p-53;
+      double u2 = (nextLong() >>> 11) * 0x1.0p-53;
+      double radius = Math.sqrt(-2.0 * Math.log(u1));
+      spare = radius * Math.sin(2.0 * Math.PI * u2);
+      return radius * Math.cos(2.0 * Math.PI * u2);
+    }
+
+    private long nextLong() {
+      state += 0x9E3779B97F4A7C15L;
+      return mix(state);
+    }
+
+    private static long mix(long z) {
+      z = (z ^ (z >>> 30)) * 0xBF58476D1CE4E5B9L;
+      z = (z ^ (z >>> 27)) * 0x94D049BB133111EBL;
+      return z ^ (z >>> 31);
+    }
+  }
+}
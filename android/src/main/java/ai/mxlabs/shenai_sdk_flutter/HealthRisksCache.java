@@ -0,0 +1,117 @@
+package ai.mxlabs.shenai_sdk_flutter;
+
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * Bounded LRU memo of health risks keyed on quantized risk factors: integer age, SBP to 1 mmHg,
+ * cholesterol, HDL, height and weight to 0.1, plus flags, gender, race and country.
+ * Results are always computed from the quantized factors, so a cached and a fresh answer never differ.
+ * Factors with non-finite values can't be keyed exactly and are computed as given, outside of the cache.
+ * Entries are spread over independently locked shards by key hash.
+ */
+class HealthRisksCache {
+
+  interface Computation {
+    Pigeon.HealthRisks compute(@NonNull Pigeon.RisksFactors healthRisksFactors);
+  }
+
+  private static final int NUM_SHARDS = 16;
+
+  private final Map<List<Object>, Pigeon.HealthRisks>[] shards;
+  private final AtomicLong hits = new AtomicLong();
+  private final AtomicLong misses = new AtomicLong();
+
+  @SuppressWarnings("unchecked")
+  HealthRisksCache(int capacity) {
+    int numShards = Math.max(1, Math.min(NUM_SHARDS, capacity));
+    int shardCapacity = (capacity + numShards - 1) / numShards;
+    shards = new Map[numShards];
+    for (int i = 0; i < numShards; i++) {
+      shards[i] = new LinkedHashMap<List<Object>, Pigeon.HealthRisks>(16, 0.75f, true) {
+        @Override
+        protected boolean removeEldestEntry(Map.Entry<List<Object>, Pigeon.HealthRisks> eldest) {
+          return size() > shardCapacity;
+        }
+      };
+    }
+  }
+
+  Pigeon.HealthRisks compute(@NonNull Pigeon.RisksFactors healthRisksFactors, @NonNull Computation computation) {
+    // non-finite values can't be keyed exactly, like on iOS they bypass the cache without touching the counters
+    if (!isFinite(healthRisksFactors)) {
+      return computation.compute(healthRisksFactors);
+    }
+    Pigeon.RisksFactors quantized = quantize(healthRisksFactors);
+    List<Object> key = key(quantized);
+    Map<List<Object>, Pigeon.HealthRisks> shard = shards[Math.floorMod(key.hashCode() >>> 7, shards.length)];
+
+    synchronized (shard) {
+      Pigeon.HealthRisks cached = shard.get(key);
+      if (cached != null) {
+        hits.incrementAndGet();
+        return cached;
+      }
+    }
+
+    // compute outside of the lock, concurrent misses on the same key just store the same value twice
+    misses.incrementAndGet();
+    Pigeon.HealthRisks risks = computation.compute(quantized);
+    synchronized (shard) {
+      shard.put(key, risks);
+    }
+    return risks;
+  }
+
+  Pigeon.HealthRisksCacheStats getStats() {
+    Pigeon.HealthRisksCacheStats.Builder statsBuilder = new Pigeon.HealthRisksCacheStats.Builder();
+    statsBuilder.setHits(hits.get());
+    statsBuilder.setMisses(misses.get());
+    return statsBuilder.build();
+  }
+
+  private static boolean isFinite(@Nullable Double value) {
+    return value == null || Double.isFinite(value);
+  }
+
+  private static boolean isFinite(@NonNull Pigeon.RisksFactors factors) {
+    return isFinite(factors.getSbp()) && isFinite(factors.getCholesterol()) && isFinite(factors.getCholesterolHdl())
+        && isFinite(factors.getBodyHeight()) && isFinite(factors.getBodyWeight());
+  }
+
+  private static @Nullable Double round(@Nullable Double value, double scale) {
+    if (value == null) {
+      return null;
+    }
+    return Math.round(value * scale) / scale;
+  }
+
+  private static Pigeon.RisksFactors quantize(@NonNull Pigeon.RisksFactors factors) {
+    Pigeon.RisksFactors.Builder builder = new Pigeon.RisksFactors.Builder();
+    builder.setAge(factors.getAge());
+    builder.setSbp(round(factors.getSbp(), 1.0));
+    builder.setCholesterol(round(factors.getCholesterol(), 10.0));
+    builder.setCholesterolHdl(round(factors.getCholesterolHdl(), 10.0));
+    builder.setBodyHeight(round(factors.getBodyHeight(), 10.0));
+    builder.setBodyWeight(round(factors.getBodyWeight(), 10.0));
+    builder.setIsSmoker(factors.getIsSmoker());
+    builder.setHypertensionTreatment(factors.getHypertensionTreatment());
+    builder.setHasDiabetes(factors.getHasDiabetes());
+    builder.setGender(factors.getGender());
+    builder.setCountry(factors.getCountry());
+    builder.setRace(factors.getRace());
+    return builder.build();
+  }
+
+  private static List<Object> key(@NonNull Pigeon.RisksFactors quantized) {
+    return Arrays.asList(quantized.getAge(), quantized.getSbp(), quantized.getCholesterol(),
+        quantized.getCholesterolHdl(), quantized.getBodyHeight(), quantized.getBodyWeight(), quantized.getIsSmoker(),
+        quantized.getHypertensionTreatment(), quantized.getHasDiabetes(), quantized.getGender(),
+        quantized.getCountry(), quantized.getRace());
+  }
+}
@@ -0,0 +1,126 @@
+package ai.mxlabs.shenai_sdk_flutter;
+
+import android.view.Choreographer;
+import androidx.annotation.NonNull;
+import ai.mxlabs.shenai_sdk.ShenAIAndroidSDK;
+
+/**
+ * Degrades the SDK overlays in steps while display frames run late or the SDK reports it is overloaded, and
+ * restores them once there is headroom again, never going below the configured floor. Mirrors the iOS
+ * ShenaiSdkLoadGovernor and ios/Classes/performance/load_governor. Main thread only; the overlays the app asks for
+ * go through it while it runs.
+ */
+final class LoadGovernor implements Choreographer.FrameCallback {
+
+  private static final int WINDOW_FRAMES = 60;
+  // a frame is late when it took longer than this many expected frame intervals
+  private static final double LATE_FRAME_FACTOR = 1.5;
+  private static final double STEP_DOWN_LATE_SHARE = 0.25;
+  private static final double STEP_UP_LATE_SHARE = 0.05;
+  private static final int STEP_UP_WINDOWS = 3;
+
+  private final ShenAIAndroidSDK sdk;
+  private final Pigeon.QualityTier floor;
+  private final long expectedIntervalNanos;
+  private boolean showFaceMask;
+  private boolean showBloodFlow;
+
+  private Pigeon.QualityTier tier = Pigeon.QualityTier.FULL;
+  private boolean running;
+  private long lastFrameNanos;
+  private int frames;
+  private int lateFrames;
+  private boolean overloaded;
+  private int headroomWindows;
+
+  LoadGovernor(@NonNull ShenAIAndroidSDK sdk, @NonNull Pigeon.QualityTier floor, float refreshRate,
+      boolean showFaceMask, boolean showBloodFlow) {
+    this.sdk = sdk;
+    this.floor = floor;
+    this.expectedIntervalNanos = (long) (1e9 / (refreshRate > 0 ? refreshRate : 60.0f));
+    this.showFaceMask = showFaceMask;
+    this.showBloodFlow = showBloodFlow;
+  }
+
+  @NonNull
+  Pigeon.QualityTier getTier() {
+    return tier;
+  }
+
+  void setShowFaceMask(boolean show) {
+    showFaceMask = show;
+    applyTier();
+  }
+
+  void setShowBloodFlow(boolean show) {
+    showBloodFlow = show;
+    applyTier();
+  }
+
+  void start() {
+    running = true;
+    lastFrameNanos = 0;
+    Choreographer.getInstance().postFrameCallback(this);
+  }
+
+  void stop() {
+    running = false;
+    Choreographer.getInstance().removeFrameCallback(this);
+  }
+
+  @Override
+  public void doFrame(long frameTimeNanos) {
+    if (!running) {
+      return;
+    }
+    Choreographer.getInstance().postFrameCallback(this);
+
+    long interval = lastFrameNanos > 0 ? frameTimeNanos - lastFrameNanos : 0;
+    lastFrameNanos = frameTimeNanos;
+    if (interval <= 0 || !sdk.isInitialized()) {
+      return;
+    }
+    boolean frameOverloaded = sdk.getOperatingMode() == ShenAIAndroidSDK.OperatingMode.SYSTEM_OVERLOADED;
+    if (onFrame(interval, frameOverloaded)) {
+      applyTier();
+    }
+  }
+
+  // Accounts one display frame, returns true when the tier changed
+  private boolean onFrame(long intervalNanos, boolean frameOverloaded) {
+    ++frames;
+    if (intervalNanos > expectedIntervalNanos * LATE_FRAME_FACTOR) {
+      ++lateFrames;
+    }
+    overloaded = overloaded || frameOverloaded;
+    // an overloaded SDK has already stopped measuring, don't wait for the window to end
+    if (frames < WINDOW_FRAMES && !overloaded) {
+      return false;
+    }
+
+    double lateShare = (double) lateFrames / frames;
+    Pigeon.QualityTier previous = tier;
+    if (overloaded || lateShare >= STEP_DOWN_LATE_SHARE) {
+      headroomWindows = 0;
+      if (tier.index < floor.index) {
+        tier = Pigeon.QualityTier.values()[tier.index + 1];
+      }
+    } else if (lateShare <= STEP_UP_LATE_SHARE) {
+      if (++headroomWindows >= STEP_UP_WINDOWS && tier != Pigeon.QualityTier.FULL) {
+        tier = Pigeon.QualityTier.values()[tier.index - 1];
+        headroomWindows = 0;
+      }
+    } else {
+      headroomWindows = 0;
+    }
+    frames = 0;
+    lateFrames = 0;
+    overloaded = false;
+    return tier != previous;
+  }
+
+  private void applyTier() {
+    sdk.setShowBloodFlow(showBloodFlow && tier.index < Pigeon.QualityTier.REDUCED_OVERLAYS.index);
+    sdk.setShowFaceMask(showFaceMask && tier.index < Pigeon.QualityTier.MINIMAL_OVERLAYS.index);
+  }
+}
@@ -61,7 +61,8 @@ public class Pigeon {
     SUCCESS(0),
     FAIL_INVALID_API_KEY(1),
     FAIL_CONNECTION_ERROR(2),
-    FAIL_INTERNAL_ERROR(3);
+    FAIL_INTERNAL_ERROR(3),
+    CANCELLED(4);
 
     final int index;
 
@@ -132,6 +133,18 @@ public class Pigeon {
     }
   }
 
+  public enum QualityTier {
+    FULL(0),
+    REDUCED_OVERLAYS(1),
+    MINIMAL_OVERLAYS(2);
+
+    final int index;
+
+    private QualityTier(final int index) {
+      this.index = index;
+    }
+  }
+
   public enum FaceState {
     OK(0),
     TOO_FAR(1),
@@ -188,6 +201,137 @@ public class Pigeon {
     }
   }
 
+  public enum ModifiableRiskFactor {
+    SBP(0),
+    CHOLESTEROL(1),
+    CHOLESTEROL_HDL(2),
+    SMOKING(3),
+    BMI(4),
+    DIABETES(5),
+    HYPERTENSION_TREATMENT(6);
+
+    final int index;
+
+    private ModifiableRiskFactor(final int index) {
+      this.index = index;
+    }
+  }
+
+  public enum HealthRisksGridFactor {
+    AGE(0),
+    SBP(1),
+    CHOLESTEROL(2),
+    CHOLESTEROL_HDL(3),
+    BODY_WEIGHT(4),
+    BODY_HEIGHT(5);
+
+    final int index;
+
+    private HealthRisksGridFactor(final int index) {
+      this.index = index;
+    }
+  }
+
+  public enum HealthRisksMetric {
+    CORONARY_DEATH_EVENT_RISK(0),
+    FATAL_STROKE_EVENT_RISK(1),
+    TOTAL_CVMORTALITY_RISK(2),
+    HARD_CVEVENT_RISK(3),
+    OVERALL_RISK(4),
+    CORONARY_HEART_DISEASE_RISK(5),
+    STROKE_RISK(6),
+    HEART_FAILURE_RISK(7),
+    PERIPHERAL_VASCULAR_DISEASE_RISK(8),
+    VASCULAR_AGE(9),
+    AGE_SCORE(10),
+    SBP_SCORE(11),
+    SMOKING_SCORE(12),
+    DIABETES_SCORE(13),
+    BMI_SCORE(14),
+    CHOLESTEROL_SCORE(15),
+    CHOLESTEROL_HDL_SCORE(16),
+    TOTAL_SCORE(17);
+
+    final int index;
+
+    private HealthRisksMetric(final int index) {
+      this.index = index;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class InitializationTimings {
+    private @NonNull Double queuedMs;
+
+    public @NonNull Double getQueuedMs() {
+      return queuedMs;
+    }
+
+    public void setQueuedMs(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"queuedMs\" is null.");
+      }
+      this.queuedMs = setterArg;
+    }
+
+    private @NonNull Double initializeMs;
+
+    public @NonNull Double getInitializeMs() {
+      return initializeMs;
+    }
+
+    public void setInitializeMs(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"initializeMs\" is null.");
+      }
+      this.initializeMs = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    InitializationTimings() {}
+
+    public static final class Builder {
+
+      private @Nullable Double queuedMs;
+
+      public @NonNull Builder setQueuedMs(@NonNull Double setterArg) {
+        this.queuedMs = setterArg;
+        return this;
+      }
+
+      private @Nullable Double initializeMs;
+
+      public @NonNull Builder setInitializeMs(@NonNull Double setterArg) {
+        this.initializeMs = setterArg;
+        return this;
+      }
+
+      public @NonNull InitializationTimings build() {
+        InitializationTimings pigeonReturn = new InitializationTimings();
+        pigeonReturn.setQueuedMs(queuedMs);
+        pigeonReturn.setInitializeMs(initializeMs);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(2);
+      toListResult.add(queuedMs);
+      toListResult.add(initializeMs);
+      return toListResult;
+    }
+
+    static @NonNull InitializationTimings fromList(@NonNull ArrayList<Object> list) {
+      InitializationTimings pigeonResult = new InitializationTimings();
+      Object queuedMs = list.get(0);
+      pigeonResult.setQueuedMs((Double) queuedMs);
+      Object initializeMs = list.get(1);
+      pigeonResult.setInitializeMs((Double) initializeMs);
+      return pigeonResult;
+    }
+  }
+
   /** Generated class from Pigeon that represents data sent in messages. */
   public static final class InitializeResponse {
     private @NonNull InitializationResult result;
@@ -203,6 +347,16 @@ public class Pigeon {
       this.result = setterArg;
     }
 
+    private @Nullable InitializationTimings timings;
+
+    public @Nullable InitializationTimings getTimings() {
+      return timings;
+    }
+
+    public void setTimings(@Nullable InitializationTimings setterArg) {
+      this.timings = setterArg;
+    }
+
     /** Constructor is non-public to enforce null safety; use Builder. */
     InitializeResponse() {}
 
@@ -215,17 +369,26 @@ public class Pigeon {
         return this;
       }
 
+      private @Nullable InitializationTimings timings;
+
+      public @NonNull Builder setTimings(@Nullable InitializationTimings setterArg) {
+        this.timings = setterArg;
+        return this;
+      }
+
       public @NonNull InitializeResponse build() {
         InitializeResponse pigeonReturn = new InitializeResponse();
         pigeonReturn.setResult(result);
+        pigeonReturn.setTimings(timings);
         return pigeonReturn;
       }
     }
 
     @NonNull
     ArrayList<Object> toList() {
-      ArrayList<Object> toListResult = new ArrayList<Object>(1);
+      ArrayList<Object> toListResult = new ArrayList<Object>(2);
       toListResult.add(result == null ? null : result.index);
+      toListResult.add((timings == null) ? null : timings.toList());
       return toListResult;
     }
 
@@ -233,6 +396,8 @@ public class Pigeon {
       InitializeResponse pigeonResult = new InitializeResponse();
       Object result = list.get(0);
       pigeonResult.setResult(InitializationResult.values()[(int) result]);
+      Object timings = list.get(1);
+      pigeonResult.setTimings((timings == null) ? null : InitializationTimings.fromList((ArrayList<Object>) timings));
       return pigeonResult;
     }
   }
@@ -433,6 +598,55 @@ public class Pigeon {
     }
   }
 
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class QualityTierResponse {
+    private @NonNull QualityTier tier;
+
+    public @NonNull QualityTier getTier() {
+      return tier;
+    }
+
+    public void setTier(@NonNull QualityTier setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"tier\" is null.");
+      }
+      this.tier = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    QualityTierResponse() {}
+
+    public static final class Builder {
+
+      private @Nullable QualityTier tier;
+
+      public @NonNull Builder setTier(@NonNull QualityTier setterArg) {
+        this.tier = setterArg;
+        return this;
+      }
+
+      public @NonNull QualityTierResponse build() {
+        QualityTierResponse pigeonReturn = new QualityTierResponse();
+        pigeonReturn.setTier(tier);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(1);
+      toListResult.add(tier == null ? null : tier.index);
+      return toListResult;
+    }
+
+    static @NonNull QualityTierResponse fromList(@NonNull ArrayList<Object> list) {
+      QualityTierResponse pigeonResult = new QualityTierResponse();
+      Object tier = list.get(0);
+      pigeonResult.setTier(QualityTier.values()[(int) tier]);
+      return pigeonResult;
+    }
+  }
+
   /** Generated class from Pigeon that represents data sent in messages. */
   public static final class FaceStateResponse {
     private @NonNull FaceState state;
@@ -750,1234 +964,1274 @@ public class Pigeon {
   }
 
   /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class MeasurementResults {
-    private @NonNull Double heart_rate_bpm;
+  public static final class StateSnapshot {
+    private @NonNull FaceState faceState;
 
-    public @NonNull Double getHeart_rate_bpm() {
-      return heart_rate_bpm;
+    public @NonNull FaceState getFaceState() {
+      return faceState;
     }
 
-    public void setHeart_rate_bpm(@NonNull Double setterArg) {
+    public void setFaceState(@NonNull FaceState setterArg) {
       if (setterArg == null) {
-        throw new IllegalStateException("Nonnull field \"heart_rate_bpm\" is null.");
+        throw new IllegalStateException("Nonnull field \"faceState\" is null.");
       }
-      this.heart_rate_bpm = setterArg;
-    }
-
-    private @Nullable Double hrv_sdnn_ms;
-
-    public @Nullable Double getHrv_sdnn_ms() {
-      return hrv_sdnn_ms;
-    }
-
-    public void setHrv_sdnn_ms(@Nullable Double setterArg) {
-      this.hrv_sdnn_ms = setterArg;
+      this.faceState = setterArg;
     }
 
-    private @Nullable Double hrv_lnrmssd_ms;
+    private @Nullable NormalizedFaceBbox normalizedFaceBbox;
 
-    public @Nullable Double getHrv_lnrmssd_ms() {
-      return hrv_lnrmssd_ms;
+    public @Nullable NormalizedFaceBbox getNormalizedFaceBbox() {
+      return normalizedFaceBbox;
     }
 
-    public void setHrv_lnrmssd_ms(@Nullable Double setterArg) {
-      this.hrv_lnrmssd_ms = setterArg;
+    public void setNormalizedFaceBbox(@Nullable NormalizedFaceBbox setterArg) {
+      this.normalizedFaceBbox = setterArg;
     }
 
-    private @Nullable Double stress_index;
+    private @NonNull MeasurementState measurementState;
 
-    public @Nullable Double getStress_index() {
-      return stress_index;
+    public @NonNull MeasurementState getMeasurementState() {
+      return measurementState;
     }
 
-    public void setStress_index(@Nullable Double setterArg) {
-      this.stress_index = setterArg;
+    public void setMeasurementState(@NonNull MeasurementState setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"measurementState\" is null.");
+      }
+      this.measurementState = setterArg;
     }
 
-    private @Nullable Double breathing_rate_bpm;
+    private @NonNull Double measurementProgressPercentage;
 
-    public @Nullable Double getBreathing_rate_bpm() {
-      return breathing_rate_bpm;
+    public @NonNull Double getMeasurementProgressPercentage() {
+      return measurementProgressPercentage;
     }
 
-    public void setBreathing_rate_bpm(@Nullable Double setterArg) {
-      this.breathing_rate_bpm = setterArg;
+    public void setMeasurementProgressPercentage(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"measurementProgressPercentage\" is null.");
+      }
+      this.measurementProgressPercentage = setterArg;
     }
 
-    private @Nullable Double systolic_blood_pressure_mmhg;
+    private @Nullable Long heartRate4s;
 
-    public @Nullable Double getSystolic_blood_pressure_mmhg() {
-      return systolic_blood_pressure_mmhg;
+    public @Nullable Long getHeartRate4s() {
+      return heartRate4s;
     }
 
-    public void setSystolic_blood_pressure_mmhg(@Nullable Double setterArg) {
-      this.systolic_blood_pressure_mmhg = setterArg;
+    public void setHeartRate4s(@Nullable Long setterArg) {
+      this.heartRate4s = setterArg;
     }
 
-    private @Nullable Double diastolic_blood_pressure_mmhg;
+    private @Nullable Long heartRate10s;
 
-    public @Nullable Double getDiastolic_blood_pressure_mmhg() {
-      return diastolic_blood_pressure_mmhg;
+    public @Nullable Long getHeartRate10s() {
+      return heartRate10s;
     }
 
-    public void setDiastolic_blood_pressure_mmhg(@Nullable Double setterArg) {
-      this.diastolic_blood_pressure_mmhg = setterArg;
+    public void setHeartRate10s(@Nullable Long setterArg) {
+      this.heartRate10s = setterArg;
     }
 
-    private @NonNull List<Heartbeat> heartbeats;
+    private @NonNull Double signalQuality;
 
-    public @NonNull List<Heartbeat> getHeartbeats() {
-      return heartbeats;
+    public @NonNull Double getSignalQuality() {
+      return signalQuality;
     }
 
-    public void setHeartbeats(@NonNull List<Heartbeat> setterArg) {
+    public void setSignalQuality(@NonNull Double setterArg) {
       if (setterArg == null) {
-        throw new IllegalStateException("Nonnull field \"heartbeats\" is null.");
+        throw new IllegalStateException("Nonnull field \"signalQuality\" is null.");
       }
-      this.heartbeats = setterArg;
+      this.signalQuality = setterArg;
     }
 
-    private @NonNull Double average_signal_quality;
+    private @NonNull Double totalBadSignalSeconds;
 
-    public @NonNull Double getAverage_signal_quality() {
-      return average_signal_quality;
+    public @NonNull Double getTotalBadSignalSeconds() {
+      return totalBadSignalSeconds;
     }
 
-    public void setAverage_signal_quality(@NonNull Double setterArg) {
+    public void setTotalBadSignalSeconds(@NonNull Double setterArg) {
       if (setterArg == null) {
-        throw new IllegalStateException("Nonnull field \"average_signal_quality\" is null.");
+        throw new IllegalStateException("Nonnull field \"totalBadSignalSeconds\" is null.");
       }
-      this.average_signal_quality = setterArg;
+      this.totalBadSignalSeconds = setterArg;
     }
 
     /** Constructor is non-public to enforce null safety; use Builder. */
-    MeasurementResults() {}
+    StateSnapshot() {}
 
     public static final class Builder {
 
-      private @Nullable Double heart_rate_bpm;
-
-      public @NonNull Builder setHeart_rate_bpm(@NonNull Double setterArg) {
-        this.heart_rate_bpm = setterArg;
-        return this;
-      }
-
-      private @Nullable Double hrv_sdnn_ms;
+      private @Nullable FaceState faceState;
 
-      public @NonNull Builder setHrv_sdnn_ms(@Nullable Double setterArg) {
-        this.hrv_sdnn_ms = setterArg;
+      public @NonNull Builder setFaceState(@NonNull FaceState setterArg) {
+        this.faceState = setterArg;
         return this;
       }
 
-      private @Nullable Double hrv_lnrmssd_ms;
+      private @Nullable NormalizedFaceBbox normalizedFaceBbox;
 
-      public @NonNull Builder setHrv_lnrmssd_ms(@Nullable Double setterArg) {
-        this.hrv_lnrmssd_ms = setterArg;
+      public @NonNull Builder setNormalizedFaceBbox(@Nullable NormalizedFaceBbox setterArg) {
+        this.normalizedFaceBbox = setterArg;
         return this;
       }
 
-      private @Nullable Double stress_index;
+      private @Nullable MeasurementState measurementState;
 
-      public @NonNull Builder setStress_index(@Nullable Double setterArg) {
-        this.stress_index = setterArg;
+      public @NonNull Builder setMeasurementState(@NonNull MeasurementState setterArg) {
+        this.measurementState = setterArg;
         return this;
       }
 
-      private @Nullable Double breathing_rate_bpm;
+      private @Nullable Double measurementProgressPercentage;
 
-      public @NonNull Builder setBreathing_rate_bpm(@Nullable Double setterArg) {
-        this.breathing_rate_bpm = setterArg;
+      public @NonNull Builder setMeasurementProgressPercentage(@NonNull Double setterArg) {
+        this.measurementProgressPercentage = setterArg;
         return this;
       }
 
-      private @Nullable Double systolic_blood_pressure_mmhg;
+      private @Nullable Long heartRate4s;
 
-      public @NonNull Builder setSystolic_blood_pressure_mmhg(@Nullable Double setterArg) {
-        this.systolic_blood_pressure_mmhg = setterArg;
+      public @NonNull Builder setHeartRate4s(@Nullable Long setterArg) {
+        this.heartRate4s = setterArg;
         return this;
       }
 
-      private @Nullable Double diastolic_blood_pressure_mmhg;
+      private @Nullable Long heartRate10s;
 
-      public @NonNull Builder setDiastolic_blood_pressure_mmhg(@Nullable Double setterArg) {
-        this.diastolic_blood_pressure_mmhg = setterArg;
+      public @NonNull Builder setHeartRate10s(@Nullable Long setterArg) {
+        this.heartRate10s = setterArg;
         return this;
       }
 
-      private @Nullable List<Heartbeat> heartbeats;
+      private @Nullable Double signalQuality;
 
-      public @NonNull Builder setHeartbeats(@NonNull List<Heartbeat> setterArg) {
-        this.heartbeats = setterArg;
+      public @NonNull Builder setSignalQuality(@NonNull Double setterArg) {
+        this.signalQuality = setterArg;
         return this;
       }
 
-      private @Nullable Double average_signal_quality;
+      private @Nullable Double totalBadSignalSeconds;
 
-      public @NonNull Builder setAverage_signal_quality(@NonNull Double setterArg) {
-        this.average_signal_quality = setterArg;
+      public @NonNull Builder setTotalBadSignalSeconds(@NonNull Double setterArg) {
+        this.totalBadSignalSeconds = setterArg;
         return this;
       }
 
-      public @NonNull MeasurementResults build() {
-        MeasurementResults pigeonReturn = new MeasurementResults();
-        pigeonReturn.setHeart_rate_bpm(heart_rate_bpm);
-        pigeonReturn.setHrv_sdnn_ms(hrv_sdnn_ms);
-        pigeonReturn.setHrv_lnrmssd_ms(hrv_lnrmssd_ms);
-        pigeonReturn.setStress_index(stress_index);
-        pigeonReturn.setBreathing_rate_bpm(breathing_rate_bpm);
-        pigeonReturn.setSystolic_blood_pressure_mmhg(systolic_blood_pressure_mmhg);
-        pigeonReturn.setDiastolic_blood_pressure_mmhg(diastolic_blood_pressure_mmhg);
-        pigeonReturn.setHeartbeats(heartbeats);
-        pigeonReturn.setAverage_signal_quality(average_signal_quality);
+      public @NonNull StateSnapshot build() {
+        StateSnapshot pigeonReturn = new StateSnapshot();
+        pigeonReturn.setFaceState(faceState);
+        pigeonReturn.setNormalizedFaceBbox(normalizedFaceBbox);
+        pigeonReturn.setMeasurementState(measurementState);
+        pigeonReturn.setMeasurementProgressPercentage(measurementProgressPercentage);
+        pigeonReturn.setHeartRate4s(heartRate4s);
+        pigeonReturn.setHeartRate10s(heartRate10s);
+        pigeonReturn.setSignalQuality(signalQuality);
+        pigeonReturn.setTotalBadSignalSeconds(totalBadSignalSeconds);
         return pigeonReturn;
       }
     }
 
     @NonNull
     ArrayList<Object> toList() {
-      ArrayList<Object> toListResult = new ArrayList<Object>(9);
-      toListResult.add(heart_rate_bpm);
-      toListResult.add(hrv_sdnn_ms);
-      toListResult.add(hrv_lnrmssd_ms);
-      toListResult.add(stress_index);
-      toListResult.add(breathing_rate_bpm);
-      toListResult.add(systolic_blood_pressure_mmhg);
-      toListResult.add(diastolic_blood_pressure_mmhg);
-      toListResult.add(heartbeats);
-      toListResult.add(average_signal_quality);
+      ArrayList<Object> toListResult = new ArrayList<Object>(8);
+      toListResult.add(faceState == null ? null : faceState.index);
+      toListResult.add((normalizedFaceBbox == null) ? null : normalizedFaceBbox.toList());
+      toListResult.add(measurementState == null ? null : measurementState.index);
+      toListResult.add(measurementProgressPercentage);
+      toListResult.add(heartRate4s);
+      toListResult.add(heartRate10s);
+      toListResult.add(signalQuality);
+      toListResult.add(totalBadSignalSeconds);
       return toListResult;
     }
 
-    static @NonNull MeasurementResults fromList(@NonNull ArrayList<Object> list) {
-      MeasurementResults pigeonResult = new MeasurementResults();
-      Object heart_rate_bpm = list.get(0);
-      pigeonResult.setHeart_rate_bpm((Double) heart_rate_bpm);
-      Object hrv_sdnn_ms = list.get(1);
-      pigeonResult.setHrv_sdnn_ms((Double) hrv_sdnn_ms);
-      Object hrv_lnrmssd_ms = list.get(2);
-      pigeonResult.setHrv_lnrmssd_ms((Double) hrv_lnrmssd_ms);
-      Object stress_index = list.get(3);
-      pigeonResult.setStress_index((Double) stress_index);
-      Object breathing_rate_bpm = list.get(4);
-      pigeonResult.setBreathing_rate_bpm((Double) breathing_rate_bpm);
-      Object systolic_blood_pressure_mmhg = list.get(5);
-      pigeonResult.setSystolic_blood_pressure_mmhg((Double) systolic_blood_pressure_mmhg);
-      Object diastolic_blood_pressure_mmhg = list.get(6);
-      pigeonResult.setDiastolic_blood_pressure_mmhg((Double) diastolic_blood_pressure_mmhg);
-      Object heartbeats = list.get(7);
-      pigeonResult.setHeartbeats((List<Heartbeat>) heartbeats);
-      Object average_signal_quality = list.get(8);
-      pigeonResult.setAverage_signal_quality((Double) average_signal_quality);
+    static @NonNull StateSnapshot fromList(@NonNull ArrayList<Object> list) {
+      StateSnapshot pigeonResult = new StateSnapshot();
+      Object faceState = list.get(0);
+      pigeonResult.setFaceState(FaceState.values()[(int) faceState]);
+      Object normalizedFaceBbox = list.get(1);
+      pigeonResult.setNormalizedFaceBbox((normalizedFaceBbox == null) ? null : NormalizedFaceBbox.fromList((ArrayList<Object>) normalizedFaceBbox));
+      Object measurementState = list.get(2);
+      pigeonResult.setMeasurementState(MeasurementState.values()[(int) measurementState]);
+      Object measurementProgressPercentage = list.get(3);
+      pigeonResult.setMeasurementProgressPercentage((Double) measurementProgressPercentage);
+      Object heartRate4s = list.get(4);
+      pigeonResult.setHeartRate4s((heartRate4s == null) ? null : ((heartRate4s instanceof Integer) ? (Integer) heartRate4s : (Long) heartRate4s));
+      Object heartRate10s = list.get(5);
+      pigeonResult.setHeartRate10s((heartRate10s == null) ? null : ((heartRate10s instanceof Integer) ? (Integer) heartRate10s : (Long) heartRate10s));
+      Object signalQuality = list.get(6);
+      pigeonResult.setSignalQuality((Double) signalQuality);
+      Object totalBadSignalSeconds = list.get(7);
+      pigeonResult.setTotalBadSignalSeconds((Double) totalBadSignalSeconds);
       return pigeonResult;
     }
   }
 
   /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class InitializationSettings {
-    private @Nullable PrecisionMode precisionMode;
+  public static final class HeartRateHistory {
+    private @NonNull double[] timestampsSec;
 
-    public @Nullable PrecisionMode getPrecisionMode() {
-      return precisionMode;
+    public @NonNull double[] getTimestampsSec() {
+      return timestampsSec;
     }
 
-    public void setPrecisionMode(@Nullable PrecisionMode setterArg) {
-      this.precisionMode = setterArg;
+    public void setTimestampsSec(@NonNull double[] setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"timestampsSec\" is null.");
+      }
+      this.timestampsSec = setterArg;
     }
 
-    private @Nullable OperatingMode operatingMode;
+    private @NonNull int[] heartRatesBpm;
 
-    public @Nullable OperatingMode getOperatingMode() {
-      return operatingMode;
+    public @NonNull int[] getHeartRatesBpm() {
+      return heartRatesBpm;
     }
 
-    public void setOperatingMode(@Nullable OperatingMode setterArg) {
-      this.operatingMode = setterArg;
+    public void setHeartRatesBpm(@NonNull int[] setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"heartRatesBpm\" is null.");
+      }
+      this.heartRatesBpm = setterArg;
     }
 
-    private @Nullable MeasurementPreset measurementPreset;
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    HeartRateHistory() {}
 
-    public @Nullable MeasurementPreset getMeasurementPreset() {
-      return measurementPreset;
-    }
+    public static final class Builder {
 
-    public void setMeasurementPreset(@Nullable MeasurementPreset setterArg) {
-      this.measurementPreset = setterArg;
+      private @Nullable double[] timestampsSec;
+
+      public @NonNull Builder setTimestampsSec(@NonNull double[] setterArg) {
+        this.timestampsSec = setterArg;
+        return this;
+      }
+
+      private @Nullable int[] heartRatesBpm;
+
+      public @NonNull Builder setHeartRatesBpm(@NonNull int[] setterArg) {
+        this.heartRatesBpm = setterArg;
+        return this;
+      }
+
+      public @NonNull HeartRateHistory build() {
+        HeartRateHistory pigeonReturn = new HeartRateHistory();
+        pigeonReturn.setTimestampsSec(timestampsSec);
+        pigeonReturn.setHeartRatesBpm(heartRatesBpm);
+        return pigeonReturn;
+      }
     }
 
-    private @Nullable CameraMode cameraMode;
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(2);
+      toListResult.add(timestampsSec);
+      toListResult.add(heartRatesBpm);
+      return toListResult;
+    }
 
-    public @Nullable CameraMode getCameraMode() {
-      return cameraMode;
+    static @NonNull HeartRateHistory fromList(@NonNull ArrayList<Object> list) {
+      HeartRateHistory pigeonResult = new HeartRateHistory();
+      Object timestampsSec = list.get(0);
+      pigeonResult.setTimestampsSec((double[]) timestampsSec);
+      Object heartRatesBpm = list.get(1);
+      pigeonResult.setHeartRatesBpm((int[]) heartRatesBpm);
+      return pigeonResult;
     }
+  }
 
-    public void setCameraMode(@Nullable CameraMode setterArg) {
-      this.cameraMode = setterArg;
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class Heartbeats {
+    private @NonNull double[] startLocationsSec;
+
+    public @NonNull double[] getStartLocationsSec() {
+      return startLocationsSec;
     }
 
-    private @Nullable OnboardingMode onboardingMode;
+    public void setStartLocationsSec(@NonNull double[] setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"startLocationsSec\" is null.");
+      }
+      this.startLocationsSec = setterArg;
+    }
 
-    public @Nullable OnboardingMode getOnboardingMode() {
-      return onboardingMode;
+    private @NonNull double[] endLocationsSec;
+
+    public @NonNull double[] getEndLocationsSec() {
+      return endLocationsSec;
     }
 
-    public void setOnboardingMode(@Nullable OnboardingMode setterArg) {
-      this.onboardingMode = setterArg;
+    public void setEndLocationsSec(@NonNull double[] setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"endLocationsSec\" is null.");
+      }
+      this.endLocationsSec = setterArg;
     }
 
-    private @Nullable Boolean showUserInterface;
+    private @NonNull double[] durationsMs;
 
-    public @Nullable Boolean getShowUserInterface() {
-      return showUserInterface;
+    public @NonNull double[] getDurationsMs() {
+      return durationsMs;
     }
 
-    public void setShowUserInterface(@Nullable Boolean setterArg) {
-      this.showUserInterface = setterArg;
+    public void setDurationsMs(@NonNull double[] setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"durationsMs\" is null.");
+      }
+      this.durationsMs = setterArg;
     }
 
-    private @Nullable Boolean showFacePositioningOverlay;
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    Heartbeats() {}
 
-    public @Nullable Boolean getShowFacePositioningOverlay() {
-      return showFacePositioningOverlay;
+    public static final class Builder {
+
+      private @Nullable double[] startLocationsSec;
+
+      public @NonNull Builder setStartLocationsSec(@NonNull double[] setterArg) {
+        this.startLocationsSec = setterArg;
+        return this;
+      }
+
+      private @Nullable double[] endLocationsSec;
+
+      public @NonNull Builder setEndLocationsSec(@NonNull double[] setterArg) {
+        this.endLocationsSec = setterArg;
+        return this;
+      }
+
+      private @Nullable double[] durationsMs;
+
+      public @NonNull Builder setDurationsMs(@NonNull double[] setterArg) {
+        this.durationsMs = setterArg;
+        return this;
+      }
+
+      public @NonNull Heartbeats build() {
+        Heartbeats pigeonReturn = new Heartbeats();
+        pigeonReturn.setStartLocationsSec(startLocationsSec);
+        pigeonReturn.setEndLocationsSec(endLocationsSec);
+        pigeonReturn.setDurationsMs(durationsMs);
+        return pigeonReturn;
+      }
     }
 
-    public void setShowFacePositioningOverlay(@Nullable Boolean setterArg) {
-      this.showFacePositioningOverlay = setterArg;
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(3);
+      toListResult.add(startLocationsSec);
+      toListResult.add(endLocationsSec);
+      toListResult.add(durationsMs);
+      return toListResult;
     }
 
-    private @Nullable Boolean showVisualWarnings;
+    static @NonNull Heartbeats fromList(@NonNull ArrayList<Object> list) {
+      Heartbeats pigeonResult = new Heartbeats();
+      Object startLocationsSec = list.get(0);
+      pigeonResult.setStartLocationsSec((double[]) startLocationsSec);
+      Object endLocationsSec = list.get(1);
+      pigeonResult.setEndLocationsSec((double[]) endLocationsSec);
+      Object durationsMs = list.get(2);
+      pigeonResult.setDurationsMs((double[]) durationsMs);
+      return pigeonResult;
+    }
+  }
 
-    public @Nullable Boolean getShowVisualWarnings() {
-      return showVisualWarnings;
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class MeasurementResults {
+    private @NonNull Double heart_rate_bpm;
+
+    public @NonNull Double getHeart_rate_bpm() {
+      return heart_rate_bpm;
     }
 
-    public void setShowVisualWarnings(@Nullable Boolean setterArg) {
-      this.showVisualWarnings = setterArg;
+    public void setHeart_rate_bpm(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"heart_rate_bpm\" is null.");
+      }
+      this.heart_rate_bpm = setterArg;
     }
 
-    private @Nullable Boolean enableCameraSwap;
+    private @Nullable Double hrv_sdnn_ms;
 
-    public @Nullable Boolean getEnableCameraSwap() {
-      return enableCameraSwap;
+    public @Nullable Double getHrv_sdnn_ms() {
+      return hrv_sdnn_ms;
     }
 
-    public void setEnableCameraSwap(@Nullable Boolean setterArg) {
-      this.enableCameraSwap = setterArg;
+    public void setHrv_sdnn_ms(@Nullable Double setterArg) {
+      this.hrv_sdnn_ms = setterArg;
     }
 
-    private @Nullable Boolean showFaceMask;
+    private @Nullable Double hrv_lnrmssd_ms;
 
-    public @Nullable Boolean getShowFaceMask() {
-      return showFaceMask;
+    public @Nullable Double getHrv_lnrmssd_ms() {
+      return hrv_lnrmssd_ms;
     }
 
-    public void setShowFaceMask(@Nullable Boolean setterArg) {
-      this.showFaceMask = setterArg;
+    public void setHrv_lnrmssd_ms(@Nullable Double setterArg) {
+      this.hrv_lnrmssd_ms = setterArg;
     }
 
-    private @Nullable Boolean showBloodFlow;
+    private @Nullable Double stress_index;
 
-    public @Nullable Boolean getShowBloodFlow() {
-      return showBloodFlow;
+    public @Nullable Double getStress_index() {
+      return stress_index;
     }
 
-    public void setShowBloodFlow(@Nullable Boolean setterArg) {
-      this.showBloodFlow = setterArg;
+    public void setStress_index(@Nullable Double setterArg) {
+      this.stress_index = setterArg;
     }
 
-    private @Nullable Boolean proVersionLock;
+    private @Nullable Double breathing_rate_bpm;
 
-    public @Nullable Boolean getProVersionLock() {
-      return proVersionLock;
+    public @Nullable Double getBreathing_rate_bpm() {
+      return breathing_rate_bpm;
     }
 
-    public void setProVersionLock(@Nullable Boolean setterArg) {
-      this.proVersionLock = setterArg;
+    public void setBreathing_rate_bpm(@Nullable Double setterArg) {
+      this.breathing_rate_bpm = setterArg;
     }
 
-    private @Nullable Boolean hideShenaiLogo;
+    private @Nullable Double systolic_blood_pressure_mmhg;
 
-    public @Nullable Boolean getHideShenaiLogo() {
-      return hideShenaiLogo;
+    public @Nullable Double getSystolic_blood_pressure_mmhg() {
+      return systolic_blood_pressure_mmhg;
     }
 
-    public void setHideShenaiLogo(@Nullable Boolean setterArg) {
-      this.hideShenaiLogo = setterArg;
+    public void setSystolic_blood_pressure_mmhg(@Nullable Double setterArg) {
+      this.systolic_blood_pressure_mmhg = setterArg;
     }
 
-    public static final class Builder {
+    private @Nullable Double diastolic_blood_pressure_mmhg;
 
-      private @Nullable PrecisionMode precisionMode;
+    public @Nullable Double getDiastolic_blood_pressure_mmhg() {
+      return diastolic_blood_pressure_mmhg;
+    }
 
-      public @NonNull Builder setPrecisionMode(@Nullable PrecisionMode setterArg) {
-        this.precisionMode = setterArg;
-        return this;
-      }
+    public void setDiastolic_blood_pressure_mmhg(@Nullable Double setterArg) {
+      this.diastolic_blood_pressure_mmhg = setterArg;
+    }
 
-      private @Nullable OperatingMode operatingMode;
+    private @NonNull Heartbeats heartbeats;
 
-      public @NonNull Builder setOperatingMode(@Nullable OperatingMode setterArg) {
-        this.operatingMode = setterArg;
-        return this;
+    public @NonNull Heartbeats getHeartbeats() {
+      return heartbeats;
+    }
+
+    public void setHeartbeats(@NonNull Heartbeats setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"heartbeats\" is null.");
       }
+      this.heartbeats = setterArg;
+    }
 
-      private @Nullable MeasurementPreset measurementPreset;
+    private @NonNull Double average_signal_quality;
 
-      public @NonNull Builder setMeasurementPreset(@Nullable MeasurementPreset setterArg) {
-        this.measurementPreset = setterArg;
-        return this;
+    public @NonNull Double getAverage_signal_quality() {
+      return average_signal_quality;
+    }
+
+    public void setAverage_signal_quality(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"average_signal_quality\" is null.");
       }
+      this.average_signal_quality = setterArg;
+    }
 
-      private @Nullable CameraMode cameraMode;
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    MeasurementResults() {}
 
-      public @NonNull Builder setCameraMode(@Nullable CameraMode setterArg) {
-        this.cameraMode = setterArg;
-        return this;
-      }
+    public static final class Builder {
 
-      private @Nullable OnboardingMode onboardingMode;
+      private @Nullable Double heart_rate_bpm;
 
-      public @NonNull Builder setOnboardingMode(@Nullable OnboardingMode setterArg) {
-        this.onboardingMode = setterArg;
+      public @NonNull Builder setHeart_rate_bpm(@NonNull Double setterArg) {
+        this.heart_rate_bpm = setterArg;
         return this;
       }
 
-      private @Nullable Boolean showUserInterface;
+      private @Nullable Double hrv_sdnn_ms;
 
-      public @NonNull Builder setShowUserInterface(@Nullable Boolean setterArg) {
-        this.showUserInterface = setterArg;
+      public @NonNull Builder setHrv_sdnn_ms(@Nullable Double setterArg) {
+        this.hrv_sdnn_ms = setterArg;
         return this;
       }
 
-      private @Nullable Boolean showFacePositioningOverlay;
+      private @Nullable Double hrv_lnrmssd_ms;
 
-      public @NonNull Builder setShowFacePositioningOverlay(@Nullable Boolean setterArg) {
-        this.showFacePositioningOverlay = setterArg;
+      public @NonNull Builder setHrv_lnrmssd_ms(@Nullable Double setterArg) {
+        this.hrv_lnrmssd_ms = setterArg;
         return this;
       }
 
-      private @Nullable Boolean showVisualWarnings;
+      private @Nullable Double stress_index;
 
-      public @NonNull Builder setShowVisualWarnings(@Nullable Boolean setterArg) {
-        this.showVisualWarnings = setterArg;
+      public @NonNull Builder setStress_index(@Nullable Double setterArg) {
+        this.stress_index = setterArg;
         return this;
       }
 
-      private @Nullable Boolean enableCameraSwap;
+      private @Nullable Double breathing_rate_bpm;
 
-      public @NonNull Builder setEnableCameraSwap(@Nullable Boolean setterArg) {
-        this.enableCameraSwap = setterArg;
+      public @NonNull Builder setBreathing_rate_bpm(@Nullable Double setterArg) {
+        this.breathing_rate_bpm = setterArg;
         return this;
       }
 
-      private @Nullable Boolean showFaceMask;
+      private @Nullable Double systolic_blood_pressure_mmhg;
 
-      public @NonNull Builder setShowFaceMask(@Nullable Boolean setterArg) {
-        this.showFaceMask = setterArg;
+      public @NonNull Builder setSystolic_blood_pressure_mmhg(@Nullable Double setterArg) {
+        this.systolic_blood_pressure_mmhg = setterArg;
         return this;
       }
 
-      private @Nullable Boolean showBloodFlow;
+      private @Nullable Double diastolic_blood_pressure_mmhg;
 
-      public @NonNull Builder setShowBloodFlow(@Nullable Boolean setterArg) {
-        this.showBloodFlow = setterArg;
+      public @NonNull Builder setDiastolic_blood_pressure_mmhg(@Nullable Double setterArg) {
+        this.diastolic_blood_pressure_mmhg = setterArg;
         return this;
       }
 
-      private @Nullable Boolean proVersionLock;
+      private @Nullable Heartbeats heartbeats;
 
-      public @NonNull Builder setProVersionLock(@Nullable Boolean setterArg) {
-        this.proVersionLock = setterArg;
+      public @NonNull Builder setHeartbeats(@NonNull Heartbeats setterArg) {
+        this.heartbeats = setterArg;
         return this;
       }
 
-      private @Nullable Boolean hideShenaiLogo;
+      private @Nullable Double average_signal_quality;
 
-      public @NonNull Builder setHideShenaiLogo(@Nullable Boolean setterArg) {
-        this.hideShenaiLogo = setterArg;
+      public @NonNull Builder setAverage_signal_quality(@NonNull Double setterArg) {
+        this.average_signal_quality = setterArg;
         return this;
       }
 
-      public @NonNull InitializationSettings build() {
-        InitializationSettings pigeonReturn = new InitializationSettings();
-        pigeonReturn.setPrecisionMode(precisionMode);
-        pigeonReturn.setOperatingMode(operatingMode);
-        pigeonReturn.setMeasurementPreset(measurementPreset);
-        pigeonReturn.setCameraMode(cameraMode);
-        pigeonReturn.setOnboardingMode(onboardingMode);
-        pigeonReturn.setShowUserInterface(showUserInterface);
-        pigeonReturn.setShowFacePositioningOverlay(showFacePositioningOverlay);
-        pigeonReturn.setShowVisualWarnings(showVisualWarnings);
-        pigeonReturn.setEnableCameraSwap(enableCameraSwap);
-        pigeonReturn.setShowFaceMask(showFaceMask);
-        pigeonReturn.setShowBloodFlow(showBloodFlow);
-        pigeonReturn.setProVersionLock(proVersionLock);
-        pigeonReturn.setHideShenaiLogo(hideShenaiLogo);
-        return pigeonReturn;
-      }
-    }
-
-    @NonNull
-    ArrayList<Object> toList() {
-      ArrayList<Object> toListResult = new ArrayList<Object>(13);
-      toListResult.add(precisionMode == null ? null : precisionMode.index);
-      toListResult.add(operatingMode == null ? null : operatingMode.index);
-      toListResult.add(measurementPreset == null ? null : measurementPreset.index);
-      toListResult.add(cameraMode == null ? null : cameraMode.index);
-      toListResult.add(onboardingMode == null ? null : onboardingMode.index);
-      toListResult.add(showUserInterface);
-      toListResult.add(showFacePositioningOverlay);
-      toListResult.add(showVisualWarnings);
-      toListResult.add(enableCameraSwap);
-      toListResult.add(showFaceMask);
-      toListResult.add(showBloodFlow);
-      toListResult.add(proVersionLock);
-      toListResult.add(hideShenaiLogo);
+      public @NonNull MeasurementResults build() {
+        MeasurementResults pigeonReturn = new MeasurementResults();
+        pigeonReturn.setHeart_rate_bpm(heart_rate_bpm);
+        pigeonReturn.setHrv_sdnn_ms(hrv_sdnn_ms);
+        pigeonReturn.setHrv_lnrmssd_ms(hrv_lnrmssd_ms);
+        pigeonReturn.setStress_index(stress_index);
+        pigeonReturn.setBreathing_rate_bpm(breathing_rate_bpm);
+        pigeonReturn.setSystolic_blood_pressure_mmhg(systolic_blood_pressure_mmhg);
+        pigeonReturn.setDiastolic_blood_pressure_mmhg(diastolic_blood_pressure_mmhg);
+        pigeonReturn.setHeartbeats(heartbeats);
+        pigeonReturn.setAverage_signal_quality(average_signal_quality);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(9);
+      toListResult.add(heart_rate_bpm);
+      toListResult.add(hrv_sdnn_ms);
+      toListResult.add(hrv_lnrmssd_ms);
+      toListResult.add(stress_index);
+      toListResult.add(breathing_rate_bpm);
+      toListResult.add(systolic_blood_pressure_mmhg);
+      toListResult.add(diastolic_blood_pressure_mmhg);
+      toListResult.add((heartbeats == null) ? null : heartbeats.toList());
+      toListResult.add(average_signal_quality);
       return toListResult;
     }
 
-    static @NonNull InitializationSettings fromList(@NonNull ArrayList<Object> list) {
-      InitializationSettings pigeonResult = new InitializationSettings();
-      Object precisionMode = list.get(0);
-      pigeonResult.setPrecisionMode(precisionMode == null ? null : PrecisionMode.values()[(int) precisionMode]);
-      Object operatingMode = list.get(1);
-      pigeonResult.setOperatingMode(operatingMode == null ? null : OperatingMode.values()[(int) operatingMode]);
-      Object measurementPreset = list.get(2);
-      pigeonResult.setMeasurementPreset(measurementPreset == null ? null : MeasurementPreset.values()[(int) measurementPreset]);
-      Object cameraMode = list.get(3);
-      pigeonResult.setCameraMode(cameraMode == null ? null : CameraMode.values()[(int) cameraMode]);
-      Object onboardingMode = list.get(4);
-      pigeonResult.setOnboardingMode(onboardingMode == null ? null : OnboardingMode.values()[(int) onboardingMode]);
-      Object showUserInterface = list.get(5);
-      pigeonResult.setShowUserInterface((Boolean) showUserInterface);
-      Object showFacePositioningOverlay = list.get(6);
-      pigeonResult.setShowFacePositioningOverlay((Boolean) showFacePositioningOverlay);
-      Object showVisualWarnings = list.get(7);
-      pigeonResult.setShowVisualWarnings((Boolean) showVisualWarnings);
-      Object enableCameraSwap = list.get(8);
-      pigeonResult.setEnableCameraSwap((Boolean) enableCameraSwap);
-      Object showFaceMask = list.get(9);
-      pigeonResult.setShowFaceMask((Boolean) showFaceMask);
-      Object showBloodFlow = list.get(10);
-      pigeonResult.setShowBloodFlow((Boolean) showBloodFlow);
-      Object proVersionLock = list.get(11);
-      pigeonResult.setProVersionLock((Boolean) proVersionLock);
-      Object hideShenaiLogo = list.get(12);
-      pigeonResult.setHideShenaiLogo((Boolean) hideShenaiLogo);
+    static @NonNull MeasurementResults fromList(@NonNull ArrayList<Object> list) {
+      MeasurementResults pigeonResult = new MeasurementResults();
+      Object heart_rate_bpm = list.get(0);
+      pigeonResult.setHeart_rate_bpm((Double) heart_rate_bpm);
+      Object hrv_sdnn_ms = list.get(1);
+      pigeonResult.setHrv_sdnn_ms((Double) hrv_sdnn_ms);
+      Object hrv_lnrmssd_ms = list.get(2);
+      pigeonResult.setHrv_lnrmssd_ms((Double) hrv_lnrmssd_ms);
+      Object stress_index = list.get(3);
+      pigeonResult.setStress_index((Double) stress_index);
+      Object breathing_rate_bpm = list.get(4);
+      pigeonResult.setBreathing_rate_bpm((Double) breathing_rate_bpm);
+      Object systolic_blood_pressure_mmhg = list.get(5);
+      pigeonResult.setSystolic_blood_pressure_mmhg((Double) systolic_blood_pressure_mmhg);
+      Object diastolic_blood_pressure_mmhg = list.get(6);
+      pigeonResult.setDiastolic_blood_pressure_mmhg((Double) diastolic_blood_pressure_mmhg);
+      Object heartbeats = list.get(7);
+      pigeonResult.setHeartbeats((heartbeats == null) ? null : Heartbeats.fromList((ArrayList<Object>) heartbeats));
+      Object average_signal_quality = list.get(8);
+      pigeonResult.setAverage_signal_quality((Double) average_signal_quality);
       return pigeonResult;
     }
   }
 
   /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class CustomMeasurementConfig {
-    private @Nullable Double durationSeconds;
+  public static final class InitializationSettings {
+    private @Nullable PrecisionMode precisionMode;
 
-    public @Nullable Double getDurationSeconds() {
-      return durationSeconds;
+    public @Nullable PrecisionMode getPrecisionMode() {
+      return precisionMode;
     }
 
-    public void setDurationSeconds(@Nullable Double setterArg) {
-      this.durationSeconds = setterArg;
+    public void setPrecisionMode(@Nullable PrecisionMode setterArg) {
+      this.precisionMode = setterArg;
     }
 
-    private @Nullable Boolean infiniteMeasurement;
+    private @Nullable OperatingMode operatingMode;
 
-    public @Nullable Boolean getInfiniteMeasurement() {
-      return infiniteMeasurement;
+    public @Nullable OperatingMode getOperatingMode() {
+      return operatingMode;
     }
 
-    public void setInfiniteMeasurement(@Nullable Boolean setterArg) {
-      this.infiniteMeasurement = setterArg;
+    public void setOperatingMode(@Nullable OperatingMode setterArg) {
+      this.operatingMode = setterArg;
     }
 
-    private @Nullable Boolean showHeartRate;
+    private @Nullable MeasurementPreset measurementPreset;
 
-    public @Nullable Boolean getShowHeartRate() {
-      return showHeartRate;
+    public @Nullable MeasurementPreset getMeasurementPreset() {
+      return measurementPreset;
     }
 
-    public void setShowHeartRate(@Nullable Boolean setterArg) {
-      this.showHeartRate = setterArg;
+    public void setMeasurementPreset(@Nullable MeasurementPreset setterArg) {
+      this.measurementPreset = setterArg;
     }
 
-    private @Nullable Boolean showHrvSdnn;
+    private @Nullable CameraMode cameraMode;
 
-    public @Nullable Boolean getShowHrvSdnn() {
-      return showHrvSdnn;
+    public @Nullable CameraMode getCameraMode() {
+      return cameraMode;
     }
 
-    public void setShowHrvSdnn(@Nullable Boolean setterArg) {
-      this.showHrvSdnn = setterArg;
+    public void setCameraMode(@Nullable CameraMode setterArg) {
+      this.cameraMode = setterArg;
     }
 
-    private @Nullable Boolean showBreathingRate;
+    private @Nullable OnboardingMode onboardingMode;
 
-    public @Nullable Boolean getShowBreathingRate() {
-      return showBreathingRate;
+    public @Nullable OnboardingMode getOnboardingMode() {
+      return onboardingMode;
     }
 
-    public void setShowBreathingRate(@Nullable Boolean setterArg) {
-      this.showBreathingRate = setterArg;
+    public void setOnboardingMode(@Nullable OnboardingMode setterArg) {
+      this.onboardingMode = setterArg;
     }
 
-    private @Nullable Boolean showSystolicBloodPressure;
+    private @Nullable Boolean showUserInterface;
 
-    public @Nullable Boolean getShowSystolicBloodPressure() {
-      return showSystolicBloodPressure;
+    public @Nullable Boolean getShowUserInterface() {
+      return showUserInterface;
     }
 
-    public void setShowSystolicBloodPressure(@Nullable Boolean setterArg) {
-      this.showSystolicBloodPressure = setterArg;
+    public void setShowUserInterface(@Nullable Boolean setterArg) {
+      this.showUserInterface = setterArg;
     }
 
-    private @Nullable Boolean showDiastolicBloodPressure;
+    private @Nullable Boolean showFacePositioningOverlay;
 
-    public @Nullable Boolean getShowDiastolicBloodPressure() {
-      return showDiastolicBloodPressure;
+    public @Nullable Boolean getShowFacePositioningOverlay() {
+      return showFacePositioningOverlay;
     }
 
-    public void setShowDiastolicBloodPressure(@Nullable Boolean setterArg) {
-      this.showDiastolicBloodPressure = setterArg;
+    public void setShowFacePositioningOverlay(@Nullable Boolean setterArg) {
+      this.showFacePositioningOverlay = setterArg;
     }
 
-    private @Nullable Boolean showCardiacStress;
+    private @Nullable Boolean showVisualWarnings;
 
-    public @Nullable Boolean getShowCardiacStress() {
-      return showCardiacStress;
+    public @Nullable Boolean getShowVisualWarnings() {
+      return showVisualWarnings;
     }
 
-    public void setShowCardiacStress(@Nullable Boolean setterArg) {
-      this.showCardiacStress = setterArg;
+    public void setShowVisualWarnings(@Nullable Boolean setterArg) {
+      this.showVisualWarnings = setterArg;
     }
 
-    private @Nullable Double realtimeHrPeriodSeconds;
+    private @Nullable Boolean enableCameraSwap;
 
-    public @Nullable Double getRealtimeHrPeriodSeconds() {
-      return realtimeHrPeriodSeconds;
+    public @Nullable Boolean getEnableCameraSwap() {
+      return enableCameraSwap;
     }
 
-    public void setRealtimeHrPeriodSeconds(@Nullable Double setterArg) {
-      this.realtimeHrPeriodSeconds = setterArg;
+    public void setEnableCameraSwap(@Nullable Boolean setterArg) {
+      this.enableCameraSwap = setterArg;
     }
 
-    private @Nullable Double realtimeHrvPeriodSeconds;
+    private @Nullable Boolean showFaceMask;
 
-    public @Nullable Double getRealtimeHrvPeriodSeconds() {
-      return realtimeHrvPeriodSeconds;
+    public @Nullable Boolean getShowFaceMask() {
+      return showFaceMask;
     }
 
-    public void setRealtimeHrvPeriodSeconds(@Nullable Double setterArg) {
-      this.realtimeHrvPeriodSeconds = setterArg;
+    public void setShowFaceMask(@Nullable Boolean setterArg) {
+      this.showFaceMask = setterArg;
     }
 
-    private @Nullable Double realtimeCardiacStressPeriodSeconds;
+    private @Nullable Boolean showBloodFlow;
 
-    public @Nullable Double getRealtimeCardiacStressPeriodSeconds() {
-      return realtimeCardiacStressPeriodSeconds;
+    public @Nullable Boolean getShowBloodFlow() {
+      return showBloodFlow;
     }
 
-    public void setRealtimeCardiacStressPeriodSeconds(@Nullable Double setterArg) {
-      this.realtimeCardiacStressPeriodSeconds = setterArg;
+    public void setShowBloodFlow(@Nullable Boolean setterArg) {
+      this.showBloodFlow = setterArg;
     }
 
-    public static final class Builder {
+    private @Nullable Boolean proVersionLock;
 
-      private @Nullable Double durationSeconds;
+    public @Nullable Boolean getProVersionLock() {
+      return proVersionLock;
+    }
 
-      public @NonNull Builder setDurationSeconds(@Nullable Double setterArg) {
-        this.durationSeconds = setterArg;
-        return this;
-      }
+    public void setProVersionLock(@Nullable Boolean setterArg) {
+      this.proVersionLock = setterArg;
+    }
 
-      private @Nullable Boolean infiniteMeasurement;
+    private @Nullable Boolean hideShenaiLogo;
 
-      public @NonNull Builder setInfiniteMeasurement(@Nullable Boolean setterArg) {
-        this.infiniteMeasurement = setterArg;
-        return this;
-      }
+    public @Nullable Boolean getHideShenaiLogo() {
+      return hideShenaiLogo;
+    }
 
-      private @Nullable Boolean showHeartRate;
+    public void setHideShenaiLogo(@Nullable Boolean setterArg) {
+      this.hideShenaiLogo = setterArg;
+    }
 
-      public @NonNull Builder setShowHeartRate(@Nullable Boolean setterArg) {
-        this.showHeartRate = setterArg;
-        return this;
-      }
+    private @Nullable Boolean headless;
 
-      private @Nullable Boolean showHrvSdnn;
+    public @Nullable Boolean getHeadless() {
+      return headless;
+    }
 
-      public @NonNull Builder setShowHrvSdnn(@Nullable Boolean setterArg) {
-        this.showHrvSdnn = setterArg;
-        return this;
-      }
+    public void setHeadless(@Nullable Boolean setterArg) {
+      this.headless = setterArg;
+    }
 
-      private @Nullable Boolean showBreathingRate;
+    private @Nullable QualityTier qualityFloor;
 
-      public @NonNull Builder setShowBreathingRate(@Nullable Boolean setterArg) {
-        this.showBreathingRate = setterArg;
-        return this;
-      }
+    public @Nullable QualityTier getQualityFloor() {
+      return qualityFloor;
+    }
 
-      private @Nullable Boolean showSystolicBloodPressure;
+    public void setQualityFloor(@Nullable QualityTier setterArg) {
+      this.qualityFloor = setterArg;
+    }
 
-      public @NonNull Builder setShowSystolicBloodPressure(@Nullable Boolean setterArg) {
-        this.showSystolicBloodPressure = setterArg;
+    public static final class Builder {
+
+      private @Nullable PrecisionMode precisionMode;
+
+      public @NonNull Builder setPrecisionMode(@Nullable PrecisionMode setterArg) {
+        this.precisionMode = setterArg;
         return this;
       }
 
-      private @Nullable Boolean showDiastolicBloodPressure;
+      private @Nullable OperatingMode operatingMode;
 
-      public @NonNull Builder setShowDiastolicBloodPressure(@Nullable Boolean setterArg) {
-        this.showDiastolicBloodPressure = setterArg;
+      public @NonNull Builder setOperatingMode(@Nullable OperatingMode setterArg) {
+        this.operatingMode = setterArg;
         return this;
       }
 
-      private @Nullable Boolean showCardiacStress;
+      private @Nullable MeasurementPreset measurementPreset;
 
-      public @NonNull Builder setShowCardiacStress(@Nullable Boolean setterArg) {
-        this.showCardiacStress = setterArg;
+      public @NonNull Builder setMeasurementPreset(@Nullable MeasurementPreset setterArg) {
+        this.measurementPreset = setterArg;
         return this;
       }
 
-      private @Nullable Double realtimeHrPeriodSeconds;
+      private @Nullable CameraMode cameraMode;
 
-      public @NonNull Builder setRealtimeHrPeriodSeconds(@Nullable Double setterArg) {
-        this.realtimeHrPeriodSeconds = setterArg;
+      public @NonNull Builder setCameraMode(@Nullable CameraMode setterArg) {
+        this.cameraMode = setterArg;
         return this;
       }
 
-      private @Nullable Double realtimeHrvPeriodSeconds;
+      private @Nullable OnboardingMode onboardingMode;
 
-      public @NonNull Builder setRealtimeHrvPeriodSeconds(@Nullable Double setterArg) {
-        this.realtimeHrvPeriodSeconds = setterArg;
+      public @NonNull Builder setOnboardingMode(@Nullable OnboardingMode setterArg) {
+        this.onboardingMode = setterArg;
         return this;
       }
 
-      private @Nullable Double realtimeCardiacStressPeriodSeconds;
+      private @Nullable Boolean showUserInterface;
 
-      public @NonNull Builder setRealtimeCardiacStressPeriodSeconds(@Nullable Double setterArg) {
-        this.realtimeCardiacStressPeriodSeconds = setterArg;
+      public @NonNull Builder setShowUserInterface(@Nullable Boolean setterArg) {
+        this.showUserInterface = setterArg;
         return this;
       }
 
-      public @NonNull CustomMeasurementConfig build() {
-        CustomMeasurementConfig pigeonReturn = new CustomMeasurementConfig();
-        pigeonReturn.setDurationSeconds(durationSeconds);
-        pigeonReturn.setInfiniteMeasurement(infiniteMeasurement);
-        pigeonReturn.setShowHeartRate(showHeartRate);
-        pigeonReturn.setShowHrvSdnn(showHrvSdnn);
-        pigeonReturn.setShowBreathingRate(showBreathingRate);
-        pigeonReturn.setShowSystolicBloodPressure(showSystolicBloodPressure);
-        pigeonReturn.setShowDiastolicBloodPressure(showDiastolicBloodPressure);
-        pigeonReturn.setShowCardiacStress(showCardiacStress);
-        pigeonReturn.setRealtimeHrPeriodSeconds(realtimeHrPeriodSeconds);
-        pigeonReturn.setRealtimeHrvPeriodSeconds(realtimeHrvPeriodSeconds);
-        pigeonReturn.setRealtimeCardiacStressPeriodSeconds(realtimeCardiacStressPeriodSeconds);
-        return pigeonReturn;
-      }
-    }
-
-    @NonNull
-    ArrayList<Object> toList() {
-      ArrayList<Object> toListResult = new ArrayList<Object>(11);
-      toListResult.add(durationSeconds);
-      toListResult.add(infiniteMeasurement);
-      toListResult.add(showHeartRate);
-      toListResult.add(showHrvSdnn);
-      toListResult.add(showBreathingRate);
-      toListResult.add(showSystolicBloodPressure);
-      toListResult.add(showDiastolicBloodPressure);
-      toListResult.add(showCardiacStress);
-      toListResult.add(realtimeHrPeriodSeconds);
-      toListResult.add(realtimeHrvPeriodSeconds);
-      toListResult.add(realtimeCardiacStressPeriodSeconds);
-      return toListResult;
-    }
-
-    static @NonNull CustomMeasurementConfig fromList(@NonNull ArrayList<Object> list) {
-      CustomMeasurementConfig pigeonResult = new CustomMeasurementConfig();
-      Object durationSeconds = list.get(0);
-      pigeonResult.setDurationSeconds((Double) durationSeconds);
-      Object infiniteMeasurement = list.get(1);
-      pigeonResult.setInfiniteMeasurement((Boolean) infiniteMeasurement);
-      Object showHeartRate = list.get(2);
-      pigeonResult.setShowHeartRate((Boolean) showHeartRate);
-      Object showHrvSdnn = list.get(3);
-      pigeonResult.setShowHrvSdnn((Boolean) showHrvSdnn);
-      Object showBreathingRate = list.get(4);
-      pigeonResult.setShowBreathingRate((Boolean) showBreathingRate);
-      Object showSystolicBloodPressure = list.get(5);
-      pigeonResult.setShowSystolicBloodPressure((Boolean) showSystolicBloodPressure);
-      Object showDiastolicBloodPressure = list.get(6);
-      pigeonResult.setShowDiastolicBloodPressure((Boolean) showDiastolicBloodPressure);
-      Object showCardiacStress = list.get(7);
-      pigeonResult.setShowCardiacStress((Boolean) showCardiacStress);
-      Object realtimeHrPeriodSeconds = list.get(8);
-      pigeonResult.setRealtimeHrPeriodSeconds((Double) realtimeHrPeriodSeconds);
-      Object realtimeHrvPeriodSeconds = list.get(9);
-      pigeonResult.setRealtimeHrvPeriodSeconds((Double) realtimeHrvPeriodSeconds);
-      Object realtimeCardiacStressPeriodSeconds = list.get(10);
-      pigeonResult.setRealtimeCardiacStressPeriodSeconds((Double) realtimeCardiacStressPeriodSeconds);
-      return pigeonResult;
-    }
-  }
-
-  /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class CustomColorTheme {
-    private @Nullable String themeColor;
-
-    public @Nullable String getThemeColor() {
-      return themeColor;
-    }
-
-    public void setThemeColor(@Nullable String setterArg) {
-      this.themeColor = setterArg;
-    }
-
-    private @Nullable String textColor;
+      private @Nullable Boolean showFacePositioningOverlay;
 
-    public @Nullable String getTextColor() {
-      return textColor;
-    }
+      public @NonNull Builder setShowFacePositioningOverlay(@Nullable Boolean setterArg) {
+        this.showFacePositioningOverlay = setterArg;
+        return this;
+      }
 
-    public void setTextColor(@Nullable String setterArg) {
-      this.textColor = setterArg;
-    }
+      private @Nullable Boolean showVisualWarnings;
 
-    private @Nullable String backgroundColor;
+      public @NonNull Builder setShowVisualWarnings(@Nullable Boolean setterArg) {
+        this.showVisualWarnings = setterArg;
+        return this;
+      }
 
-    public @Nullable String getBackgroundColor() {
-      return backgroundColor;
-    }
+      private @Nullable Boolean enableCameraSwap;
 
-    public void setBackgroundColor(@Nullable String setterArg) {
-      this.backgroundColor = setterArg;
-    }
+      public @NonNull Builder setEnableCameraSwap(@Nullable Boolean setterArg) {
+        this.enableCameraSwap = setterArg;
+        return this;
+      }
 
-    private @Nullable String tileColor;
+      private @Nullable Boolean showFaceMask;
 
-    public @Nullable String getTileColor() {
-      return tileColor;
-    }
+      public @NonNull Builder setShowFaceMask(@Nullable Boolean setterArg) {
+        this.showFaceMask = setterArg;
+        return this;
+      }
 
-    public void setTileColor(@Nullable String setterArg) {
-      this.tileColor = setterArg;
-    }
+      private @Nullable Boolean showBloodFlow;
 
-    public static final class Builder {
+      public @NonNull Builder setShowBloodFlow(@Nullable Boolean setterArg) {
+        this.showBloodFlow = setterArg;
+        return this;
+      }
 
-      private @Nullable String themeColor;
+      private @Nullable Boolean proVersionLock;
 
-      public @NonNull Builder setThemeColor(@Nullable String setterArg) {
-        this.themeColor = setterArg;
+      public @NonNull Builder setProVersionLock(@Nullable Boolean setterArg) {
+        this.proVersionLock = setterArg;
         return this;
       }
 
-      private @Nullable String textColor;
+      private @Nullable Boolean hideShenaiLogo;
 
-      public @NonNull Builder setTextColor(@Nullable String setterArg) {
-        this.textColor = setterArg;
+      public @NonNull Builder setHideShenaiLogo(@Nullable Boolean setterArg) {
+        this.hideShenaiLogo = setterArg;
         return this;
       }
 
-      private @Nullable String backgroundColor;
+      private @Nullable Boolean headless;
 
-      public @NonNull Builder setBackgroundColor(@Nullable String setterArg) {
-        this.backgroundColor = setterArg;
+      public @NonNull Builder setHeadless(@Nullable Boolean setterArg) {
+        this.headless = setterArg;
         return this;
       }
 
-      private @Nullable String tileColor;
+      private @Nullable QualityTier qualityFloor;
 
-      public @NonNull Builder setTileColor(@Nullable String setterArg) {
-        this.tileColor = setterArg;
+      public @NonNull Builder setQualityFloor(@Nullable QualityTier setterArg) {
+        this.qualityFloor = setterArg;
         return this;
       }
 
-      public @NonNull CustomColorTheme build() {
-        CustomColorTheme pigeonReturn = new CustomColorTheme();
-        pigeonReturn.setThemeColor(themeColor);
-        pigeonReturn.setTextColor(textColor);
-        pigeonReturn.setBackgroundColor(backgroundColor);
-        pigeonReturn.setTileColor(tileColor);
+      public @NonNull InitializationSettings build() {
+        InitializationSettings pigeonReturn = new InitializationSettings();
+        pigeonReturn.setPrecisionMode(precisionMode);
+        pigeonReturn.setOperatingMode(operatingMode);
+        pigeonReturn.setMeasurementPreset(measurementPreset);
+        pigeonReturn.setCameraMode(cameraMode);
+        pigeonReturn.setOnboardingMode(onboardingMode);
+        pigeonReturn.setShowUserInterface(showUserInterface);
+        pigeonReturn.setShowFacePositioningOverlay(showFacePositioningOverlay);
+        pigeonReturn.setShowVisualWarnings(showVisualWarnings);
+        pigeonReturn.setEnableCameraSwap(enableCameraSwap);
+        pigeonReturn.setShowFaceMask(showFaceMask);
+        pigeonReturn.setShowBloodFlow(showBloodFlow);
+        pigeonReturn.setProVersionLock(proVersionLock);
+        pigeonReturn.setHideShenaiLogo(hideShenaiLogo);
+        pigeonReturn.setHeadless(headless);
+        pigeonReturn.setQualityFloor(qualityFloor);
         return pigeonReturn;
       }
     }
 
     @NonNull
     ArrayList<Object> toList() {
-      ArrayList<Object> toListResult = new ArrayList<Object>(4);
-      toListResult.add(themeColor);
-      toListResult.add(textColor);
-      toListResult.add(backgroundColor);
-      toListResult.add(tileColor);
+      ArrayList<Object> toListResult = new ArrayList<Object>(15);
+      toListResult.add(precisionMode == null ? null : precisionMode.index);
+      toListResult.add(operatingMode == null ? null : operatingMode.index);
+      toListResult.add(measurementPreset == null ? null : measurementPreset.index);
+      toListResult.add(cameraMode == null ? null : cameraMode.index);
+      toListResult.add(onboardingMode == null ? null : onboardingMode.index);
+      toListResult.add(showUserInterface);
+      toListResult.add(showFacePositioningOverlay);
+      toListResult.add(showVisualWarnings);
+      toListResult.add(enableCameraSwap);
+      toListResult.add(showFaceMask);
+      toListResult.add(showBloodFlow);
+      toListResult.add(proVersionLock);
+      toListResult.add(hideShenaiLogo);
+      toListResult.add(headless);
+      toListResult.add(qualityFloor == null ? null : qualityFloor.index);
       return toListResult;
     }
 
-    static @NonNull CustomColorTheme fromList(@NonNull ArrayList<Object> list) {
-      CustomColorTheme pigeonResult = new CustomColorTheme();
-      Object themeColor = list.get(0);
-      pigeonResult.setThemeColor((String) themeColor);
-      Object textColor = list.get(1);
-      pigeonResult.setTextColor((String) textColor);
-      Object backgroundColor = list.get(2);
-      pigeonResult.setBackgroundColor((String) backgroundColor);
-      Object tileColor = list.get(3);
-      pigeonResult.setTileColor((String) tileColor);
+    static @NonNull InitializationSettings fromList(@NonNull ArrayList<Object> list) {
+      InitializationSettings pigeonResult = new InitializationSettings();
+      Object precisionMode = list.get(0);
+      pigeonResult.setPrecisionMode(precisionMode == null ? null : PrecisionMode.values()[(int) precisionMode]);
+      Object operatingMode = list.get(1);
+      pigeonResult.setOperatingMode(operatingMode == null ? null : OperatingMode.values()[(int) operatingMode]);
+      Object measurementPreset = list.get(2);
+      pigeonResult.setMeasurementPreset(measurementPreset == null ? null : MeasurementPreset.values()[(int) measurementPreset]);
+      Object cameraMode = list.get(3);
+      pigeonResult.setCameraMode(cameraMode == null ? null : CameraMode.values()[(int) cameraMode]);
+      Object onboardingMode = list.get(4);
+      pigeonResult.setOnboardingMode(onboardingMode == null ? null : OnboardingMode.values()[(int) onboardingMode]);
+      Object showUserInterface = list.get(5);
+      pigeonResult.setShowUserInterface((Boolean) showUserInterface);
+      Object showFacePositioningOverlay = list.get(6);
+      pigeonResult.setShowFacePositioningOverlay((Boolean) showFacePositioningOverlay);
+      Object showVisualWarnings = list.get(7);
+      pigeonResult.setShowVisualWarnings((Boolean) showVisualWarnings);
+      Object enableCameraSwap = list.get(8);
+      pigeonResult.setEnableCameraSwap((Boolean) enableCameraSwap);
+      Object showFaceMask = list.get(9);
+      pigeonResult.setShowFaceMask((Boolean) showFaceMask);
+      Object showBloodFlow = list.get(10);
+      pigeonResult.setShowBloodFlow((Boolean) showBloodFlow);
+      Object proVersionLock = list.get(11);
+      pigeonResult.setProVersionLock((Boolean) proVersionLock);
+      Object hideShenaiLogo = list.get(12);
+      pigeonResult.setHideShenaiLogo((Boolean) hideShenaiLogo);
+      Object headless = list.get(13);
+      pigeonResult.setHeadless((Boolean) headless);
+      Object qualityFloor = list.get(14);
+      pigeonResult.setQualityFloor(qualityFloor == null ? null : QualityTier.values()[(int) qualityFloor]);
       return pigeonResult;
     }
   }
 
   /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class RisksFactors {
-    private @Nullable Long age;
+  public static final class CustomMeasurementConfig {
+    private @Nullable Double durationSeconds;
 
-    public @Nullable Long getAge() {
-      return age;
+    public @Nullable Double getDurationSeconds() {
+      return durationSeconds;
     }
 
-    public void setAge(@Nullable Long setterArg) {
-      this.age = setterArg;
+    public void setDurationSeconds(@Nullable Double setterArg) {
+      this.durationSeconds = setterArg;
     }
 
-    private @Nullable Double cholesterol;
+    private @Nullable Boolean infiniteMeasurement;
 
-    public @Nullable Double getCholesterol() {
-      return cholesterol;
-    }
-
-    public void setCholesterol(@Nullable Double setterArg) {
-      this.cholesterol = setterArg;
-    }
-
-    private @Nullable Double cholesterolHdl;
-
-    public @Nullable Double getCholesterolHdl() {
-      return cholesterolHdl;
+    public @Nullable Boolean getInfiniteMeasurement() {
+      return infiniteMeasurement;
     }
 
-    public void setCholesterolHdl(@Nullable Double setterArg) {
-      this.cholesterolHdl = setterArg;
+    public void setInfiniteMeasurement(@Nullable Boolean setterArg) {
+      this.infiniteMeasurement = setterArg;
     }
 
-    private @Nullable Double sbp;
+    private @Nullable Boolean showHeartRate;
 
-    public @Nullable Double getSbp() {
-      return sbp;
+    public @Nullable Boolean getShowHeartRate() {
+      return showHeartRate;
     }
 
-    public void setSbp(@Nullable Double setterArg) {
-      this.sbp = setterArg;
+    public void setShowHeartRate(@Nullable Boolean setterArg) {
+      this.showHeartRate = setterArg;
     }
 
-    private @Nullable Boolean isSmoker;
+    private @Nullable Boolean showHrvSdnn;
 
-    public @Nullable Boolean getIsSmoker() {
-      return isSmoker;
+    public @Nullable Boolean getShowHrvSdnn() {
+      return showHrvSdnn;
     }
 
-    public void setIsSmoker(@Nullable Boolean setterArg) {
-      this.isSmoker = setterArg;
+    public void setShowHrvSdnn(@Nullable Boolean setterArg) {
+      this.showHrvSdnn = setterArg;
     }
 
-    private @Nullable Boolean hypertensionTreatment;
+    private @Nullable Boolean showBreathingRate;
 
-    public @Nullable Boolean getHypertensionTreatment() {
-      return hypertensionTreatment;
+    public @Nullable Boolean getShowBreathingRate() {
+      return showBreathingRate;
     }
 
-    public void setHypertensionTreatment(@Nullable Boolean setterArg) {
-      this.hypertensionTreatment = setterArg;
+    public void setShowBreathingRate(@Nullable Boolean setterArg) {
+      this.showBreathingRate = setterArg;
     }
 
-    private @Nullable Boolean hasDiabetes;
+    private @Nullable Boolean showSystolicBloodPressure;
 
-    public @Nullable Boolean getHasDiabetes() {
-      return hasDiabetes;
+    public @Nullable Boolean getShowSystolicBloodPressure() {
+      return showSystolicBloodPressure;
     }
 
-    public void setHasDiabetes(@Nullable Boolean setterArg) {
-      this.hasDiabetes = setterArg;
+    public void setShowSystolicBloodPressure(@Nullable Boolean setterArg) {
+      this.showSystolicBloodPressure = setterArg;
     }
 
-    private @Nullable Double bodyHeight;
+    private @Nullable Boolean showDiastolicBloodPressure;
 
-    public @Nullable Double getBodyHeight() {
-      return bodyHeight;
+    public @Nullable Boolean getShowDiastolicBloodPressure() {
+      return showDiastolicBloodPressure;
     }
 
-    public void setBodyHeight(@Nullable Double setterArg) {
-      this.bodyHeight = setterArg;
+    public void setShowDiastolicBloodPressure(@Nullable Boolean setterArg) {
+      this.showDiastolicBloodPressure = setterArg;
     }
 
-    private @Nullable Double bodyWeight;
+    private @Nullable Boolean showCardiacStress;
 
-    public @Nullable Double getBodyWeight() {
-      return bodyWeight;
+    public @Nullable Boolean getShowCardiacStress() {
+      return showCardiacStress;
     }
 
-    public void setBodyWeight(@Nullable Double setterArg) {
-      this.bodyWeight = setterArg;
+    public void setShowCardiacStress(@Nullable Boolean setterArg) {
+      this.showCardiacStress = setterArg;
     }
 
-    private @Nullable Gender gender;
+    private @Nullable Double realtimeHrPeriodSeconds;
 
-    public @Nullable Gender getGender() {
-      return gender;
+    public @Nullable Double getRealtimeHrPeriodSeconds() {
+      return realtimeHrPeriodSeconds;
     }
 
-    public void setGender(@Nullable Gender setterArg) {
-      this.gender = setterArg;
+    public void setRealtimeHrPeriodSeconds(@Nullable Double setterArg) {
+      this.realtimeHrPeriodSeconds = setterArg;
     }
 
-    private @Nullable String country;
+    private @Nullable Double realtimeHrvPeriodSeconds;
 
-    public @Nullable String getCountry() {
-      return country;
+    public @Nullable Double getRealtimeHrvPeriodSeconds() {
+      return realtimeHrvPeriodSeconds;
     }
 
-    public void setCountry(@Nullable String setterArg) {
-      this.country = setterArg;
+    public void setRealtimeHrvPeriodSeconds(@Nullable Double setterArg) {
+      this.realtimeHrvPeriodSeconds = setterArg;
     }
 
-    private @Nullable Race race;
+    private @Nullable Double realtimeCardiacStressPeriodSeconds;
 
-    public @Nullable Race getRace() {
-      return race;
+    public @Nullable Double getRealtimeCardiacStressPeriodSeconds() {
+      return realtimeCardiacStressPeriodSeconds;
     }
 
-    public void setRace(@Nullable Race setterArg) {
-      this.race = setterArg;
+    public void setRealtimeCardiacStressPeriodSeconds(@Nullable Double setterArg) {
+      this.realtimeCardiacStressPeriodSeconds = setterArg;
     }
 
     public static final class Builder {
 
-      private @Nullable Long age;
-
-      public @NonNull Builder setAge(@Nullable Long setterArg) {
-        this.age = setterArg;
-        return this;
-      }
-
-      private @Nullable Double cholesterol;
+      private @Nullable Double durationSeconds;
 
-      public @NonNull Builder setCholesterol(@Nullable Double setterArg) {
-        this.cholesterol = setterArg;
+      public @NonNull Builder setDurationSeconds(@Nullable Double setterArg) {
+        this.durationSeconds = setterArg;
         return this;
       }
 
-      private @Nullable Double cholesterolHdl;
+      private @Nullable Boolean infiniteMeasurement;
 
-      public @NonNull Builder setCholesterolHdl(@Nullable Double setterArg) {
-        this.cholesterolHdl = setterArg;
+      public @NonNull Builder setInfiniteMeasurement(@Nullable Boolean setterArg) {
+        this.infiniteMeasurement = setterArg;
         return this;
       }
 
-      private @Nullable Double sbp;
+      private @Nullable Boolean showHeartRate;
 
-      public @NonNull Builder setSbp(@Nullable Double setterArg) {
-        this.sbp = setterArg;
+      public @NonNull Builder setShowHeartRate(@Nullable Boolean setterArg) {
+        this.showHeartRate = setterArg;
         return this;
       }
 
-      private @Nullable Boolean isSmoker;
+      private @Nullable Boolean showHrvSdnn;
 
-      public @NonNull Builder setIsSmoker(@Nullable Boolean setterArg) {
-        this.isSmoker = setterArg;
+      public @NonNull Builder setShowHrvSdnn(@Nullable Boolean setterArg) {
+        this.showHrvSdnn = setterArg;
         return this;
       }
 
-      private @Nullable Boolean hypertensionTreatment;
+      private @Nullable Boolean showBreathingRate;
 
-      public @NonNull Builder setHypertensionTreatment(@Nullable Boolean setterArg) {
-        this.hypertensionTreatment = setterArg;
+      public @NonNull Builder setShowBreathingRate(@Nullable Boolean setterArg) {
+        this.showBreathingRate = setterArg;
         return this;
       }
 
-      private @Nullable Boolean hasDiabetes;
+      private @Nullable Boolean showSystolicBloodPressure;
 
-      public @NonNull Builder setHasDiabetes(@Nullable Boolean setterArg) {
-        this.hasDiabetes = setterArg;
+      public @NonNull Builder setShowSystolicBloodPressure(@Nullable Boolean setterArg) {
+        this.showSystolicBloodPressure = setterArg;
         return this;
       }
 
-      private @Nullable Double bodyHeight;
+      private @Nullable Boolean showDiastolicBloodPressure;
 
-      public @NonNull Builder setBodyHeight(@Nullable Double setterArg) {
-        this.bodyHeight = setterArg;
+      public @NonNull Builder setShowDiastolicBloodPressure(@Nullable Boolean setterArg) {
+        this.showDiastolicBloodPressure = setterArg;
         return this;
       }
 
-      private @Nullable Double bodyWeight;
+      private @Nullable Boolean showCardiacStress;
 
-      public @NonNull Builder setBodyWeight(@Nullable Double setterArg) {
-        this.bodyWeight = setterArg;
+      public @NonNull Builder setShowCardiacStress(@Nullable Boolean setterArg) {
+        this.showCardiacStress = setterArg;
         return this;
       }
 
-      private @Nullable Gender gender;
+      private @Nullable Double realtimeHrPeriodSeconds;
 
-      public @NonNull Builder setGender(@Nullable Gender setterArg) {
-        this.gender = setterArg;
+      public @NonNull Builder setRealtimeHrPeriodSeconds(@Nullable Double setterArg) {
+        this.realtimeHrPeriodSeconds = setterArg;
         return this;
       }
 
-      private @Nullable String country;
+      private @Nullable Double realtimeHrvPeriodSeconds;
 
-      public @NonNull Builder setCountry(@Nullable String setterArg) {
-        this.country = setterArg;
+      public @NonNull Builder setRealtimeHrvPeriodSeconds(@Nullable Double setterArg) {
+        this.realtimeHrvPeriodSeconds = setterArg;
         return this;
       }
 
-      private @Nullable Race race;
+      private @Nullable Double realtimeCardiacStressPeriodSeconds;
 
-      public @NonNull Builder setRace(@Nullable Race setterArg) {
-        this.race = setterArg;
+      public @NonNull Builder setRealtimeCardiacStressPeriodSeconds(@Nullable Double setterArg) {
+        this.realtimeCardiacStressPeriodSeconds = setterArg;
         return this;
       }
 
-      public @NonNull RisksFactors build() {
-        RisksFactors pigeonReturn = new RisksFactors();
-        pigeonReturn.setAge(age);
-        pigeonReturn.setCholesterol(cholesterol);
-        pigeonReturn.setCholesterolHdl(cholesterolHdl);
-        pigeonReturn.setSbp(sbp);
-        pigeonReturn.setIsSmoker(isSmoker);
-        pigeonReturn.setHypertensionTreatment(hypertensionTreatment);
-        pigeonReturn.setHasDiabetes(hasDiabetes);
-        pigeonReturn.setBodyHeight(bodyHeight);
-        pigeonReturn.setBodyWeight(bodyWeight);
-        pigeonReturn.setGender(gender);
-        pigeonReturn.setCountry(country);
-        pigeonReturn.setRace(race);
+      public @NonNull CustomMeasurementConfig build() {
+        CustomMeasurementConfig pigeonReturn = new CustomMeasurementConfig();
+        pigeonReturn.setDurationSeconds(durationSeconds);
+        pigeonReturn.setInfiniteMeasurement(infiniteMeasurement);
+        pigeonReturn.setShowHeartRate(showHeartRate);
+        pigeonReturn.setShowHrvSdnn(showHrvSdnn);
+        pigeonReturn.setShowBreathingRate(showBreathingRate);
+        pigeonReturn.setShowSystolicBloodPressure(showSystolicBloodPressure);
+        pigeonReturn.setShowDiastolicBloodPressure(showDiastolicBloodPressure);
+        pigeonReturn.setShowCardiacStress(showCardiacStress);
+        pigeonReturn.setRealtimeHrPeriodSeconds(realtimeHrPeriodSeconds);
+        pigeonReturn.setRealtimeHrvPeriodSeconds(realtimeHrvPeriodSeconds);
+        pigeonReturn.setRealtimeCardiacStressPeriodSeconds(realtimeCardiacStressPeriodSeconds);
         return pigeonReturn;
       }
     }
 
     @NonNull
     ArrayList<Object> toList() {
-      ArrayList<Object> toListResult = new ArrayList<Object>(12);
-      toListResult.add(age);
-      toListResult.add(cholesterol);
-      toListResult.add(cholesterolHdl);
-      toListResult.add(sbp);
-      toListResult.add(isSmoker);
-      toListResult.add(hypertensionTreatment);
-      toListResult.add(hasDiabetes);
-      toListResult.add(bodyHeight);
-      toListResult.add(bodyWeight);
-      toListResult.add(gender == null ? null : gender.index);
-      toListResult.add(country);
-      toListResult.add(race == null ? null : race.index);
+      ArrayList<Object> toListResult = new ArrayList<Object>(11);
+      toListResult.add(durationSeconds);
+      toListResult.add(infiniteMeasurement);
+      toListResult.add(showHeartRate);
+      toListResult.add(showHrvSdnn);
+      toListResult.add(showBreathingRate);
+      toListResult.add(showSystolicBloodPressure);
+      toListResult.add(showDiastolicBloodPressure);
+      toListResult.add(showCardiacStress);
+      toListResult.add(realtimeHrPeriodSeconds);
+      toListResult.add(realtimeHrvPeriodSeconds);
+      toListResult.add(realtimeCardiacStressPeriodSeconds);
       return toListResult;
     }
 
-    static @NonNull RisksFactors fromList(@NonNull ArrayList<Object> list) {
-      RisksFactors pigeonResult = new RisksFactors();
-      Object age = list.get(0);
-      pigeonResult.setAge((age == null) ? null : ((age instanceof Integer) ? (Integer) age : (Long) age));
-      Object cholesterol = list.get(1);
-      pigeonResult.setCholesterol((Double) cholesterol);
-      Object cholesterolHdl = list.get(2);
-      pigeonResult.setCholesterolHdl((Double) cholesterolHdl);
-      Object sbp = list.get(3);
-      pigeonResult.setSbp((Double) sbp);
-      Object isSmoker = list.get(4);
-      pigeonResult.setIsSmoker((Boolean) isSmoker);
-      Object hypertensionTreatment = list.get(5);
-      pigeonResult.setHypertensionTreatment((Boolean) hypertensionTreatment);
-      Object hasDiabetes = list.get(6);
-      pigeonResult.setHasDiabetes((Boolean) hasDiabetes);
-      Object bodyHeight = list.get(7);
-      pigeonResult.setBodyHeight((Double) bodyHeight);
-      Object bodyWeight = list.get(8);
-      pigeonResult.setBodyWeight((Double) bodyWeight);
-      Object gender = list.get(9);
-      pigeonResult.setGender(gender == null ? null : Gender.values()[(int) gender]);
-      Object country = list.get(10);
-      pigeonResult.setCountry((String) country);
-      Object race = list.get(11);
-      pigeonResult.setRace(race == null ? null : Race.values()[(int) race]);
+    static @NonNull CustomMeasurementConfig fromList(@NonNull ArrayList<Object> list) {
+      CustomMeasurementConfig pigeonResult = new CustomMeasurementConfig();
+      Object durationSeconds = list.get(0);
+      pigeonResult.setDurationSeconds((Double) durationSeconds);
+      Object infiniteMeasurement = list.get(1);
+      pigeonResult.setInfiniteMeasurement((Boolean) infiniteMeasurement);
+      Object showHeartRate = list.get(2);
+      pigeonResult.setShowHeartRate((Boolean) showHeartRate);
+      Object showHrvSdnn = list.get(3);
+      pigeonResult.setShowHrvSdnn((Boolean) showHrvSdnn);
+      Object showBreathingRate = list.get(4);
+      pigeonResult.setShowBreathingRate((Boolean) showBreathingRate);
+      Object showSystolicBloodPressure = list.get(5);
+      pigeonResult.setShowSystolicBloodPressure((Boolean) showSystolicBloodPressure);
+      Object showDiastolicBloodPressure = list.get(6);
+      pigeonResult.setShowDiastolicBloodPressure((Boolean) showDiastolicBloodPressure);
+      Object showCardiacStress = list.get(7);
+      pigeonResult.setShowCardiacStress((Boolean) showCardiacStress);
+      Object realtimeHrPeriodSeconds = list.get(8);
+      pigeonResult.setRealtimeHrPeriodSeconds((Double) realtimeHrPeriodSeconds);
+      Object realtimeHrvPeriodSeconds = list.get(9);
+      pigeonResult.setRealtimeHrvPeriodSeconds((Double) realtimeHrvPeriodSeconds);
+      Object realtimeCardiacStressPeriodSeconds = list.get(10);
+      pigeonResult.setRealtimeCardiacStressPeriodSeconds((Double) realtimeCardiacStressPeriodSeconds);
       return pigeonResult;
     }
   }
 
   /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class HardAndFatalEventsRisks {
-    private @Nullable Double coronaryDeathEventRisk;
+  public static final class CustomColorTheme {
+    private @Nullable String themeColor;
 
-    public @Nullable Double getCoronaryDeathEventRisk() {
-      return coronaryDeathEventRisk;
+    public @Nullable String getThemeColor() {
+      return themeColor;
     }
 
-    public void setCoronaryDeathEventRisk(@Nullable Double setterArg) {
-      this.coronaryDeathEventRisk = setterArg;
+    public void setThemeColor(@Nullable String setterArg) {
+      this.themeColor = setterArg;
     }
 
-    private @Nullable Double fatalStrokeEventRisk;
+    private @Nullable String textColor;
 
-    public @Nullable Double getFatalStrokeEventRisk() {
-      return fatalStrokeEventRisk;
+    public @Nullable String getTextColor() {
+      return textColor;
     }
 
-    public void setFatalStrokeEventRisk(@Nullable Double setterArg) {
-      this.fatalStrokeEventRisk = setterArg;
+    public void setTextColor(@Nullable String setterArg) {
+      this.textColor = setterArg;
     }
 
-    private @Nullable Double totalCVMortalityRisk;
+    private @Nullable String backgroundColor;
 
-    public @Nullable Double getTotalCVMortalityRisk() {
-      return totalCVMortalityRisk;
+    public @Nullable String getBackgroundColor() {
+      return backgroundColor;
     }
 
-    public void setTotalCVMortalityRisk(@Nullable Double setterArg) {
-      this.totalCVMortalityRisk = setterArg;
+    public void setBackgroundColor(@Nullable String setterArg) {
+      this.backgroundColor = setterArg;
     }
 
-    private @Nullable Double hardCVEventRisk;
+    private @Nullable String tileColor;
 
-    public @Nullable Double getHardCVEventRisk() {
-      return hardCVEventRisk;
+    public @Nullable String getTileColor() {
+      return tileColor;
     }
 
-    public void setHardCVEventRisk(@Nullable Double setterArg) {
-      this.hardCVEventRisk = setterArg;
+    public void setTileColor(@Nullable String setterArg) {
+      this.tileColor = setterArg;
     }
 
     public static final class Builder {
 
-      private @Nullable Double coronaryDeathEventRisk;
+      private @Nullable String themeColor;
 
-      public @NonNull Builder setCoronaryDeathEventRisk(@Nullable Double setterArg) {
-        this.coronaryDeathEventRisk = setterArg;
+      public @NonNull Builder setThemeColor(@Nullable String setterArg) {
+        this.themeColor = setterArg;
         return this;
       }
 
-      private @Nullable Double fatalStrokeEventRisk;
+      private @Nullable String textColor;
 
-      public @NonNull Builder setFatalStrokeEventRisk(@Nullable Double setterArg) {
-        this.fatalStrokeEventRisk = setterArg;
+      public @NonNull Builder setTextColor(@Nullable String setterArg) {
+        this.textColor = setterArg;
         return this;
       }
 
-      private @Nullable Double totalCVMortalityRisk;
+      private @Nullable String backgroundColor;
 
-      public @NonNull Builder setTotalCVMortalityRisk(@Nullable Double setterArg) {
-        this.totalCVMortalityRisk = setterArg;
+      public @NonNull Builder setBackgroundColor(@Nullable String setterArg) {
+        this.backgroundColor = setterArg;
         return this;
       }
 
-      private @Nullable Double hardCVEventRisk;
+      private @Nullable String tileColor;
 
-      public @NonNull Builder setHardCVEventRisk(@Nullable Double setterArg) {
-        this.hardCVEventRisk = setterArg;
+      public @NonNull Builder setTileColor(@Nullable String setterArg) {
+        this.tileColor = setterArg;
         return this;
       }
 
-      public @NonNull HardAndFatalEventsRisks build() {
-        HardAndFatalEventsRisks pigeonReturn = new HardAndFatalEventsRisks();
-        pigeonReturn.setCoronaryDeathEventRisk(coronaryDeathEventRisk);
-        pigeonReturn.setFatalStrokeEventRisk(fatalStrokeEventRisk);
-        pigeonReturn.setTotalCVMortalityRisk(totalCVMortalityRisk);
-        pigeonReturn.setHardCVEventRisk(hardCVEventRisk);
+      public @NonNull CustomColorTheme build() {
+        CustomColorTheme pigeonReturn = new CustomColorTheme();
+        pigeonReturn.setThemeColor(themeColor);
+        pigeonReturn.setTextColor(textColor);
+        pigeonReturn.setBackgroundColor(backgroundColor);
+        pigeonReturn.setTileColor(tileColor);
         return pigeonReturn;
       }
     }
@@ -1985,434 +2239,379 @@ public class Pigeon {
     @NonNull
     ArrayList<Object> toList() {
       ArrayList<Object> toListResult = new ArrayList<Object>(4);
-      toListResult.add(coronaryDeathEventRisk);
-      toListResult.add(fatalStrokeEventRisk);
-      toListResult.add(totalCVMortalityRisk);
-      toListResult.add(hardCVEventRisk);
+      toListResult.add(themeColor);
+      toListResult.add(textColor);
+      toListResult.add(backgroundColor);
+      toListResult.add(tileColor);
       return toListResult;
     }
 
-    static @NonNull HardAndFatalEventsRisks fromList(@NonNull ArrayList<Object> list) {
-      HardAndFatalEventsRisks pigeonResult = new HardAndFatalEventsRisks();
-      Object coronaryDeathEventRisk = list.get(0);
-      pigeonResult.setCoronaryDeathEventRisk((Double) coronaryDeathEventRisk);
-      Object fatalStrokeEventRisk = list.get(1);
-      pigeonResult.setFatalStrokeEventRisk((Double) fatalStrokeEventRisk);
-      Object totalCVMortalityRisk = list.get(2);
-      pigeonResult.setTotalCVMortalityRisk((Double) totalCVMortalityRisk);
-      Object hardCVEventRisk = list.get(3);
-      pigeonResult.setHardCVEventRisk((Double) hardCVEventRisk);
+    static @NonNull CustomColorTheme fromList(@NonNull ArrayList<Object> list) {
+      CustomColorTheme pigeonResult = new CustomColorTheme();
+      Object themeColor = list.get(0);
+      pigeonResult.setThemeColor((String) themeColor);
+      Object textColor = list.get(1);
+      pigeonResult.setTextColor((String) textColor);
+      Object backgroundColor = list.get(2);
+      pigeonResult.setBackgroundColor((String) backgroundColor);
+      Object tileColor = list.get(3);
+      pigeonResult.setTileColor((String) tileColor);
       return pigeonResult;
     }
   }
 
   /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class CVDiseasesRisks {
-    private @Nullable Double overallRisk;
+  public static final class RisksFactors {
+    private @Nullable Long age;
 
-    public @Nullable Double getOverallRisk() {
-      return overallRisk;
+    public @Nullable Long getAge() {
+      return age;
     }
 
-    public void setOverallRisk(@Nullable Double setterArg) {
-      this.overallRisk = setterArg;
+    public void setAge(@Nullable Long setterArg) {
+      this.age = setterArg;
     }
 
-    private @Nullable Double coronaryHeartDiseaseRisk;
+    private @Nullable Double cholesterol;
 
-    public @Nullable Double getCoronaryHeartDiseaseRisk() {
-      return coronaryHeartDiseaseRisk;
+    public @Nullable Double getCholesterol() {
+      return cholesterol;
     }
 
-    public void setCoronaryHeartDiseaseRisk(@Nullable Double setterArg) {
-      this.coronaryHeartDiseaseRisk = setterArg;
+    public void setCholesterol(@Nullable Double setterArg) {
+      this.cholesterol = setterArg;
     }
 
-    private @Nullable Double strokeRisk;
+    private @Nullable Double cholesterolHdl;
 
-    public @Nullable Double getStrokeRisk() {
-      return strokeRisk;
+    public @Nullable Double getCholesterolHdl() {
+      return cholesterolHdl;
     }
 
-    public void setStrokeRisk(@Nullable Double setterArg) {
-      this.strokeRisk = setterArg;
+    public void setCholesterolHdl(@Nullable Double setterArg) {
+      this.cholesterolHdl = setterArg;
     }
 
-    private @Nullable Double heartFailureRisk;
+    private @Nullable Double sbp;
 
-    public @Nullable Double getHeartFailureRisk() {
-      return heartFailureRisk;
+    public @Nullable Double getSbp() {
+      return sbp;
     }
 
-    public void setHeartFailureRisk(@Nullable Double setterArg) {
-      this.heartFailureRisk = setterArg;
+    public void setSbp(@Nullable Double setterArg) {
+      this.sbp = setterArg;
     }
 
-    private @Nullable Double peripheralVascularDiseaseRisk;
+    private @Nullable Boolean isSmoker;
 
-    public @Nullable Double getPeripheralVascularDiseaseRisk() {
-      return peripheralVascularDiseaseRisk;
+    public @Nullable Boolean getIsSmoker() {
+      return isSmoker;
     }
 
-    public void setPeripheralVascularDiseaseRisk(@Nullable Double setterArg) {
-      this.peripheralVascularDiseaseRisk = setterArg;
+    public void setIsSmoker(@Nullable Boolean setterArg) {
+      this.isSmoker = setterArg;
     }
 
-    public static final class Builder {
-
-      private @Nullable Double overallRisk;
+    private @Nullable Boolean hypertensionTreatment;
 
-      public @NonNull Builder setOverallRisk(@Nullable Double setterArg) {
-        this.overallRisk = setterArg;
-        return this;
-      }
+    public @Nullable Boolean getHypertensionTreatment() {
+      return hypertensionTreatment;
+    }
 
-      private @Nullable Double coronaryHeartDiseaseRisk;
+    public void setHypertensionTreatment(@Nullable Boolean setterArg) {
+      this.hypertensionTreatment = setterArg;
+    }
 
-      public @NonNull Builder setCoronaryHeartDiseaseRisk(@Nullable Double setterArg) {
-        this.coronaryHeartDiseaseRisk = setterArg;
-        return this;
-      }
+    private @Nullable Boolean hasDiabetes;
 
-      private @Nullable Double strokeRisk;
+    public @Nullable Boolean getHasDiabetes() {
+      return hasDiabetes;
+    }
 
-      public @NonNull Builder setStrokeRisk(@Nullable Double setterArg) {
-        this.strokeRisk = setterArg;
-        return this;
-      }
+    public void setHasDiabetes(@Nullable Boolean setterArg) {
+      this.hasDiabetes = setterArg;
+    }
 
-      private @Nullable Double heartFailureRisk;
+    private @Nullable Double bodyHeight;
 
-      public @NonNull Builder setHeartFailureRisk(@Nullable Double setterArg) {
-        this.heartFailureRisk = setterArg;
-        return this;
-      }
+    public @Nullable Double getBodyHeight() {
+      return bodyHeight;
+    }
 
-      private @Nullable Double peripheralVascularDiseaseRisk;
+    public void setBodyHeight(@Nullable Double setterArg) {
+      this.bodyHeight = setterArg;
+    }
 
-      public @NonNull Builder setPeripheralVascularDiseaseRisk(@Nullable Double setterArg) {
-        this.peripheralVascularDiseaseRisk = setterArg;
-        return this;
-      }
+    private @Nullable Double bodyWeight;
 
-      public @NonNull CVDiseasesRisks build() {
-        CVDiseasesRisks pigeonReturn = new CVDiseasesRisks();
-        pigeonReturn.setOverallRisk(overallRisk);
-        pigeonReturn.setCoronaryHeartDiseaseRisk(coronaryHeartDiseaseRisk);
-        pigeonReturn.setStrokeRisk(strokeRisk);
-        pigeonReturn.setHeartFailureRisk(heartFailureRisk);
-        pigeonReturn.setPeripheralVascularDiseaseRisk(peripheralVascularDiseaseRisk);
-        return pigeonReturn;
-      }
+    public @Nullable Double getBodyWeight() {
+      return bodyWeight;
     }
 
-    @NonNull
-    ArrayList<Object> toList() {
-      ArrayList<Object> toListResult = new ArrayList<Object>(5);
-      toListResult.add(overallRisk);
-      toListResult.add(coronaryHeartDiseaseRisk);
-      toListResult.add(strokeRisk);
-      toListResult.add(heartFailureRisk);
-      toListResult.add(peripheralVascularDiseaseRisk);
-      return toListResult;
+    public void setBodyWeight(@Nullable Double setterArg) {
+      this.bodyWeight = setterArg;
     }
 
-    static @NonNull CVDiseasesRisks fromList(@NonNull ArrayList<Object> list) {
-      CVDiseasesRisks pigeonResult = new CVDiseasesRisks();
-      Object overallRisk = list.get(0);
-      pigeonResult.setOverallRisk((Double) overallRisk);
-      Object coronaryHeartDiseaseRisk = list.get(1);
-      pigeonResult.setCoronaryHeartDiseaseRisk((Double) coronaryHeartDiseaseRisk);
-      Object strokeRisk = list.get(2);
-      pigeonResult.setStrokeRisk((Double) strokeRisk);
-      Object heartFailureRisk = list.get(3);
-      pigeonResult.setHeartFailureRisk((Double) heartFailureRisk);
-      Object peripheralVascularDiseaseRisk = list.get(4);
-      pigeonResult.setPeripheralVascularDiseaseRisk((Double) peripheralVascularDiseaseRisk);
-      return pigeonResult;
-    }
-  }
-
-  /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class RisksFactorsScores {
-    private @Nullable Long ageScore;
-
-    public @Nullable Long getAgeScore() {
-      return ageScore;
-    }
-
-    public void setAgeScore(@Nullable Long setterArg) {
-      this.ageScore = setterArg;
-    }
-
-    private @Nullable Long sbpScore;
-
-    public @Nullable Long getSbpScore() {
-      return sbpScore;
-    }
-
-    public void setSbpScore(@Nullable Long setterArg) {
-      this.sbpScore = setterArg;
-    }
-
-    private @Nullable Long smokingScore;
+    private @Nullable Gender gender;
 
-    public @Nullable Long getSmokingScore() {
-      return smokingScore;
+    public @Nullable Gender getGender() {
+      return gender;
     }
 
-    public void setSmokingScore(@Nullable Long setterArg) {
-      this.smokingScore = setterArg;
+    public void setGender(@Nullable Gender setterArg) {
+      this.gender = setterArg;
     }
 
-    private @Nullable Long diabetesScore;
+    private @Nullable String country;
 
-    public @Nullable Long getDiabetesScore() {
-      return diabetesScore;
+    public @Nullable String getCountry() {
+      return country;
     }
 
-    public void setDiabetesScore(@Nullable Long setterArg) {
-      this.diabetesScore = setterArg;
+    public void setCountry(@Nullable String setterArg) {
+      this.country = setterArg;
     }
 
-    private @Nullable Long bmiScore;
+    private @Nullable Race race;
 
-    public @Nullable Long getBmiScore() {
-      return bmiScore;
+    public @Nullable Race getRace() {
+      return race;
     }
 
-    public void setBmiScore(@Nullable Long setterArg) {
-      this.bmiScore = setterArg;
+    public void setRace(@Nullable Race setterArg) {
+      this.race = setterArg;
     }
 
-    private @Nullable Long cholesterolScore;
-
-    public @Nullable Long getCholesterolScore() {
-      return cholesterolScore;
-    }
+    public static final class Builder {
 
-    public void setCholesterolScore(@Nullable Long setterArg) {
-      this.cholesterolScore = setterArg;
-    }
+      private @Nullable Long age;
 
-    private @Nullable Long cholesterolHdlScore;
+      public @NonNull Builder setAge(@Nullable Long setterArg) {
+        this.age = setterArg;
+        return this;
+      }
 
-    public @Nullable Long getCholesterolHdlScore() {
-      return cholesterolHdlScore;
-    }
+      private @Nullable Double cholesterol;
 
-    public void setCholesterolHdlScore(@Nullable Long setterArg) {
-      this.cholesterolHdlScore = setterArg;
-    }
+      public @NonNull Builder setCholesterol(@Nullable Double setterArg) {
+        this.cholesterol = setterArg;
+        return this;
+      }
 
-    private @Nullable Long totalScore;
+      private @Nullable Double cholesterolHdl;
 
-    public @Nullable Long getTotalScore() {
-      return totalScore;
-    }
+      public @NonNull Builder setCholesterolHdl(@Nullable Double setterArg) {
+        this.cholesterolHdl = setterArg;
+        return this;
+      }
 
-    public void setTotalScore(@Nullable Long setterArg) {
-      this.totalScore = setterArg;
-    }
+      private @Nullable Double sbp;
 
-    public static final class Builder {
+      public @NonNull Builder setSbp(@Nullable Double setterArg) {
+        this.sbp = setterArg;
+        return this;
+      }
 
-      private @Nullable Long ageScore;
+      private @Nullable Boolean isSmoker;
 
-      public @NonNull Builder setAgeScore(@Nullable Long setterArg) {
-        this.ageScore = setterArg;
+      public @NonNull Builder setIsSmoker(@Nullable Boolean setterArg) {
+        this.isSmoker = setterArg;
         return this;
       }
 
-      private @Nullable Long sbpScore;
+      private @Nullable Boolean hypertensionTreatment;
 
-      public @NonNull Builder setSbpScore(@Nullable Long setterArg) {
-        this.sbpScore = setterArg;
+      public @NonNull Builder setHypertensionTreatment(@Nullable Boolean setterArg) {
+        this.hypertensionTreatment = setterArg;
         return this;
       }
 
-      private @Nullable Long smokingScore;
+      private @Nullable Boolean hasDiabetes;
 
-      public @NonNull Builder setSmokingScore(@Nullable Long setterArg) {
-        this.smokingScore = setterArg;
+      public @NonNull Builder setHasDiabetes(@Nullable Boolean setterArg) {
+        this.hasDiabetes = setterArg;
         return this;
       }
 
-      private @Nullable Long diabetesScore;
+      private @Nullable Double bodyHeight;
 
-      public @NonNull Builder setDiabetesScore(@Nullable Long setterArg) {
-        this.diabetesScore = setterArg;
+      public @NonNull Builder setBodyHeight(@Nullable Double setterArg) {
+        this.bodyHeight = setterArg;
         return this;
       }
 
-      private @Nullable Long bmiScore;
+      private @Nullable Double bodyWeight;
 
-      public @NonNull Builder setBmiScore(@Nullable Long setterArg) {
-        this.bmiScore = setterArg;
+      public @NonNull Builder setBodyWeight(@Nullable Double setterArg) {
+        this.bodyWeight = setterArg;
         return this;
       }
 
-      private @Nullable Long cholesterolScore;
+      private @Nullable Gender gender;
 
-      public @NonNull Builder setCholesterolScore(@Nullable Long setterArg) {
-        this.cholesterolScore = setterArg;
+      public @NonNull Builder setGender(@Nullable Gender setterArg) {
+        this.gender = setterArg;
         return this;
       }
 
-      private @Nullable Long cholesterolHdlScore;
+      private @Nullable String country;
 
-      public @NonNull Builder setCholesterolHdlScore(@Nullable Long setterArg) {
-        this.cholesterolHdlScore = setterArg;
+      public @NonNull Builder setCountry(@Nullable String setterArg) {
+        this.country = setterArg;
         return this;
       }
 
-      private @Nullable Long totalScore;
+      private @Nullable Race race;
 
-      public @NonNull Builder setTotalScore(@Nullable Long setterArg) {
-        this.totalScore = setterArg;
+      public @NonNull Builder setRace(@Nullable Race setterArg) {
+        this.race = setterArg;
         return this;
       }
 
-      public @NonNull RisksFactorsScores build() {
-        RisksFactorsScores pigeonReturn = new RisksFactorsScores();
-        pigeonReturn.setAgeScore(ageScore);
-        pigeonReturn.setSbpScore(sbpScore);
-        pigeonReturn.setSmokingScore(smokingScore);
-        pigeonReturn.setDiabetesScore(diabetesScore);
-        pigeonReturn.setBmiScore(bmiScore);
-        pigeonReturn.setCholesterolScore(cholesterolScore);
-        pigeonReturn.setCholesterolHdlScore(cholesterolHdlScore);
-        pigeonReturn.setTotalScore(totalScore);
+      public @NonNull RisksFactors build() {
+        RisksFactors pigeonReturn = new RisksFactors();
+        pigeonReturn.setAge(age);
+        pigeonReturn.setCholesterol(cholesterol);
+        pigeonReturn.setCholesterolHdl(cholesterolHdl);
+        pigeonReturn.setSbp(sbp);
+        pigeonReturn.setIsSmoker(isSmoker);
+        pigeonReturn.setHypertensionTreatment(hypertensionTreatment);
+        pigeonReturn.setHasDiabetes(hasDiabetes);
+        pigeonReturn.setBodyHeight(bodyHeight);
+        pigeonReturn.setBodyWeight(bodyWeight);
+        pigeonReturn.setGender(gender);
+        pigeonReturn.setCountry(country);
+        pigeonReturn.setRace(race);
         return pigeonReturn;
       }
     }
 
     @NonNull
     ArrayList<Object> toList() {
-      ArrayList<Object> toListResult = new ArrayList<Object>(8);
-      toListResult.add(ageScore);
-      toListResult.add(sbpScore);
-      toListResult.add(smokingScore);
-      toListResult.add(diabetesScore);
-      toListResult.add(bmiScore);
-      toListResult.add(cholesterolScore);
-      toListResult.add(cholesterolHdlScore);
-      toListResult.add(totalScore);
+      ArrayList<Object> toListResult = new ArrayList<Object>(12);
+      toListResult.add(age);
+      toListResult.add(cholesterol);
+      toListResult.add(cholesterolHdl);
+      toListResult.add(sbp);
+      toListResult.add(isSmoker);
+      toListResult.add(hypertensionTreatment);
+      toListResult.add(hasDiabetes);
+      toListResult.add(bodyHeight);
+      toListResult.add(bodyWeight);
+      toListResult.add(gender == null ? null : gender.index);
+      toListResult.add(country);
+      toListResult.add(race == null ? null : race.index);
       return toListResult;
     }
 
-    static @NonNull RisksFactorsScores fromList(@NonNull ArrayList<Object> list) {
-      RisksFactorsScores pigeonResult = new RisksFactorsScores();
-      Object ageScore = list.get(0);
-      pigeonResult.setAgeScore((ageScore == null) ? null : ((ageScore instanceof Integer) ? (Integer) ageScore : (Long) ageScore));
-      Object sbpScore = list.get(1);
-      pigeonResult.setSbpScore((sbpScore == null) ? null : ((sbpScore instanceof Integer) ? (Integer) sbpScore : (Long) sbpScore));
-      Object smokingScore = list.get(2);
-      pigeonResult.setSmokingScore((smokingScore == null) ? null : ((smokingScore instanceof Integer) ? (Integer) smokingScore : (Long) smokingScore));
-      Object diabetesScore = list.get(3);
-      pigeonResult.setDiabetesScore((diabetesScore == null) ? null : ((diabetesScore instanceof Integer) ? (Integer) diabetesScore : (Long) diabetesScore));
-      Object bmiScore = list.get(4);
-      pigeonResult.setBmiScore((bmiScore == null) ? null : ((bmiScore instanceof Integer) ? (Integer) bmiScore : (Long) bmiScore));
-      Object cholesterolScore = list.get(5);
-      pigeonResult.setCholesterolScore((cholesterolScore == null) ? null : ((cholesterolScore instanceof Integer) ? (Integer) cholesterolScore : (Long) cholesterolScore));
-      Object cholesterolHdlScore = list.get(6);
-      pigeonResult.setCholesterolHdlScore((cholesterolHdlScore == null) ? null : ((cholesterolHdlScore instanceof Integer) ? (Integer) cholesterolHdlScore : (Long) cholesterolHdlScore));
-      Object totalScore = list.get(7);
-      pigeonResult.setTotalScore((totalScore == null) ? null : ((totalScore instanceof Integer) ? (Integer) totalScore : (Long) totalScore));
+    static @NonNull RisksFactors fromList(@NonNull ArrayList<Object> list) {
+      RisksFactors pigeonResult = new RisksFactors();
+      Object age = list.get(0);
+      pigeonResult.setAge((age == null) ? null : ((age instanceof Integer) ? (Integer) age : (Long) age));
+      Object cholesterol = list.get(1);
+      pigeonResult.setCholesterol((Double) cholesterol);
+      Object cholesterolHdl = list.get(2);
+      pigeonResult.setCholesterolHdl((Double) cholesterolHdl);
+      Object sbp = list.get(3);
+      pigeonResult.setSbp((Double) sbp);
+      Object isSmoker = list.get(4);
+      pigeonResult.setIsSmoker((Boolean) isSmoker);
+      Object hypertensionTreatment = list.get(5);
+      pigeonResult.setHypertensionTreatment((Boolean) hypertensionTreatment);
+      Object hasDiabetes = list.get(6);
+      pigeonResult.setHasDiabetes((Boolean) hasDiabetes);
+      Object bodyHeight = list.get(7);
+      pigeonResult.setBodyHeight((Double) bodyHeight);
+      Object bodyWeight = list.get(8);
+      pigeonResult.setBodyWeight((Double) bodyWeight);
+      Object gender = list.get(9);
+      pigeonResult.setGender(gender == null ? null : Gender.values()[(int) gender]);
+      Object country = list.get(10);
+      pigeonResult.setCountry((String) country);
+      Object race = list.get(11);
+      pigeonResult.setRace(race == null ? null : Race.values()[(int) race]);
       return pigeonResult;
     }
   }
 
   /** Generated class from Pigeon that represents data sent in messages. */
-  public static final class HealthRisks {
-    private @NonNull HardAndFatalEventsRisks hardAndFatalEvents;
+  public static final class HardAndFatalEventsRisks {
+    private @Nullable Double coronaryDeathEventRisk;
 
-    public @NonNull HardAndFatalEventsRisks getHardAndFatalEvents() {
-      return hardAndFatalEvents;
+    public @Nullable Double getCoronaryDeathEventRisk() {
+      return coronaryDeathEventRisk;
     }
 
-    public void setHardAndFatalEvents(@NonNull HardAndFatalEventsRisks setterArg) {
-      if (setterArg == null) {
-        throw new IllegalStateException("Nonnull field \"hardAndFatalEvents\" is null.");
-      }
-      this.hardAndFatalEvents = setterArg;
+    public void setCoronaryDeathEventRisk(@Nullable Double setterArg) {
+      this.coronaryDeathEventRisk = setterArg;
     }
 
-    private @NonNull CVDiseasesRisks cvDiseases;
+    private @Nullable Double fatalStrokeEventRisk;
 
-    public @NonNull CVDiseasesRisks getCvDiseases() {
-      return cvDiseases;
+    public @Nullable Double getFatalStrokeEventRisk() {
+      return fatalStrokeEventRisk;
     }
 
-    public void setCvDiseases(@NonNull CVDiseasesRisks setterArg) {
-      if (setterArg == null) {
-        throw new IllegalStateException("Nonnull field \"cvDiseases\" is null.");
-      }
-      this.cvDiseases = setterArg;
+    public void setFatalStrokeEventRisk(@Nullable Double setterArg) {
+      this.fatalStrokeEventRisk = setterArg;
     }
 
-    private @Nullable Long vascularAge;
+    private @Nullable Double totalCVMortalityRisk;
 
-    public @Nullable Long getVascularAge() {
-      return vascularAge;
+    public @Nullable Double getTotalCVMortalityRisk() {
+      return totalCVMortalityRisk;
     }
 
-    public void setVascularAge(@Nullable Long setterArg) {
-      this.vascularAge = setterArg;
+    public void setTotalCVMortalityRisk(@Nullable Double setterArg) {
+      this.totalCVMortalityRisk = setterArg;
     }
 
-    private @NonNull RisksFactorsScores scores;
+    private @Nullable Double hardCVEventRisk;
 
-    public @NonNull RisksFactorsScores getScores() {
-      return scores;
+    public @Nullable Double getHardCVEventRisk() {
+      return hardCVEventRisk;
     }
 
-    public void setScores(@NonNull RisksFactorsScores setterArg) {
-      if (setterArg == null) {
-        throw new IllegalStateException("Nonnull field \"scores\" is null.");
-      }
-      this.scores = setterArg;
+    public void setHardCVEventRisk(@Nullable Double setterArg) {
+      this.hardCVEventRisk = setterArg;
     }
 
-    /** Constructor is non-public to enforce null safety; use Builder. */
-    HealthRisks() {}
-
     public static final class Builder {
 
-      private @Nullable HardAndFatalEventsRisks hardAndFatalEvents;
+      private @Nullable Double coronaryDeathEventRisk;
 
-      public @NonNull Builder setHardAndFatalEvents(@NonNull HardAndFatalEventsRisks setterArg) {
-        this.hardAndFatalEvents = setterArg;
+      public @NonNull Builder setCoronaryDeathEventRisk(@Nullable Double setterArg) {
+        this.coronaryDeathEventRisk = setterArg;
         return this;
       }
 
-      private @Nullable CVDiseasesRisks cvDiseases;
+      private @Nullable Double fatalStrokeEventRisk;
 
-      public @NonNull Builder setCvDiseases(@NonNull CVDiseasesRisks setterArg) {
-        this.cvDiseases = setterArg;
+      public @NonNull Builder setFatalStrokeEventRisk(@Nullable Double setterArg) {
+        this.fatalStrokeEventRisk = setterArg;
         return this;
       }
 
-      private @Nullable Long vascularAge;
+      private @Nullable Double totalCVMortalityRisk;
 
-      public @NonNull Builder setVascularAge(@Nullable Long setterArg) {
-        this.vascularAge = setterArg;
+      public @NonNull Builder setTotalCVMortalityRisk(@Nullable Double setterArg) {
+        this.totalCVMortalityRisk = setterArg;
         return this;
       }
 
-      private @Nullable RisksFactorsScores scores;
+      private @Nullable Double hardCVEventRisk;
 
-      public @NonNull Builder setScores(@NonNull RisksFactorsScores setterArg) {
-        this.scores = setterArg;
+      public @NonNull Builder setHardCVEventRisk(@Nullable Double setterArg) {
+        this.hardCVEventRisk = setterArg;
         return this;
       }
 
-      public @NonNull HealthRisks build() {
-        HealthRisks pigeonReturn = new HealthRisks();
-        pigeonReturn.setHardAndFatalEvents(hardAndFatalEvents);
-        pigeonReturn.setCvDiseases(cvDiseases);
-        pigeonReturn.setVascularAge(vascularAge);
-        pigeonReturn.setScores(scores);
+      public @NonNull HardAndFatalEventsRisks build() {
+        HardAndFatalEventsRisks pigeonReturn = new HardAndFatalEventsRisks();
+        pigeonReturn.setCoronaryDeathEventRisk(coronaryDeathEventRisk);
+        pigeonReturn.setFatalStrokeEventRisk(fatalStrokeEventRisk);
+        pigeonReturn.setTotalCVMortalityRisk(totalCVMortalityRisk);
+        pigeonReturn.setHardCVEventRisk(hardCVEventRisk);
         return pigeonReturn;
       }
     }
@@ -2420,293 +2619,2254 @@ public class Pigeon {
     @NonNull
     ArrayList<Object> toList() {
       ArrayList<Object> toListResult = new ArrayList<Object>(4);
-      toListResult.add((hardAndFatalEvents == null) ? null : hardAndFatalEvents.toList());
-      toListResult.add((cvDiseases == null) ? null : cvDiseases.toList());
-      toListResult.add(vascularAge);
-      toListResult.add((scores == null) ? null : scores.toList());
+      toListResult.add(coronaryDeathEventRisk);
+      toListResult.add(fatalStrokeEventRisk);
+      toListResult.add(totalCVMortalityRisk);
+      toListResult.add(hardCVEventRisk);
       return toListResult;
     }
 
-    static @NonNull HealthRisks fromList(@NonNull ArrayList<Object> list) {
-      HealthRisks pigeonResult = new HealthRisks();
-      Object hardAndFatalEvents = list.get(0);
-      pigeonResult.setHardAndFatalEvents((hardAndFatalEvents == null) ? null : HardAndFatalEventsRisks.fromList((ArrayList<Object>) hardAndFatalEvents));
-      Object cvDiseases = list.get(1);
-      pigeonResult.setCvDiseases((cvDiseases == null) ? null : CVDiseasesRisks.fromList((ArrayList<Object>) cvDiseases));
-      Object vascularAge = list.get(2);
-      pigeonResult.setVascularAge((vascularAge == null) ? null : ((vascularAge instanceof Integer) ? (Integer) vascularAge : (Long) vascularAge));
-      Object scores = list.get(3);
-      pigeonResult.setScores((scores == null) ? null : RisksFactorsScores.fromList((ArrayList<Object>) scores));
+    static @NonNull HardAndFatalEventsRisks fromList(@NonNull ArrayList<Object> list) {
+      HardAndFatalEventsRisks pigeonResult = new HardAndFatalEventsRisks();
+      Object coronaryDeathEventRisk = list.get(0);
+      pigeonResult.setCoronaryDeathEventRisk((Double) coronaryDeathEventRisk);
+      Object fatalStrokeEventRisk = list.get(1);
+      pigeonResult.setFatalStrokeEventRisk((Double) fatalStrokeEventRisk);
+      Object totalCVMortalityRisk = list.get(2);
+      pigeonResult.setTotalCVMortalityRisk((Double) totalCVMortalityRisk);
+      Object hardCVEventRisk = list.get(3);
+      pigeonResult.setHardCVEventRisk((Double) hardCVEventRisk);
       return pigeonResult;
     }
   }
 
-  public interface Result<T> {
-    @SuppressWarnings("UnknownNullness")
-    void success(T result);
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class CVDiseasesRisks {
+    private @Nullable Double overallRisk;
 
-    void error(@NonNull Throwable error);
-  }
+    public @Nullable Double getOverallRisk() {
+      return overallRisk;
+    }
 
-  private static class ShenaiSdkNativeApiCodec extends StandardMessageCodec {
-    public static final ShenaiSdkNativeApiCodec INSTANCE = new ShenaiSdkNativeApiCodec();
+    public void setOverallRisk(@Nullable Double setterArg) {
+      this.overallRisk = setterArg;
+    }
 
-    private ShenaiSdkNativeApiCodec() {}
+    private @Nullable Double coronaryHeartDiseaseRisk;
 
-    @Override
-    protected Object readValueOfType(byte type, @NonNull ByteBuffer buffer) {
-      switch (type) {
-        case (byte) 128:
-          return CVDiseasesRisks.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 129:
-          return CameraModeResponse.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 130:
-          return CustomColorTheme.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 131:
-          return CustomMeasurementConfig.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 132:
-          return FaceStateResponse.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 133:
-          return HardAndFatalEventsRisks.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 134:
-          return HealthRisks.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 135:
-          return Heartbeat.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 136:
-          return InitializationSettings.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 137:
-          return InitializeResponse.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 138:
-          return MeasurementPresetResponse.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 139:
-          return MeasurementResults.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 140:
-          return MeasurementStateResponse.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 141:
-          return NormalizedFaceBbox.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 142:
-          return OperatingModeResponse.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 143:
-          return PrecisionModeResponse.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 144:
-          return RisksFactors.fromList((ArrayList<Object>) readValue(buffer));
-        case (byte) 145:
-          return RisksFactorsScores.fromList((ArrayList<Object>) readValue(buffer));
-        default:
-          return super.readValueOfType(type, buffer);
-      }
+    public @Nullable Double getCoronaryHeartDiseaseRisk() {
+      return coronaryHeartDiseaseRisk;
     }
 
-    @Override
-    protected void writeValue(@NonNull ByteArrayOutputStream stream, Object value) {
-      if (value instanceof CVDiseasesRisks) {
-        stream.write(128);
-        writeValue(stream, ((CVDiseasesRisks) value).toList());
-      } else if (value instanceof CameraModeResponse) {
-        stream.write(129);
-        writeValue(stream, ((CameraModeResponse) value).toList());
-      } else if (value instanceof CustomColorTheme) {
-        stream.write(130);
-        writeValue(stream, ((CustomColorTheme) value).toList());
-      } else if (value instanceof CustomMeasurementConfig) {
-        stream.write(131);
-        writeValue(stream, ((CustomMeasurementConfig) value).toList());
-      } else if (value instanceof FaceStateResponse) {
-        stream.write(132);
-        writeValue(stream, ((FaceStateResponse) value).toList());
-      } else if (value instanceof HardAndFatalEventsRisks) {
-        stream.write(133);
-        writeValue(stream, ((HardAndFatalEventsRisks) value).toList());
-      } else if (value instanceof HealthRisks) {
-        stream.write(134);
-        writeValue(stream, ((HealthRisks) value).toList());
-      } else if (value instanceof Heartbeat) {
-        stream.write(135);
-        writeValue(stream, ((Heartbeat) value).toList());
-      } else if (value instanceof InitializationSettings) {
-        stream.write(136);
-        writeValue(stream, ((InitializationSettings) value).toList());
-      } else if (value instanceof InitializeResponse) {
-        stream.write(137);
-        writeValue(stream, ((InitializeResponse) value).toList());
-      } else if (value instanceof MeasurementPresetResponse) {
-        stream.write(138);
-        writeValue(stream, ((MeasurementPresetResponse) value).toList());
-      } else if (value instanceof MeasurementResults) {
-        stream.write(139);
-        writeValue(stream, ((MeasurementResults) value).toList());
-      } else if (value instanceof MeasurementStateResponse) {
-        stream.write(140);
-        writeValue(stream, ((MeasurementStateResponse) value).toList());
-      } else if (value instanceof NormalizedFaceBbox) {
-        stream.write(141);
-        writeValue(stream, ((NormalizedFaceBbox) value).toList());
-      } else if (value instanceof OperatingModeResponse) {
-        stream.write(142);
-        writeValue(stream, ((OperatingModeResponse) value).toList());
-      } else if (value instanceof PrecisionModeResponse) {
-        stream.write(143);
-        writeValue(stream, ((PrecisionModeResponse) value).toList());
-      } else if (value instanceof RisksFactors) {
-        stream.write(144);
-        writeValue(stream, ((RisksFactors) value).toList());
-      } else if (value instanceof RisksFactorsScores) {
-        stream.write(145);
-        writeValue(stream, ((RisksFactorsScores) value).toList());
-      } else {
-        super.writeValue(stream, value);
-      }
+    public void setCoronaryHeartDiseaseRisk(@Nullable Double setterArg) {
+      this.coronaryHeartDiseaseRisk = setterArg;
     }
-  }
-
-  /** Generated interface from Pigeon that represents a handler of messages from Flutter. */
-  public interface ShenaiSdkNativeApi {
 
-    @NonNull 
-    InitializeResponse initialize(@NonNull String apiKey, @NonNull String userId, @Nullable InitializationSettings settings);
+    private @Nullable Double strokeRisk;
 
-    @NonNull 
-    Boolean isInitialized();
+    public @Nullable Double getStrokeRisk() {
+      return strokeRisk;
+    }
 
-    void deinitialize(@NonNull Result<Void> result);
+    public void setStrokeRisk(@Nullable Double setterArg) {
+      this.strokeRisk = setterArg;
+    }
 
-    void setOperatingMode(@NonNull OperatingMode mode);
+    private @Nullable Double heartFailureRisk;
 
-    @NonNull 
-    OperatingModeResponse getOperatingMode();
+    public @Nullable Double getHeartFailureRisk() {
+      return heartFailureRisk;
+    }
 
-    void setPrecisionMode(@NonNull PrecisionMode mode);
-
-    @NonNull 
-    PrecisionModeResponse getPrecisionMode();
+    public void setHeartFailureRisk(@Nullable Double setterArg) {
+      this.heartFailureRisk = setterArg;
+    }
 
-    void setMeasurementPreset(@NonNull MeasurementPreset preset);
+    private @Nullable Double peripheralVascularDiseaseRisk;
 
-    @NonNull 
-    MeasurementPresetResponse getMeasurementPreset();
+    public @Nullable Double getPeripheralVascularDiseaseRisk() {
+      return peripheralVascularDiseaseRisk;
+    }
 
-    void setCustomMeasurementConfig(@NonNull CustomMeasurementConfig config);
+    public void setPeripheralVascularDiseaseRisk(@Nullable Double setterArg) {
+      this.peripheralVascularDiseaseRisk = setterArg;
+    }
 
-    void setCustomColorTheme(@NonNull CustomColorTheme theme);
+    public static final class Builder {
 
-    void setCameraMode(@NonNull CameraMode mode);
+      private @Nullable Double overallRisk;
 
-    @NonNull 
-    CameraModeResponse getCameraMode();
+      public @NonNull Builder setOverallRisk(@Nullable Double setterArg) {
+        this.overallRisk = setterArg;
+        return this;
+      }
 
-    void setShowUserInterface(@NonNull Boolean show);
+      private @Nullable Double coronaryHeartDiseaseRisk;
 
-    @NonNull 
-    Boolean getShowUserInterface();
+      public @NonNull Builder setCoronaryHeartDiseaseRisk(@Nullable Double setterArg) {
+        this.coronaryHeartDiseaseRisk = setterArg;
+        return this;
+      }
 
-    void setShowFacePositioningOverlay(@NonNull Boolean show);
+      private @Nullable Double strokeRisk;
 
-    @NonNull 
-    Boolean getShowFacePositioningOverlay();
+      public @NonNull Builder setStrokeRisk(@Nullable Double setterArg) {
+        this.strokeRisk = setterArg;
+        return this;
+      }
 
-    void setShowVisualWarnings(@NonNull Boolean show);
+      private @Nullable Double heartFailureRisk;
 
-    @NonNull 
-    Boolean getShowVisualWarnings();
+      public @NonNull Builder setHeartFailureRisk(@Nullable Double setterArg) {
+        this.heartFailureRisk = setterArg;
+        return this;
+      }
 
-    void setEnableCameraSwap(@NonNull Boolean enable);
+      private @Nullable Double peripheralVascularDiseaseRisk;
 
-    @NonNull 
-    Boolean getEnableCameraSwap();
+      public @NonNull Builder setPeripheralVascularDiseaseRisk(@Nullable Double setterArg) {
+        this.peripheralVascularDiseaseRisk = setterArg;
+        return this;
+      }
 
-    void setShowFaceMask(@NonNull Boolean show);
+      public @NonNull CVDiseasesRisks build() {
+        CVDiseasesRisks pigeonReturn = new CVDiseasesRisks();
+        pigeonReturn.setOverallRisk(overallRisk);
+        pigeonReturn.setCoronaryHeartDiseaseRisk(coronaryHeartDiseaseRisk);
+        pigeonReturn.setStrokeRisk(strokeRisk);
+        pigeonReturn.setHeartFailureRisk(heartFailureRisk);
+        pigeonReturn.setPeripheralVascularDiseaseRisk(peripheralVascularDiseaseRisk);
+        return pigeonReturn;
+      }
+    }
 
-    @NonNull 
-    Boolean getShowFaceMask();
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(5);
+      toListResult.add(overallRisk);
+      toListResult.add(coronaryHeartDiseaseRisk);
+      toListResult.add(strokeRisk);
+      toListResult.add(heartFailureRisk);
+      toListResult.add(peripheralVascularDiseaseRisk);
+      return toListResult;
+    }
 
-    void setShowBloodFlow(@NonNull Boolean show);
+    static @NonNull CVDiseasesRisks fromList(@NonNull ArrayList<Object> list) {
+      CVDiseasesRisks pigeonResult = new CVDiseasesRisks();
+      Object overallRisk = list.get(0);
+      pigeonResult.setOverallRisk((Double) overallRisk);
+      Object coronaryHeartDiseaseRisk = list.get(1);
+      pigeonResult.setCoronaryHeartDiseaseRisk((Double) coronaryHeartDiseaseRisk);
+      Object strokeRisk = list.get(2);
+      pigeonResult.setStrokeRisk((Double) strokeRisk);
+      Object heartFailureRisk = list.get(3);
+      pigeonResult.setHeartFailureRisk((Double) heartFailureRisk);
+      Object peripheralVascularDiseaseRisk = list.get(4);
+      pigeonResult.setPeripheralVascularDiseaseRisk((Double) peripheralVascularDiseaseRisk);
+      return pigeonResult;
+    }
+  }
 
-    @NonNull 
-    Boolean getShowBloodFlow();
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class RisksFactorsScores {
+    private @Nullable Long ageScore;
 
-    void setEnableStartAfterSuccess(@NonNull Boolean enable);
+    public @Nullable Long getAgeScore() {
+      return ageScore;
+    }
 
-    @NonNull 
-    Boolean getEnableStartAfterSuccess();
+    public void setAgeScore(@Nullable Long setterArg) {
+      this.ageScore = setterArg;
+    }
 
-    @NonNull 
-    FaceStateResponse getFaceState();
+    private @Nullable Long sbpScore;
 
-    @Nullable 
-    NormalizedFaceBbox getNormalizedFaceBbox();
+    public @Nullable Long getSbpScore() {
+      return sbpScore;
+    }
 
-    @NonNull 
-    MeasurementStateResponse getMeasurementState();
+    public void setSbpScore(@Nullable Long setterArg) {
+      this.sbpScore = setterArg;
+    }
 
-    @NonNull 
-    Double getMeasurementProgressPercentage();
+    private @Nullable Long smokingScore;
 
-    @Nullable 
-    Long getHeartRate10s();
+    public @Nullable Long getSmokingScore() {
+      return smokingScore;
+    }
 
-    @Nullable 
-    Long getHeartRate4s();
+    public void setSmokingScore(@Nullable Long setterArg) {
+      this.smokingScore = setterArg;
+    }
 
-    @Nullable 
-    MeasurementResults getRealtimeMetrics(@NonNull Double period_sec);
+    private @Nullable Long diabetesScore;
 
-    @Nullable 
-    MeasurementResults getMeasurementResults();
+    public @Nullable Long getDiabetesScore() {
+      return diabetesScore;
+    }
 
-    void setRecordingEnabled(@NonNull Boolean enabled);
+    public void setDiabetesScore(@Nullable Long setterArg) {
+      this.diabetesScore = setterArg;
+    }
 
-    @NonNull 
-    Boolean getRecordingEnabled();
+    private @Nullable Long bmiScore;
 
-    @NonNull 
-    Double getTotalBadSignalSeconds();
+    public @Nullable Long getBmiScore() {
+      return bmiScore;
+    }
 
-    @NonNull 
-    Double getCurrentSignalQualityMetric();
+    public void setBmiScore(@Nullable Long setterArg) {
+      this.bmiScore = setterArg;
+    }
 
-    @Nullable 
-    byte[] getSignalQualityMapPng();
+    private @Nullable Long cholesterolScore;
 
-    @Nullable 
-    byte[] getFaceTexturePng();
+    public @Nullable Long getCholesterolScore() {
+      return cholesterolScore;
+    }
 
-    @Nullable 
-    double[] getFullPpgSignal();
+    public void setCholesterolScore(@Nullable Long setterArg) {
+      this.cholesterolScore = setterArg;
+    }
 
-    @NonNull 
-    String getTraceID();
+    private @Nullable Long cholesterolHdlScore;
 
-    void setLanguage(@NonNull String language);
+    public @Nullable Long getCholesterolHdlScore() {
+      return cholesterolHdlScore;
+    }
 
-    @NonNull 
-    HealthRisks computeHealthRisks(@NonNull RisksFactors healthRisksFactors);
+    public void setCholesterolHdlScore(@Nullable Long setterArg) {
+      this.cholesterolHdlScore = setterArg;
+    }
 
-    @NonNull 
-    HealthRisks getMinimalHealthRisks(@NonNull RisksFactors healthRisksFactors);
+    private @Nullable Long totalScore;
 
-    @NonNull 
-    HealthRisks getMaximalHealthRisks(@NonNull RisksFactors healthRisksFactors);
+    public @Nullable Long getTotalScore() {
+      return totalScore;
+    }
 
-    /** The codec used by ShenaiSdkNativeApi. */
-    static @NonNull MessageCodec<Object> getCodec() {
-      return ShenaiSdkNativeApiCodec.INSTANCE;
+    public void setTotalScore(@Nullable Long setterArg) {
+      this.totalScore = setterArg;
     }
-    /**Sets up an instance of `ShenaiSdkNativeApi` to handle messages through the `binaryMessenger`. */
-    static void setup(@NonNull BinaryMessenger binaryMessenger, @Nullable ShenaiSdkNativeApi api) {
+
+    public static final class Builder {
+
+      private @Nullable Long ageScore;
+
+      public @NonNull Builder setAgeScore(@Nullable Long setterArg) {
+        this.ageScore = setterArg;
+        return this;
+      }
+
+      private @Nullable Long sbpScore;
+
+      public @NonNull Builder setSbpScore(@Nullable Long setterArg) {
+        this.sbpScore = setterArg;
+        return this;
+      }
+
+      private @Nullable Long smokingScore;
+
+      public @NonNull Builder setSmokingScore(@Nullable Long setterArg) {
+        this.smokingScore = setterArg;
+        return this;
+      }
+
+      private @Nullable Long diabetesScore;
+
+      public @NonNull Builder setDiabetesScore(@Nullable Long setterArg) {
+        this.diabetesScore = setterArg;
+        return this;
+      }
+
+      private @Nullable Long bmiScore;
+
+      public @NonNull Builder setBmiScore(@Nullable Long setterArg) {
+        this.bmiScore = setterArg;
+        return this;
+      }
+
+      private @Nullable Long cholesterolScore;
+
+      public @NonNull Builder setCholesterolScore(@Nullable Long setterArg) {
+        this.cholesterolScore = setterArg;
+        return this;
+      }
+
+      private @Nullable Long cholesterolHdlScore;
+
+      public @NonNull Builder setCholesterolHdlScore(@Nullable Long setterArg) {
+        this.cholesterolHdlScore = setterArg;
+        return this;
+      }
+
+      private @Nullable Long totalScore;
+
+      public @NonNull Builder setTotalScore(@Nullable Long setterArg) {
+        this.totalScore = setterArg;
+        return this;
+      }
+
+      public @NonNull RisksFactorsScores build() {
+        RisksFactorsScores pigeonReturn = new RisksFactorsScores();
+        pigeonReturn.setAgeScore(ageScore);
+        pigeonReturn.setSbpScore(sbpScore);
+        pigeonReturn.setSmokingScore(smokingScore);
+        pigeonReturn.setDiabetesScore(diabetesScore);
+        pigeonReturn.setBmiScore(bmiScore);
+        pigeonReturn.setCholesterolScore(cholesterolScore);
+        pigeonReturn.setCholesterolHdlScore(cholesterolHdlScore);
+        pigeonReturn.setTotalScore(totalScore);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(8);
+      toListResult.add(ageScore);
+      toListResult.add(sbpScore);
+      toListResult.add(smokingScore);
+      toListResult.add(diabetesScore);
+      toListResult.add(bmiScore);
+      toListResult.add(cholesterolScore);
+      toListResult.add(cholesterolHdlScore);
+      toListResult.add(totalScore);
+      return toListResult;
+    }
+
+    static @NonNull RisksFactorsScores fromList(@NonNull ArrayList<Object> list) {
+      RisksFactorsScores pigeonResult = new RisksFactorsScores();
+      Object ageScore = list.get(0);
+      pigeonResult.setAgeScore((ageScore == null) ? null : ((ageScore instanceof Integer) ? (Integer) ageScore : (Long) ageScore));
+      Object sbpScore = list.get(1);
+      pigeonResult.setSbpScore((sbpScore == null) ? null : ((sbpScore instanceof Integer) ? (Integer) sbpScore : (Long) sbpScore));
+      Object smokingScore = list.get(2);
+      pigeonResult.setSmokingScore((smokingScore == null) ? null : ((smokingScore instanceof Integer) ? (Integer) smokingScore : (Long) smokingScore));
+      Object diabetesScore = list.get(3);
+      pigeonResult.setDiabetesScore((diabetesScore == null) ? null : ((diabetesScore instanceof Integer) ? (Integer) diabetesScore : (Long) diabetesScore));
+      Object bmiScore = list.get(4);
+      pigeonResult.setBmiScore((bmiScore == null) ? null : ((bmiScore instanceof Integer) ? (Integer) bmiScore : (Long) bmiScore));
+      Object cholesterolScore = list.get(5);
+      pigeonResult.setCholesterolScore((cholesterolScore == null) ? null : ((cholesterolScore instanceof Integer) ? (Integer) cholesterolScore : (Long) cholesterolScore));
+      Object cholesterolHdlScore = list.get(6);
+      pigeonResult.setCholesterolHdlScore((cholesterolHdlScore == null) ? null : ((cholesterolHdlScore instanceof Integer) ? (Integer) cholesterolHdlScore : (Long) cholesterolHdlScore));
+      Object totalScore = list.get(7);
+      pigeonResult.setTotalScore((totalScore == null) ? null : ((totalScore instanceof Integer) ? (Integer) totalScore : (Long) totalScore));
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class HealthRisks {
+    private @NonNull HardAndFatalEventsRisks hardAndFatalEvents;
+
+    public @NonNull HardAndFatalEventsRisks getHardAndFatalEvents() {
+      return hardAndFatalEvents;
+    }
+
+    public void setHardAndFatalEvents(@NonNull HardAndFatalEventsRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"hardAndFatalEvents\" is null.");
+      }
+      this.hardAndFatalEvents = setterArg;
+    }
+
+    private @NonNull CVDiseasesRisks cvDiseases;
+
+    public @NonNull CVDiseasesRisks getCvDiseases() {
+      return cvDiseases;
+    }
+
+    public void setCvDiseases(@NonNull CVDiseasesRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"cvDiseases\" is null.");
+      }
+      this.cvDiseases = setterArg;
+    }
+
+    private @Nullable Long vascularAge;
+
+    public @Nullable Long getVascularAge() {
+      return vascularAge;
+    }
+
+    public void setVascularAge(@Nullable Long setterArg) {
+      this.vascularAge = setterArg;
+    }
+
+    private @NonNull RisksFactorsScores scores;
+
+    public @NonNull RisksFactorsScores getScores() {
+      return scores;
+    }
+
+    public void setScores(@NonNull RisksFactorsScores setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"scores\" is null.");
+      }
+      this.scores = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    HealthRisks() {}
+
+    public static final class Builder {
+
+      private @Nullable HardAndFatalEventsRisks hardAndFatalEvents;
+
+      public @NonNull Builder setHardAndFatalEvents(@NonNull HardAndFatalEventsRisks setterArg) {
+        this.hardAndFatalEvents = setterArg;
+        return this;
+      }
+
+      private @Nullable CVDiseasesRisks cvDiseases;
+
+      public @NonNull Builder setCvDiseases(@NonNull CVDiseasesRisks setterArg) {
+        this.cvDiseases = setterArg;
+        return this;
+      }
+
+      private @Nullable Long vascularAge;
+
+      public @NonNull Builder setVascularAge(@Nullable Long setterArg) {
+        this.vascularAge = setterArg;
+        return this;
+      }
+
+      private @Nullable RisksFactorsScores scores;
+
+      public @NonNull Builder setScores(@NonNull RisksFactorsScores setterArg) {
+        this.scores = setterArg;
+        return this;
+      }
+
+      public @NonNull HealthRisks build() {
+        HealthRisks pigeonReturn = new HealthRisks();
+        pigeonReturn.setHardAndFatalEvents(hardAndFatalEvents);
+        pigeonReturn.setCvDiseases(cvDiseases);
+        pigeonReturn.setVascularAge(vascularAge);
+        pigeonReturn.setScores(scores);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(4);
+      toListResult.add((hardAndFatalEvents == null) ? null : hardAndFatalEvents.toList());
+      toListResult.add((cvDiseases == null) ? null : cvDiseases.toList());
+      toListResult.add(vascularAge);
+      toListResult.add((scores == null) ? null : scores.toList());
+      return toListResult;
+    }
+
+    static @NonNull HealthRisks fromList(@NonNull ArrayList<Object> list) {
+      HealthRisks pigeonResult = new HealthRisks();
+      Object hardAndFatalEvents = list.get(0);
+      pigeonResult.setHardAndFatalEvents((hardAndFatalEvents == null) ? null : HardAndFatalEventsRisks.fromList((ArrayList<Object>) hardAndFatalEvents));
+      Object cvDiseases = list.get(1);
+      pigeonResult.setCvDiseases((cvDiseases == null) ? null : CVDiseasesRisks.fromList((ArrayList<Object>) cvDiseases));
+      Object vascularAge = list.get(2);
+      pigeonResult.setVascularAge((vascularAge == null) ? null : ((vascularAge instanceof Integer) ? (Integer) vascularAge : (Long) vascularAge));
+      Object scores = list.get(3);
+      pigeonResult.setScores((scores == null) ? null : RisksFactorsScores.fromList((ArrayList<Object>) scores));
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class HealthRisksBundle {
+    private @NonNull HealthRisks actual;
+
+    public @NonNull HealthRisks getActual() {
+      return actual;
+    }
+
+    public void setActual(@NonNull HealthRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"actual\" is null.");
+      }
+      this.actual = setterArg;
+    }
+
+    private @NonNull HealthRisks minimal;
+
+    public @NonNull HealthRisks getMinimal() {
+      return minimal;
+    }
+
+    public void setMinimal(@NonNull HealthRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"minimal\" is null.");
+      }
+      this.minimal = setterArg;
+    }
+
+    private @NonNull HealthRisks maximal;
+
+    public @NonNull HealthRisks getMaximal() {
+      return maximal;
+    }
+
+    public void setMaximal(@NonNull HealthRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"maximal\" is null.");
+      }
+      this.maximal = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    HealthRisksBundle() {}
+
+    public static final class Builder {
+
+      private @Nullable HealthRisks actual;
+
+      public @NonNull Builder setActual(@NonNull HealthRisks setterArg) {
+        this.actual = setterArg;
+        return this;
+      }
+
+      private @Nullable HealthRisks minimal;
+
+      public @NonNull Builder setMinimal(@NonNull HealthRisks setterArg) {
+        this.minimal = setterArg;
+        return this;
+      }
+
+      private @Nullable HealthRisks maximal;
+
+      public @NonNull Builder setMaximal(@NonNull HealthRisks setterArg) {
+        this.maximal = setterArg;
+        return this;
+      }
+
+      public @NonNull HealthRisksBundle build() {
+        HealthRisksBundle pigeonReturn = new HealthRisksBundle();
+        pigeonReturn.setActual(actual);
+        pigeonReturn.setMinimal(minimal);
+        pigeonReturn.setMaximal(maximal);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(3);
+      toListResult.add((actual == null) ? null : actual.toList());
+      toListResult.add((minimal == null) ? null : minimal.toList());
+      toListResult.add((maximal == null) ? null : maximal.toList());
+      return toListResult;
+    }
+
+    static @NonNull HealthRisksBundle fromList(@NonNull ArrayList<Object> list) {
+      HealthRisksBundle pigeonResult = new HealthRisksBundle();
+      Object actual = list.get(0);
+      pigeonResult.setActual((actual == null) ? null : HealthRisks.fromList((ArrayList<Object>) actual));
+      Object minimal = list.get(1);
+      pigeonResult.setMinimal((minimal == null) ? null : HealthRisks.fromList((ArrayList<Object>) minimal));
+      Object maximal = list.get(2);
+      pigeonResult.setMaximal((maximal == null) ? null : HealthRisks.fromList((ArrayList<Object>) maximal));
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class RiskFactorSensitivity {
+    private @NonNull ModifiableRiskFactor factor;
+
+    public @NonNull ModifiableRiskFactor getFactor() {
+      return factor;
+    }
+
+    public void setFactor(@NonNull ModifiableRiskFactor setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"factor\" is null.");
+      }
+      this.factor = setterArg;
+    }
+
+    private @NonNull Double step;
+
+    public @NonNull Double getStep() {
+      return step;
+    }
+
+    public void setStep(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"step\" is null.");
+      }
+      this.step = setterArg;
+    }
+
+    private @NonNull HealthRisks delta;
+
+    public @NonNull HealthRisks getDelta() {
+      return delta;
+    }
+
+    public void setDelta(@NonNull HealthRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"delta\" is null.");
+      }
+      this.delta = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    RiskFactorSensitivity() {}
+
+    public static final class Builder {
+
+      private @Nullable ModifiableRiskFactor factor;
+
+      public @NonNull Builder setFactor(@NonNull ModifiableRiskFactor setterArg) {
+        this.factor = setterArg;
+        return this;
+      }
+
+      private @Nullable Double step;
+
+      public @NonNull Builder setStep(@NonNull Double setterArg) {
+        this.step = setterArg;
+        return this;
+      }
+
+      private @Nullable HealthRisks delta;
+
+      public @NonNull Builder setDelta(@NonNull HealthRisks setterArg) {
+        this.delta = setterArg;
+        return this;
+      }
+
+      public @NonNull RiskFactorSensitivity build() {
+        RiskFactorSensitivity pigeonReturn = new RiskFactorSensitivity();
+        pigeonReturn.setFactor(factor);
+        pigeonReturn.setStep(step);
+        pigeonReturn.setDelta(delta);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(3);
+      toListResult.add(factor == null ? null : factor.index);
+      toListResult.add(step);
+      toListResult.add((delta == null) ? null : delta.toList());
+      return toListResult;
+    }
+
+    static @NonNull RiskFactorSensitivity fromList(@NonNull ArrayList<Object> list) {
+      RiskFactorSensitivity pigeonResult = new RiskFactorSensitivity();
+      Object factor = list.get(0);
+      pigeonResult.setFactor(ModifiableRiskFactor.values()[(int) factor]);
+      Object step = list.get(1);
+      pigeonResult.setStep((Double) step);
+      Object delta = list.get(2);
+      pigeonResult.setDelta((delta == null) ? null : HealthRisks.fromList((ArrayList<Object>) delta));
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class HealthRisksSensitivity {
+    private @NonNull HealthRisks risks;
+
+    public @NonNull HealthRisks getRisks() {
+      return risks;
+    }
+
+    public void setRisks(@NonNull HealthRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"risks\" is null.");
+      }
+      this.risks = setterArg;
+    }
+
+    private @NonNull List<RiskFactorSensitivity> sensitivities;
+
+    public @NonNull List<RiskFactorSensitivity> getSensitivities() {
+      return sensitivities;
+    }
+
+    public void setSensitivities(@NonNull List<RiskFactorSensitivity> setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"sensitivities\" is null.");
+      }
+      this.sensitivities = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    HealthRisksSensitivity() {}
+
+    public static final class Builder {
+
+      private @Nullable HealthRisks risks;
+
+      public @NonNull Builder setRisks(@NonNull HealthRisks setterArg) {
+        this.risks = setterArg;
+        return this;
+      }
+
+      private @Nullable List<RiskFactorSensitivity> sensitivities;
+
+      public @NonNull Builder setSensitivities(@NonNull List<RiskFactorSensitivity> setterArg) {
+        this.sensitivities = setterArg;
+        return this;
+      }
+
+      public @NonNull HealthRisksSensitivity build() {
+        HealthRisksSensitivity pigeonReturn = new HealthRisksSensitivity();
+        pigeonReturn.setRisks(risks);
+        pigeonReturn.setSensitivities(sensitivities);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(2);
+      toListResult.add((risks == null) ? null : risks.toList());
+      toListResult.add(sensitivities);
+      return toListResult;
+    }
+
+    static @NonNull HealthRisksSensitivity fromList(@NonNull ArrayList<Object> list) {
+      HealthRisksSensitivity pigeonResult = new HealthRisksSensitivity();
+      Object risks = list.get(0);
+      pigeonResult.setRisks((risks == null) ? null : HealthRisks.fromList((ArrayList<Object>) risks));
+      Object sensitivities = list.get(1);
+      pigeonResult.setSensitivities((List<RiskFactorSensitivity>) sensitivities);
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class HealthRisksGridAxis {
+    private @NonNull HealthRisksGridFactor factor;
+
+    public @NonNull HealthRisksGridFactor getFactor() {
+      return factor;
+    }
+
+    public void setFactor(@NonNull HealthRisksGridFactor setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"factor\" is null.");
+      }
+      this.factor = setterArg;
+    }
+
+    private @NonNull Double min;
+
+    public @NonNull Double getMin() {
+      return min;
+    }
+
+    public void setMin(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"min\" is null.");
+      }
+      this.min = setterArg;
+    }
+
+    private @NonNull Double max;
+
+    public @NonNull Double getMax() {
+      return max;
+    }
+
+    public void setMax(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"max\" is null.");
+      }
+      this.max = setterArg;
+    }
+
+    private @NonNull Long steps;
+
+    public @NonNull Long getSteps() {
+      return steps;
+    }
+
+    public void setSteps(@NonNull Long setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"steps\" is null.");
+      }
+      this.steps = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    HealthRisksGridAxis() {}
+
+    public static final class Builder {
+
+      private @Nullable HealthRisksGridFactor factor;
+
+      public @NonNull Builder setFactor(@NonNull HealthRisksGridFactor setterArg) {
+        this.factor = setterArg;
+        return this;
+      }
+
+      private @Nullable Double min;
+
+      public @NonNull Builder setMin(@NonNull Double setterArg) {
+        this.min = setterArg;
+        return this;
+      }
+
+      private @Nullable Double max;
+
+      public @NonNull Builder setMax(@NonNull Double setterArg) {
+        this.max = setterArg;
+        return this;
+      }
+
+      private @Nullable Long steps;
+
+      public @NonNull Builder setSteps(@NonNull Long setterArg) {
+        this.steps = setterArg;
+        return this;
+      }
+
+      public @NonNull HealthRisksGridAxis build() {
+        HealthRisksGridAxis pigeonReturn = new HealthRisksGridAxis();
+        pigeonReturn.setFactor(factor);
+        pigeonReturn.setMin(min);
+        pigeonReturn.setMax(max);
+        pigeonReturn.setSteps(steps);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(4);
+      toListResult.add(factor == null ? null : factor.index);
+      toListResult.add(min);
+      toListResult.add(max);
+      toListResult.add(steps);
+      return toListResult;
+    }
+
+    static @NonNull HealthRisksGridAxis fromList(@NonNull ArrayList<Object> list) {
+      HealthRisksGridAxis pigeonResult = new HealthRisksGridAxis();
+      Object factor = list.get(0);
+      pigeonResult.setFactor(HealthRisksGridFactor.values()[(int) factor]);
+      Object min = list.get(1);
+      pigeonResult.setMin((Double) min);
+      Object max = list.get(2);
+      pigeonResult.setMax((Double) max);
+      Object steps = list.get(3);
+      pigeonResult.setSteps((steps == null) ? null : ((steps instanceof Integer) ? (Integer) steps : (Long) steps));
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class RisksFactorsUncertainty {
+    private @Nullable Double sbp;
+
+    public @Nullable Double getSbp() {
+      return sbp;
+    }
+
+    public void setSbp(@Nullable Double setterArg) {
+      this.sbp = setterArg;
+    }
+
+    private @Nullable Double cholesterol;
+
+    public @Nullable Double getCholesterol() {
+      return cholesterol;
+    }
+
+    public void setCholesterol(@Nullable Double setterArg) {
+      this.cholesterol = setterArg;
+    }
+
+    private @Nullable Double cholesterolHdl;
+
+    public @Nullable Double getCholesterolHdl() {
+      return cholesterolHdl;
+    }
+
+    public void setCholesterolHdl(@Nullable Double setterArg) {
+      this.cholesterolHdl = setterArg;
+    }
+
+    private @Nullable Double bodyHeight;
+
+    public @Nullable Double getBodyHeight() {
+      return bodyHeight;
+    }
+
+    public void setBodyHeight(@Nullable Double setterArg) {
+      this.bodyHeight = setterArg;
+    }
+
+    private @Nullable Double bodyWeight;
+
+    public @Nullable Double getBodyWeight() {
+      return bodyWeight;
+    }
+
+    public void setBodyWeight(@Nullable Double setterArg) {
+      this.bodyWeight = setterArg;
+    }
+
+    public static final class Builder {
+
+      private @Nullable Double sbp;
+
+      public @NonNull Builder setSbp(@Nullable Double setterArg) {
+        this.sbp = setterArg;
+        return this;
+      }
+
+      private @Nullable Double cholesterol;
+
+      public @NonNull Builder setCholesterol(@Nullable Double setterArg) {
+        this.cholesterol = setterArg;
+        return this;
+      }
+
+      private @Nullable Double cholesterolHdl;
+
+      public @NonNull Builder setCholesterolHdl(@Nullable Double setterArg) {
+        this.cholesterolHdl = setterArg;
+        return this;
+      }
+
+      private @Nullable Double bodyHeight;
+
+      public @NonNull Builder setBodyHeight(@Nullable Double setterArg) {
+        this.bodyHeight = setterArg;
+        return this;
+      }
+
+      private @Nullable Double bodyWeight;
+
+      public @NonNull Builder setBodyWeight(@Nullable Double setterArg) {
+        this.bodyWeight = setterArg;
+        return this;
+      }
+
+      public @NonNull RisksFactorsUncertainty build() {
+        RisksFactorsUncertainty pigeonReturn = new RisksFactorsUncertainty();
+        pigeonReturn.setSbp(sbp);
+        pigeonReturn.setCholesterol(cholesterol);
+        pigeonReturn.setCholesterolHdl(cholesterolHdl);
+        pigeonReturn.setBodyHeight(bodyHeight);
+        pigeonReturn.setBodyWeight(bodyWeight);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(5);
+      toListResult.add(sbp);
+      toListResult.add(cholesterol);
+      toListResult.add(cholesterolHdl);
+      toListResult.add(bodyHeight);
+      toListResult.add(bodyWeight);
+      return toListResult;
+    }
+
+    static @NonNull RisksFactorsUncertainty fromList(@NonNull ArrayList<Object> list) {
+      RisksFactorsUncertainty pigeonResult = new RisksFactorsUncertainty();
+      Object sbp = list.get(0);
+      pigeonResult.setSbp((Double) sbp);
+      Object cholesterol = list.get(1);
+      pigeonResult.setCholesterol((Double) cholesterol);
+      Object cholesterolHdl = list.get(2);
+      pigeonResult.setCholesterolHdl((Double) cholesterolHdl);
+      Object bodyHeight = list.get(3);
+      pigeonResult.setBodyHeight((Double) bodyHeight);
+      Object bodyWeight = list.get(4);
+      pigeonResult.setBodyWeight((Double) bodyWeight);
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class HealthRisksInterval {
+    private @NonNull HealthRisks lower;
+
+    public @NonNull HealthRisks getLower() {
+      return lower;
+    }
+
+    public void setLower(@NonNull HealthRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"lower\" is null.");
+      }
+      this.lower = setterArg;
+    }
+
+    private @NonNull HealthRisks median;
+
+    public @NonNull HealthRisks getMedian() {
+      return median;
+    }
+
+    public void setMedian(@NonNull HealthRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"median\" is null.");
+      }
+      this.median = setterArg;
+    }
+
+    private @NonNull HealthRisks upper;
+
+    public @NonNull HealthRisks getUpper() {
+      return upper;
+    }
+
+    public void setUpper(@NonNull HealthRisks setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"upper\" is null.");
+      }
+      this.upper = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    HealthRisksInterval() {}
+
+    public static final class Builder {
+
+      private @Nullable HealthRisks lower;
+
+      public @NonNull Builder setLower(@NonNull HealthRisks setterArg) {
+        this.lower = setterArg;
+        return this;
+      }
+
+      private @Nullable HealthRisks median;
+
+      public @NonNull Builder setMedian(@NonNull HealthRisks setterArg) {
+        this.median = setterArg;
+        return this;
+      }
+
+      private @Nullable HealthRisks upper;
+
+      public @NonNull Builder setUpper(@NonNull HealthRisks setterArg) {
+        this.upper = setterArg;
+        return this;
+      }
+
+      public @NonNull HealthRisksInterval build() {
+        HealthRisksInterval pigeonReturn = new HealthRisksInterval();
+        pigeonReturn.setLower(lower);
+        pigeonReturn.setMedian(median);
+        pigeonReturn.setUpper(upper);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(3);
+      toListResult.add((lower == null) ? null : lower.toList());
+      toListResult.add((median == null) ? null : median.toList());
+      toListResult.add((upper == null) ? null : upper.toList());
+      return toListResult;
+    }
+
+    static @NonNull HealthRisksInterval fromList(@NonNull ArrayList<Object> list) {
+      HealthRisksInterval pigeonResult = new HealthRisksInterval();
+      Object lower = list.get(0);
+      pigeonResult.setLower((lower == null) ? null : HealthRisks.fromList((ArrayList<Object>) lower));
+      Object median = list.get(1);
+      pigeonResult.setMedian((median == null) ? null : HealthRisks.fromList((ArrayList<Object>) median));
+      Object upper = list.get(2);
+      pigeonResult.setUpper((upper == null) ? null : HealthRisks.fromList((ArrayList<Object>) upper));
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class HealthRisksCacheStats {
+    private @NonNull Long hits;
+
+    public @NonNull Long getHits() {
+      return hits;
+    }
+
+    public void setHits(@NonNull Long setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"hits\" is null.");
+      }
+      this.hits = setterArg;
+    }
+
+    private @NonNull Long misses;
+
+    public @NonNull Long getMisses() {
+      return misses;
+    }
+
+    public void setMisses(@NonNull Long setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"misses\" is null.");
+      }
+      this.misses = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    HealthRisksCacheStats() {}
+
+    public static final class Builder {
+
+      private @Nullable Long hits;
+
+      public @NonNull Builder setHits(@NonNull Long setterArg) {
+        this.hits = setterArg;
+        return this;
+      }
+
+      private @Nullable Long misses;
+
+      public @NonNull Builder setMisses(@NonNull Long setterArg) {
+        this.misses = setterArg;
+        return this;
+      }
+
+      public @NonNull HealthRisksCacheStats build() {
+        HealthRisksCacheStats pigeonReturn = new HealthRisksCacheStats();
+        pigeonReturn.setHits(hits);
+        pigeonReturn.setMisses(misses);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(2);
+      toListResult.add(hits);
+      toListResult.add(misses);
+      return toListResult;
+    }
+
+    static @NonNull HealthRisksCacheStats fromList(@NonNull ArrayList<Object> list) {
+      HealthRisksCacheStats pigeonResult = new HealthRisksCacheStats();
+      Object hits = list.get(0);
+      pigeonResult.setHits((hits == null) ? null : ((hits instanceof Integer) ? (Integer) hits : (Long) hits));
+      Object misses = list.get(1);
+      pigeonResult.setMisses((misses == null) ? null : ((misses instanceof Integer) ? (Integer) misses : (Long) misses));
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class StagePerformance {
+    private @NonNull Long count;
+
+    public @NonNull Long getCount() {
+      return count;
+    }
+
+    public void setCount(@NonNull Long setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"count\" is null.");
+      }
+      this.count = setterArg;
+    }
+
+    private @NonNull Double p50Ms;
+
+    public @NonNull Double getP50Ms() {
+      return p50Ms;
+    }
+
+    public void setP50Ms(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"p50Ms\" is null.");
+      }
+      this.p50Ms = setterArg;
+    }
+
+    private @NonNull Double p95Ms;
+
+    public @NonNull Double getP95Ms() {
+      return p95Ms;
+    }
+
+    public void setP95Ms(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"p95Ms\" is null.");
+      }
+      this.p95Ms = setterArg;
+    }
+
+    private @NonNull Double maxMs;
+
+    public @NonNull Double getMaxMs() {
+      return maxMs;
+    }
+
+    public void setMaxMs(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"maxMs\" is null.");
+      }
+      this.maxMs = setterArg;
+    }
+
+    private @NonNull Long maxInFlight;
+
+    public @NonNull Long getMaxInFlight() {
+      return maxInFlight;
+    }
+
+    public void setMaxInFlight(@NonNull Long setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"maxInFlight\" is null.");
+      }
+      this.maxInFlight = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    StagePerformance() {}
+
+    public static final class Builder {
+
+      private @Nullable Long count;
+
+      public @NonNull Builder setCount(@NonNull Long setterArg) {
+        this.count = setterArg;
+        return this;
+      }
+
+      private @Nullable Double p50Ms;
+
+      public @NonNull Builder setP50Ms(@NonNull Double setterArg) {
+        this.p50Ms = setterArg;
+        return this;
+      }
+
+      private @Nullable Double p95Ms;
+
+      public @NonNull Builder setP95Ms(@NonNull Double setterArg) {
+        this.p95Ms = setterArg;
+        return this;
+      }
+
+      private @Nullable Double maxMs;
+
+      public @NonNull Builder setMaxMs(@NonNull Double setterArg) {
+        this.maxMs = setterArg;
+        return this;
+      }
+
+      private @Nullable Long maxInFlight;
+
+      public @NonNull Builder setMaxInFlight(@NonNull Long setterArg) {
+        this.maxInFlight = setterArg;
+        return this;
+      }
+
+      public @NonNull StagePerformance build() {
+        StagePerformance pigeonReturn = new StagePerformance();
+        pigeonReturn.setCount(count);
+        pigeonReturn.setP50Ms(p50Ms);
+        pigeonReturn.setP95Ms(p95Ms);
+        pigeonReturn.setMaxMs(maxMs);
+        pigeonReturn.setMaxInFlight(maxInFlight);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(5);
+      toListResult.add(count);
+      toListResult.add(p50Ms);
+      toListResult.add(p95Ms);
+      toListResult.add(maxMs);
+      toListResult.add(maxInFlight);
+      return toListResult;
+    }
+
+    static @NonNull StagePerformance fromList(@NonNull ArrayList<Object> list) {
+      StagePerformance pigeonResult = new StagePerformance();
+      Object count = list.get(0);
+      pigeonResult.setCount((count == null) ? null : ((count instanceof Integer) ? (Integer) count : (Long) count));
+      Object p50Ms = list.get(1);
+      pigeonResult.setP50Ms((Double) p50Ms);
+      Object p95Ms = list.get(2);
+      pigeonResult.setP95Ms((Double) p95Ms);
+      Object maxMs = list.get(3);
+      pigeonResult.setMaxMs((Double) maxMs);
+      Object maxInFlight = list.get(4);
+      pigeonResult.setMaxInFlight((maxInFlight == null) ? null : ((maxInFlight instanceof Integer) ? (Integer) maxInFlight : (Long) maxInFlight));
+      return pigeonResult;
+    }
+  }
+
+  /** Generated class from Pigeon that represents data sent in messages. */
+  public static final class PerformanceStats {
+    private @NonNull Double windowSec;
+
+    public @NonNull Double getWindowSec() {
+      return windowSec;
+    }
+
+    public void setWindowSec(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"windowSec\" is null.");
+      }
+      this.windowSec = setterArg;
+    }
+
+    private @NonNull Double cpuTimeMs;
+
+    public @NonNull Double getCpuTimeMs() {
+      return cpuTimeMs;
+    }
+
+    public void setCpuTimeMs(@NonNull Double setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"cpuTimeMs\" is null.");
+      }
+      this.cpuTimeMs = setterArg;
+    }
+
+    private @NonNull StagePerformance initialize;
+
+    public @NonNull StagePerformance getInitialize() {
+      return initialize;
+    }
+
+    public void setInitialize(@NonNull StagePerformance setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"initialize\" is null.");
+      }
+      this.initialize = setterArg;
+    }
+
+    private @NonNull StagePerformance stateSnapshot;
+
+    public @NonNull StagePerformance getStateSnapshot() {
+      return stateSnapshot;
+    }
+
+    public void setStateSnapshot(@NonNull StagePerformance setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"stateSnapshot\" is null.");
+      }
+      this.stateSnapshot = setterArg;
+    }
+
+    private @NonNull StagePerformance imageExport;
+
+    public @NonNull StagePerformance getImageExport() {
+      return imageExport;
+    }
+
+    public void setImageExport(@NonNull StagePerformance setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"imageExport\" is null.");
+      }
+      this.imageExport = setterArg;
+    }
+
+    private @NonNull StagePerformance signalExport;
+
+    public @NonNull StagePerformance getSignalExport() {
+      return signalExport;
+    }
+
+    public void setSignalExport(@NonNull StagePerformance setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"signalExport\" is null.");
+      }
+      this.signalExport = setterArg;
+    }
+
+    private @NonNull StagePerformance healthRisks;
+
+    public @NonNull StagePerformance getHealthRisks() {
+      return healthRisks;
+    }
+
+    public void setHealthRisks(@NonNull StagePerformance setterArg) {
+      if (setterArg == null) {
+        throw new IllegalStateException("Nonnull field \"healthRisks\" is null.");
+      }
+      this.healthRisks = setterArg;
+    }
+
+    /** Constructor is non-public to enforce null safety; use Builder. */
+    PerformanceStats() {}
+
+    public static final class Builder {
+
+      private @Nullable Double windowSec;
+
+      public @NonNull Builder setWindowSec(@NonNull Double setterArg) {
+        this.windowSec = setterArg;
+        return this;
+      }
+
+      private @Nullable Double cpuTimeMs;
+
+      public @NonNull Builder setCpuTimeMs(@NonNull Double setterArg) {
+        this.cpuTimeMs = setterArg;
+        return this;
+      }
+
+      private @Nullable StagePerformance initialize;
+
+      public @NonNull Builder setInitialize(@NonNull StagePerformance setterArg) {
+        this.initialize = setterArg;
+        return this;
+      }
+
+      private @Nullable StagePerformance stateSnapshot;
+
+      public @NonNull Builder setStateSnapshot(@NonNull StagePerformance setterArg) {
+        this.stateSnapshot = setterArg;
+        return this;
+      }
+
+      private @Nullable StagePerformance imageExport;
+
+      public @NonNull Builder setImageExport(@NonNull StagePerformance setterArg) {
+        this.imageExport = setterArg;
+        return this;
+      }
+
+      private @Nullable StagePerformance signalExport;
+
+      public @NonNull Builder setSignalExport(@NonNull StagePerformance setterArg) {
+        this.signalExport = setterArg;
+        return this;
+      }
+
+      private @Nullable StagePerformance healthRisks;
+
+      public @NonNull Builder setHealthRisks(@NonNull StagePerformance setterArg) {
+        this.healthRisks = setterArg;
+        return this;
+      }
+
+      public @NonNull PerformanceStats build() {
+        PerformanceStats pigeonReturn = new PerformanceStats();
+        pigeonReturn.setWindowSec(windowSec);
+        pigeonReturn.setCpuTimeMs(cpuTimeMs);
+        pigeonReturn.setInitialize(initialize);
+        pigeonReturn.setStateSnapshot(stateSnapshot);
+        pigeonReturn.setImageExport(imageExport);
+        pigeonReturn.setSignalExport(signalExport);
+        pigeonReturn.setHealthRisks(healthRisks);
+        return pigeonReturn;
+      }
+    }
+
+    @NonNull
+    ArrayList<Object> toList() {
+      ArrayList<Object> toListResult = new ArrayList<Object>(7);
+      toListResult.add(windowSec);
+      toListResult.add(cpuTimeMs);
+      toListResult.add((initialize == null) ? null : initialize.toList());
+      toListResult.add((stateSnapshot == null) ? null : stateSnapshot.toList());
+      toListResult.add((imageExport == null) ? null : imageExport.toList());
+      toListResult.add((signalExport == null) ? null : signalExport.toList());
+      toListResult.add((healthRisks == null) ? null : healthRisks.toList());
+      return toListResult;
+    }
+
+    static @NonNull PerformanceStats fromList(@NonNull ArrayList<Object> list) {
+      PerformanceStats pigeonResult = new PerformanceStats();
+      Object windowSec = list.get(0);
+      pigeonResult.setWindowSec((Double) windowSec);
+      Object cpuTimeMs = list.get(1);
+      pigeonResult.setCpuTimeMs((Double) cpuTimeMs);
+      Object initialize = list.get(2);
+      pigeonResult.setInitialize((initialize == null) ? null : StagePerformance.fromList((ArrayList<Object>) initialize));
+      Object stateSnapshot = list.get(3);
+      pigeonResult.setStateSnapshot((stateSnapshot == null) ? null : StagePerformance.fromList((ArrayList<Object>) stateSnapshot));
+      Object imageExport = list.get(4);
+      pigeonResult.setImageExport((imageExport == null) ? null : StagePerformance.fromList((ArrayList<Object>) imageExport));
+      Object signalExport = list.get(5);
+      pigeonResult.setSignalExport((signalExport == null) ? null : StagePerformance.fromList((ArrayList<Object>) signalExport));
+      Object healthRisks = list.get(6);
+      pigeonResult.setHealthRisks((healthRisks == null) ? null : StagePerformance.fromList((ArrayList<Object>) healthRisks));
+      return pigeonResult;
+    }
+  }
+
+  public interface Result<T> {
+    @SuppressWarnings("UnknownNullness")
+    void success(T result);
+
+    void error(@NonNull Throwable error);
+  }
+
+  private static class ShenaiSdkNativeApiCodec extends StandardMessageCodec {
+    public static final ShenaiSdkNativeApiCodec INSTANCE = new ShenaiSdkNativeApiCodec();
+
+    private ShenaiSdkNativeApiCodec() {}
+
+    @Override
+    protected Object readValueOfType(byte type, @NonNull ByteBuffer buffer) {
+      switch (type) {
+        case (byte) 128:
+          return CVDiseasesRisks.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 129:
+          return CameraModeResponse.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 130:
+          return CustomColorTheme.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 131:
+          return CustomMeasurementConfig.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 132:
+          return FaceStateResponse.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 133:
+          return HardAndFatalEventsRisks.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 134:
+          return HealthRisks.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 135:
+          return HealthRisksBundle.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 136:
+          return HealthRisksCacheStats.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 137:
+          return HealthRisksGridAxis.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 138:
+          return HealthRisksInterval.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 139:
+          return HealthRisksSensitivity.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 140:
+          return HeartRateHistory.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 141:
+          return Heartbeat.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 142:
+          return Heartbeats.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 143:
+          return InitializationSettings.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 144:
+          return InitializationTimings.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 145:
+          return InitializeResponse.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 146:
+          return MeasurementPresetResponse.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 147:
+          return MeasurementResults.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 148:
+          return MeasurementStateResponse.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 149:
+          return NormalizedFaceBbox.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 150:
+          return OperatingModeResponse.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 151:
+          return PerformanceStats.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 152:
+          return PrecisionModeResponse.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 153:
+          return QualityTierResponse.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 154:
+          return RiskFactorSensitivity.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 155:
+          return RisksFactors.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 156:
+          return RisksFactorsScores.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 157:
+          return RisksFactorsUncertainty.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 158:
+          return StagePerformance.fromList((ArrayList<Object>) readValue(buffer));
+        case (byte) 159:
+          return StateSnapshot.fromList((ArrayList<Object>) readValue(buffer));
+        default:
+          return super.readValueOfType(type, buffer);
+      }
+    }
+
+    @Override
+    protected void writeValue(@NonNull ByteArrayOutputStream stream, Object value) {
+      if (value instanceof CVDiseasesRisks) {
+        stream.write(128);
+        writeValue(stream, ((CVDiseasesRisks) value).toList());
+      } else if (value instanceof CameraModeResponse) {
+        stream.write(129);
+        writeValue(stream, ((CameraModeResponse) value).toList());
+      } else if (value instanceof CustomColorTheme) {
+        stream.write(130);
+        writeValue(stream, ((CustomColorTheme) value).toList());
+      } else if (value instanceof CustomMeasurementConfig) {
+        stream.write(131);
+        writeValue(stream, ((CustomMeasurementConfig) value).toList());
+      } else if (value instanceof FaceStateResponse) {
+        stream.write(132);
+        writeValue(stream, ((FaceStateResponse) value).toList());
+      } else if (value instanceof HardAndFatalEventsRisks) {
+        stream.write(133);
+        writeValue(stream, ((HardAndFatalEventsRisks) value).toList());
+      } else if (value instanceof HealthRisks) {
+        stream.write(134);
+        writeValue(stream, ((HealthRisks) value).toList());
+      } else if (value instanceof HealthRisksBundle) {
+        stream.write(135);
+        writeValue(stream, ((HealthRisksBundle) value).toList());
+      } else if (value instanceof HealthRisksCacheStats) {
+        stream.write(136);
+        writeValue(stream, ((HealthRisksCacheStats) value).toList());
+      } else if (value instanceof HealthRisksGridAxis) {
+        stream.write(137);
+        writeValue(stream, ((HealthRisksGridAxis) value).toList());
+      } else if (value instanceof HealthRisksInterval) {
+        stream.write(138);
+        writeValue(stream, ((HealthRisksInterval) value).toList());
+      } else if (value instanceof HealthRisksSensitivity) {
+        stream.write(139);
+        writeValue(stream, ((HealthRisksSensitivity) value).toList());
+      } else if (value instanceof HeartRateHistory) {
+        stream.write(140);
+        writeValue(stream, ((HeartRateHistory) value).toList());
+      } else if (value instanceof Heartbeat) {
+        stream.write(141);
+        writeValue(stream, ((Heartbeat) value).toList());
+      } else if (value instanceof Heartbeats) {
+        stream.write(142);
+        writeValue(stream, ((Heartbeats) value).toList());
+      } else if (value instanceof InitializationSettings) {
+        stream.write(143);
+        writeValue(stream, ((InitializationSettings) value).toList());
+      } else if (value instanceof InitializationTimings) {
+        stream.write(144);
+        writeValue(stream, ((InitializationTimings) value).toList());
+      } else if (value instanceof InitializeResponse) {
+        stream.write(145);
+        writeValue(stream, ((InitializeResponse) value).toList());
+      } else if (value instanceof MeasurementPresetResponse) {
+        stream.write(146);
+        writeValue(stream, ((MeasurementPresetResponse) value).toList());
+      } else if (value instanceof MeasurementResults) {
+        stream.write(147);
+        writeValue(stream, ((MeasurementResults) value).toList());
+      } else if (value instanceof MeasurementStateResponse) {
+        stream.write(148);
+        writeValue(stream, ((MeasurementStateResponse) value).toList());
+      } else if (value instanceof NormalizedFaceBbox) {
+        stream.write(149);
+        writeValue(stream, ((NormalizedFaceBbox) value).toList());
+      } else if (value instanceof OperatingModeResponse) {
+        stream.write(150);
+        writeValue(stream, ((OperatingModeResponse) value).toList());
+      } else if (value instanceof PerformanceStats) {
+        stream.write(151);
+        writeValue(stream, ((PerformanceStats) value).toList());
+      } else if (value instanceof PrecisionModeResponse) {
+        stream.write(152);
+        writeValue(stream, ((PrecisionModeResponse) value).toList());
+      } else if (value instanceof QualityTierResponse) {
+        stream.write(153);
+        writeValue(stream, ((QualityTierResponse) value).toList());
+      } else if (value instanceof RiskFactorSensitivity) {
+        stream.write(154);
+        writeValue(stream, ((RiskFactorSensitivity) value).toList());
+      } else if (value instanceof RisksFactors) {
+        stream.write(155);
+        writeValue(stream, ((RisksFactors) value).toList());
+      } else if (value instanceof RisksFactorsScores) {
+        stream.write(156);
+        writeValue(stream, ((RisksFactorsScores) value).toList());
+      } else if (value instanceof RisksFactorsUncertainty) {
+        stream.write(157);
+        writeValue(stream, ((RisksFactorsUncertainty) value).toList());
+      } else if (value instanceof StagePerformance) {
+        stream.write(158);
+        writeValue(stream, ((StagePerformance) value).toList());
+      } else if (value instanceof StateSnapshot) {
+        stream.write(159);
+        writeValue(stream, ((StateSnapshot) value).toList());
+      } else {
+        super.writeValue(stream, value);
+      }
+    }
+  }
+
+  /** Generated interface from Pigeon that represents a handler of messages from Flutter. */
+  public interface ShenaiSdkNativeApi {
+
+    void initialize(@NonNull String apiKey, @NonNull String userId, @Nullable InitializationSettings settings, @NonNull Result<InitializeResponse> result);
+
+    void cancelInitialization(@NonNull Result<Void> result);
+
+    @NonNull 
+    Boolean isInitialized();
+
+    void deinitialize(@NonNull Result<Void> result);
+
+    void setOperatingMode(@NonNull OperatingMode mode);
+
+    @NonNull 
+    OperatingModeResponse getOperatingMode();
+
+    void setPrecisionMode(@NonNull PrecisionMode mode);
+
+    @NonNull 
+    PrecisionModeResponse getPrecisionMode();
+
+    void setMeasurementPreset(@NonNull MeasurementPreset preset);
+
+    @NonNull 
+    MeasurementPresetResponse getMeasurementPreset();
+
+    void setCustomMeasurementConfig(@NonNull CustomMeasurementConfig config);
+
+    void setCustomColorTheme(@NonNull CustomColorTheme theme);
+
+    void setCameraMode(@NonNull CameraMode mode);
+
+    @NonNull 
+    CameraModeResponse getCameraMode();
+
+    void suspend(@NonNull Result<Void> result);
+
+    void resume(@NonNull Result<Void> result);
+
+    @NonNull 
+    Boolean isSuspended();
+
+    void setShowUserInterface(@NonNull Boolean show);
+
+    @NonNull 
+    Boolean getShowUserInterface();
+
+    void setShowFacePositioningOverlay(@NonNull Boolean show);
+
+    @NonNull 
+    Boolean getShowFacePositioningOverlay();
+
+    void setShowVisualWarnings(@NonNull Boolean show);
+
+    @NonNull 
+    Boolean getShowVisualWarnings();
+
+    void setEnableCameraSwap(@NonNull Boolean enable);
+
+    @NonNull 
+    Boolean getEnableCameraSwap();
+
+    void setShowFaceMask(@NonNull Boolean show);
+
+    @NonNull 
+    Boolean getShowFaceMask();
+
+    void setShowBloodFlow(@NonNull Boolean show);
+
+    @NonNull 
+    Boolean getShowBloodFlow();
+
+    @NonNull 
+    QualityTierResponse getQualityTier();
+
+    void setEnableStartAfterSuccess(@NonNull Boolean enable);
+
+    @NonNull 
+    Boolean getEnableStartAfterSuccess();
+
+    @NonNull 
+    FaceStateResponse getFaceState();
+
+    @Nullable 
+    NormalizedFaceBbox getNormalizedFaceBbox();
+
+    @NonNull 
+    MeasurementStateResponse getMeasurementState();
+
+    @NonNull 
+    Double getMeasurementProgressPercentage();
+
+    @Nullable 
+    Long getHeartRate10s();
+
+    @Nullable 
+    Long getHeartRate4s();
+
+    @NonNull 
+    StateSnapshot getStateSnapshot();
+
+    @Nullable 
+    MeasurementResults getRealtimeMetrics(@NonNull Double period_sec);
+
+    @Nullable 
+    MeasurementResults getMeasurementResults();
+
+    void setRecordingEnabled(@NonNull Boolean enabled);
+
+    @NonNull 
+    Boolean getRecordingEnabled();
+
+    @NonNull 
+    Double getTotalBadSignalSeconds();
+
+    @NonNull 
+    Double getCurrentSignalQualityMetric();
+
+    @Nullable 
+    byte[] getSignalQualityMapPng();
+
+    @Nullable 
+    byte[] getFaceTexturePng();
+
+    @Nullable 
+    byte[] getFullPpgSignal();
+
+    @NonNull 
+    HeartRateHistory getHeartRateHistory10s(@Nullable Double sinceSec);
+
+    @NonNull 
+    HeartRateHistory getHeartRateHistory4s(@Nullable Double sinceSec);
+
+    @NonNull 
+    Heartbeats getRealtimeHeartbeats(@Nullable Double sinceSec);
+
+    @NonNull 
+    String getTraceID();
+
+    void setLanguage(@NonNull String language);
+
+    @NonNull 
+    HealthRisks computeHealthRisks(@NonNull RisksFactors healthRisksFactors);
+
+    @NonNull 
+    HealthRisks getMinimalHealthRisks(@NonNull RisksFactors healthRisksFactors);
+
+    @NonNull 
+    HealthRisks getMaximalHealthRisks(@NonNull RisksFactors healthRisksFactors);
+
+    @NonNull 
+    HealthRisksBundle computeHealthRisksBundle(@NonNull RisksFactors healthRisksFactors);
+
+    @NonNull 
+    HealthRisksSensitivity computeHealthRisksSensitivity(@NonNull RisksFactors healthRisksFactors);
+
+    @NonNull 
+    byte[] computeHealthRisksGrid(@NonNull RisksFactors baseFactors, @NonNull HealthRisksGridAxis xAxis, @NonNull HealthRisksGridAxis yAxis, @NonNull HealthRisksMetric metric);
+
+    @NonNull 
+    HealthRisksInterval computeHealthRisksUncertainty(@NonNull RisksFactors healthRisksFactors, @NonNull RisksFactorsUncertainty uncertainty, @NonNull Long samples, @NonNull Long seed);
+
+    void setHealthRisksCacheCapacity(@NonNull Long capacity);
+
+    @NonNull 
+    HealthRisksCacheStats getHealthRisksCacheStats();
+
+    @NonNull 
+    PerformanceStats getPerformanceStats(@NonNull Boolean reset);
+
+    /** The codec used by ShenaiSdkNativeApi. */
+    static @NonNull MessageCodec<Object> getCodec() {
+      return ShenaiSdkNativeApiCodec.INSTANCE;
+    }
+    /**Sets up an instance of `ShenaiSdkNativeApi` to handle messages through the `binaryMessenger`. */
+    static void setup(@NonNull BinaryMessenger binaryMessenger, @Nullable ShenaiSdkNativeApi api) {
+      BinaryMessenger.TaskQueue taskQueue = binaryMessenger.makeBackgroundTaskQueue();
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.initialize", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                String apiKeyArg = (String) args.get(0);
+                String userIdArg = (String) args.get(1);
+                InitializationSettings settingsArg = (InitializationSettings) args.get(2);
+                Result<InitializeResponse> resultCallback =
+                    new Result<InitializeResponse>() {
+                      public void success(InitializeResponse result) {
+                        wrapped.add(0, result);
+                        reply.reply(wrapped);
+                      }
+
+                      public void error(Throwable error) {
+                        ArrayList<Object> wrappedError = wrapError(error);
+                        reply.reply(wrappedError);
+                      }
+                    };
+
+                api.initialize(apiKeyArg, userIdArg, settingsArg, resultCallback);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.cancelInitialization", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                Result<Void> resultCallback =
+                    new Result<Void>() {
+                      public void success(Void result) {
+                        wrapped.add(0, null);
+                        reply.reply(wrapped);
+                      }
+
+                      public void error(Throwable error) {
+                        ArrayList<Object> wrappedError = wrapError(error);
+                        reply.reply(wrappedError);
+                      }
+                    };
+
+                api.cancelInitialization(resultCallback);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.isInitialized", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                try {
+                  Boolean output = api.isInitialized();
+                  wrapped.add(0, output);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.deinitialize", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                Result<Void> resultCallback =
+                    new Result<Void>() {
+                      public void success(Void result) {
+                        wrapped.add(0, null);
+                        reply.reply(wrapped);
+                      }
+
+                      public void error(Throwable error) {
+                        ArrayList<Object> wrappedError = wrapError(error);
+                        reply.reply(wrappedError);
+                      }
+                    };
+
+                api.deinitialize(resultCallback);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setOperatingMode", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                OperatingMode modeArg = OperatingMode.values()[(int) args.get(0)];
+                try {
+                  api.setOperatingMode(modeArg);
+                  wrapped.add(0, null);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getOperatingMode", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                try {
+                  OperatingModeResponse output = api.getOperatingMode();
+                  wrapped.add(0, output);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setPrecisionMode", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                PrecisionMode modeArg = PrecisionMode.values()[(int) args.get(0)];
+                try {
+                  api.setPrecisionMode(modeArg);
+                  wrapped.add(0, null);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getPrecisionMode", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                try {
+                  PrecisionModeResponse output = api.getPrecisionMode();
+                  wrapped.add(0, output);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setMeasurementPreset", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                MeasurementPreset presetArg = MeasurementPreset.values()[(int) args.get(0)];
+                try {
+                  api.setMeasurementPreset(presetArg);
+                  wrapped.add(0, null);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMeasurementPreset", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                try {
+                  MeasurementPresetResponse output = api.getMeasurementPreset();
+                  wrapped.add(0, output);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setCustomMeasurementConfig", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                CustomMeasurementConfig configArg = (CustomMeasurementConfig) args.get(0);
+                try {
+                  api.setCustomMeasurementConfig(configArg);
+                  wrapped.add(0, null);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setCustomColorTheme", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                CustomColorTheme themeArg = (CustomColorTheme) args.get(0);
+                try {
+                  api.setCustomColorTheme(themeArg);
+                  wrapped.add(0, null);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setCameraMode", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                CameraMode modeArg = CameraMode.values()[(int) args.get(0)];
+                try {
+                  api.setCameraMode(modeArg);
+                  wrapped.add(0, null);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getCameraMode", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                try {
+                  CameraModeResponse output = api.getCameraMode();
+                  wrapped.add(0, output);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.suspend", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                Result<Void> resultCallback =
+                    new Result<Void>() {
+                      public void success(Void result) {
+                        wrapped.add(0, null);
+                        reply.reply(wrapped);
+                      }
+
+                      public void error(Throwable error) {
+                        ArrayList<Object> wrappedError = wrapError(error);
+                        reply.reply(wrappedError);
+                      }
+                    };
+
+                api.suspend(resultCallback);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
+      {
+        BasicMessageChannel<Object> channel =
+            new BasicMessageChannel<>(
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.resume", getCodec());
+        if (api != null) {
+          channel.setMessageHandler(
+              (message, reply) -> {
+                ArrayList<Object> wrapped = new ArrayList<Object>();
+                Result<Void> resultCallback =
+                    new Result<Void>() {
+                      public void success(Void result) {
+                        wrapped.add(0, null);
+                        reply.reply(wrapped);
+                      }
+
+                      public void error(Throwable error) {
+                        ArrayList<Object> wrappedError = wrapError(error);
+                        reply.reply(wrappedError);
+                      }
+                    };
+
+                api.resume(resultCallback);
+              });
+        } else {
+          channel.setMessageHandler(null);
+        }
+      }
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.initialize", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.isSuspended", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                String apiKeyArg = (String) args.get(0);
-                String userIdArg = (String) args.get(1);
-                InitializationSettings settingsArg = (InitializationSettings) args.get(2);
                 try {
-                  InitializeResponse output = api.initialize(apiKeyArg, userIdArg, settingsArg);
+                  Boolean output = api.isSuspended();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -2722,14 +4882,16 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.isInitialized", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowUserInterface", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  Boolean output = api.isInitialized();
-                  wrapped.add(0, output);
+                  api.setShowUserInterface(showArg);
+                  wrapped.add(0, null);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -2744,25 +4906,20 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.deinitialize", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowUserInterface", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                Result<Void> resultCallback =
-                    new Result<Void>() {
-                      public void success(Void result) {
-                        wrapped.add(0, null);
-                        reply.reply(wrapped);
-                      }
-
-                      public void error(Throwable error) {
-                        ArrayList<Object> wrappedError = wrapError(error);
-                        reply.reply(wrappedError);
-                      }
-                    };
-
-                api.deinitialize(resultCallback);
+                try {
+                  Boolean output = api.getShowUserInterface();
+                  wrapped.add(0, output);
+                }
+ catch (Throwable exception) {
+                  ArrayList<Object> wrappedError = wrapError(exception);
+                  wrapped = wrappedError;
+                }
+                reply.reply(wrapped);
               });
         } else {
           channel.setMessageHandler(null);
@@ -2771,15 +4928,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setOperatingMode", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowFacePositioningOverlay", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                OperatingMode modeArg = OperatingMode.values()[(int) args.get(0)];
+                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  api.setOperatingMode(modeArg);
+                  api.setShowFacePositioningOverlay(showArg);
                   wrapped.add(0, null);
                 }
  catch (Throwable exception) {
@@ -2795,13 +4952,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getOperatingMode", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowFacePositioningOverlay", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  OperatingModeResponse output = api.getOperatingMode();
+                  Boolean output = api.getShowFacePositioningOverlay();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -2817,15 +4974,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setPrecisionMode", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowVisualWarnings", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                PrecisionMode modeArg = PrecisionMode.values()[(int) args.get(0)];
+                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  api.setPrecisionMode(modeArg);
+                  api.setShowVisualWarnings(showArg);
                   wrapped.add(0, null);
                 }
  catch (Throwable exception) {
@@ -2841,13 +4998,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getPrecisionMode", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowVisualWarnings", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  PrecisionModeResponse output = api.getPrecisionMode();
+                  Boolean output = api.getShowVisualWarnings();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -2863,15 +5020,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setMeasurementPreset", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setEnableCameraSwap", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                MeasurementPreset presetArg = MeasurementPreset.values()[(int) args.get(0)];
+                Boolean enableArg = (Boolean) args.get(0);
                 try {
-                  api.setMeasurementPreset(presetArg);
+                  api.setEnableCameraSwap(enableArg);
                   wrapped.add(0, null);
                 }
  catch (Throwable exception) {
@@ -2887,13 +5044,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMeasurementPreset", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getEnableCameraSwap", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  MeasurementPresetResponse output = api.getMeasurementPreset();
+                  Boolean output = api.getEnableCameraSwap();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -2909,15 +5066,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setCustomMeasurementConfig", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowFaceMask", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                CustomMeasurementConfig configArg = (CustomMeasurementConfig) args.get(0);
+                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  api.setCustomMeasurementConfig(configArg);
+                  api.setShowFaceMask(showArg);
                   wrapped.add(0, null);
                 }
  catch (Throwable exception) {
@@ -2933,16 +5090,14 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setCustomColorTheme", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowFaceMask", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                CustomColorTheme themeArg = (CustomColorTheme) args.get(0);
                 try {
-                  api.setCustomColorTheme(themeArg);
-                  wrapped.add(0, null);
+                  Boolean output = api.getShowFaceMask();
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -2957,15 +5112,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setCameraMode", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowBloodFlow", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                CameraMode modeArg = CameraMode.values()[(int) args.get(0)];
+                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  api.setCameraMode(modeArg);
+                  api.setShowBloodFlow(showArg);
                   wrapped.add(0, null);
                 }
  catch (Throwable exception) {
@@ -2981,13 +5136,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getCameraMode", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowBloodFlow", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  CameraModeResponse output = api.getCameraMode();
+                  Boolean output = api.getShowBloodFlow();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3003,16 +5158,14 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowUserInterface", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getQualityTier", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  api.setShowUserInterface(showArg);
-                  wrapped.add(0, null);
+                  QualityTierResponse output = api.getQualityTier();
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3027,14 +5180,16 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowUserInterface", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setEnableStartAfterSuccess", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                Boolean enableArg = (Boolean) args.get(0);
                 try {
-                  Boolean output = api.getShowUserInterface();
-                  wrapped.add(0, output);
+                  api.setEnableStartAfterSuccess(enableArg);
+                  wrapped.add(0, null);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3049,16 +5204,14 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowFacePositioningOverlay", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getEnableStartAfterSuccess", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  api.setShowFacePositioningOverlay(showArg);
-                  wrapped.add(0, null);
+                  Boolean output = api.getEnableStartAfterSuccess();
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3073,13 +5226,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowFacePositioningOverlay", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFaceState", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  Boolean output = api.getShowFacePositioningOverlay();
+                  FaceStateResponse output = api.getFaceState();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3095,16 +5248,14 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowVisualWarnings", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getNormalizedFaceBbox", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  api.setShowVisualWarnings(showArg);
-                  wrapped.add(0, null);
+                  NormalizedFaceBbox output = api.getNormalizedFaceBbox();
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3119,13 +5270,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowVisualWarnings", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMeasurementState", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  Boolean output = api.getShowVisualWarnings();
+                  MeasurementStateResponse output = api.getMeasurementState();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3141,16 +5292,14 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setEnableCameraSwap", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMeasurementProgressPercentage", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                Boolean enableArg = (Boolean) args.get(0);
                 try {
-                  api.setEnableCameraSwap(enableArg);
-                  wrapped.add(0, null);
+                  Double output = api.getMeasurementProgressPercentage();
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3165,13 +5314,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getEnableCameraSwap", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRate10s", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  Boolean output = api.getEnableCameraSwap();
+                  Long output = api.getHeartRate10s();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3187,16 +5336,14 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowFaceMask", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRate4s", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                Boolean showArg = (Boolean) args.get(0);
                 try {
-                  api.setShowFaceMask(showArg);
-                  wrapped.add(0, null);
+                  Long output = api.getHeartRate4s();
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3211,13 +5358,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowFaceMask", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getStateSnapshot", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  Boolean output = api.getShowFaceMask();
+                  StateSnapshot output = api.getStateSnapshot();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3233,16 +5380,16 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowBloodFlow", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getRealtimeMetrics", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                Boolean showArg = (Boolean) args.get(0);
+                Double period_secArg = (Double) args.get(0);
                 try {
-                  api.setShowBloodFlow(showArg);
-                  wrapped.add(0, null);
+                  MeasurementResults output = api.getRealtimeMetrics(period_secArg);
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3257,13 +5404,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getShowBloodFlow", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMeasurementResults", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  Boolean output = api.getShowBloodFlow();
+                  MeasurementResults output = api.getMeasurementResults();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3279,15 +5426,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setEnableStartAfterSuccess", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setRecordingEnabled", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                Boolean enableArg = (Boolean) args.get(0);
+                Boolean enabledArg = (Boolean) args.get(0);
                 try {
-                  api.setEnableStartAfterSuccess(enableArg);
+                  api.setRecordingEnabled(enabledArg);
                   wrapped.add(0, null);
                 }
  catch (Throwable exception) {
@@ -3303,13 +5450,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getEnableStartAfterSuccess", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getRecordingEnabled", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  Boolean output = api.getEnableStartAfterSuccess();
+                  Boolean output = api.getRecordingEnabled();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3325,13 +5472,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFaceState", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getTotalBadSignalSeconds", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  FaceStateResponse output = api.getFaceState();
+                  Double output = api.getTotalBadSignalSeconds();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3347,13 +5494,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getNormalizedFaceBbox", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getCurrentSignalQualityMetric", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  NormalizedFaceBbox output = api.getNormalizedFaceBbox();
+                  Double output = api.getCurrentSignalQualityMetric();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3369,13 +5516,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMeasurementState", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getSignalQualityMapPng", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  MeasurementStateResponse output = api.getMeasurementState();
+                  byte[] output = api.getSignalQualityMapPng();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3391,13 +5538,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMeasurementProgressPercentage", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFaceTexturePng", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  Double output = api.getMeasurementProgressPercentage();
+                  byte[] output = api.getFaceTexturePng();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3413,13 +5560,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRate10s", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFullPpgSignal", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 try {
-                  Long output = api.getHeartRate10s();
+                  byte[] output = api.getFullPpgSignal();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3435,13 +5582,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRate4s", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRateHistory10s", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                Double sinceSecArg = (Double) args.get(0);
                 try {
-                  Long output = api.getHeartRate4s();
+                  HeartRateHistory output = api.getHeartRateHistory10s(sinceSecArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3457,15 +5606,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getRealtimeMetrics", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRateHistory4s", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                Double period_secArg = (Double) args.get(0);
+                Double sinceSecArg = (Double) args.get(0);
                 try {
-                  MeasurementResults output = api.getRealtimeMetrics(period_secArg);
+                  HeartRateHistory output = api.getHeartRateHistory4s(sinceSecArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3481,13 +5630,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMeasurementResults", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getRealtimeHeartbeats", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                Double sinceSecArg = (Double) args.get(0);
                 try {
-                  MeasurementResults output = api.getMeasurementResults();
+                  Heartbeats output = api.getRealtimeHeartbeats(sinceSecArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3503,16 +5654,14 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setRecordingEnabled", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getTraceID", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                Boolean enabledArg = (Boolean) args.get(0);
                 try {
-                  api.setRecordingEnabled(enabledArg);
-                  wrapped.add(0, null);
+                  String output = api.getTraceID();
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3527,14 +5676,16 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getRecordingEnabled", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setLanguage", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                String languageArg = (String) args.get(0);
                 try {
-                  Boolean output = api.getRecordingEnabled();
-                  wrapped.add(0, output);
+                  api.setLanguage(languageArg);
+                  wrapped.add(0, null);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3549,13 +5700,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getTotalBadSignalSeconds", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisks", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
                 try {
-                  Double output = api.getTotalBadSignalSeconds();
+                  HealthRisks output = api.computeHealthRisks(healthRisksFactorsArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3571,13 +5724,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getCurrentSignalQualityMetric", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMinimalHealthRisks", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
                 try {
-                  Double output = api.getCurrentSignalQualityMetric();
+                  HealthRisks output = api.getMinimalHealthRisks(healthRisksFactorsArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3593,13 +5748,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getSignalQualityMapPng", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMaximalHealthRisks", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
                 try {
-                  byte[] output = api.getSignalQualityMapPng();
+                  HealthRisks output = api.getMaximalHealthRisks(healthRisksFactorsArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3615,13 +5772,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFaceTexturePng", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksBundle", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
                 try {
-                  byte[] output = api.getFaceTexturePng();
+                  HealthRisksBundle output = api.computeHealthRisksBundle(healthRisksFactorsArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3637,13 +5796,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFullPpgSignal", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksSensitivity", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
                 try {
-                  double[] output = api.getFullPpgSignal();
+                  HealthRisksSensitivity output = api.computeHealthRisksSensitivity(healthRisksFactorsArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3659,13 +5820,18 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getTraceID", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksGrid", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
+                ArrayList<Object> args = (ArrayList<Object>) message;
+                RisksFactors baseFactorsArg = (RisksFactors) args.get(0);
+                HealthRisksGridAxis xAxisArg = (HealthRisksGridAxis) args.get(1);
+                HealthRisksGridAxis yAxisArg = (HealthRisksGridAxis) args.get(2);
+                HealthRisksMetric metricArg = HealthRisksMetric.values()[(int) args.get(3)];
                 try {
-                  String output = api.getTraceID();
+                  byte[] output = api.computeHealthRisksGrid(baseFactorsArg, xAxisArg, yAxisArg, metricArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3681,16 +5847,19 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setLanguage", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksUncertainty", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                String languageArg = (String) args.get(0);
+                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
+                RisksFactorsUncertainty uncertaintyArg = (RisksFactorsUncertainty) args.get(1);
+                Number samplesArg = (Number) args.get(2);
+                Number seedArg = (Number) args.get(3);
                 try {
-                  api.setLanguage(languageArg);
-                  wrapped.add(0, null);
+                  HealthRisksInterval output = api.computeHealthRisksUncertainty(healthRisksFactorsArg, uncertaintyArg, (samplesArg == null) ? null : samplesArg.longValue(), (seedArg == null) ? null : seedArg.longValue());
+                  wrapped.add(0, output);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3705,16 +5874,16 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisks", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setHealthRisksCacheCapacity", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
+                Number capacityArg = (Number) args.get(0);
                 try {
-                  HealthRisks output = api.computeHealthRisks(healthRisksFactorsArg);
-                  wrapped.add(0, output);
+                  api.setHealthRisksCacheCapacity((capacityArg == null) ? null : capacityArg.longValue());
+                  wrapped.add(0, null);
                 }
  catch (Throwable exception) {
                   ArrayList<Object> wrappedError = wrapError(exception);
@@ -3729,15 +5898,13 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMinimalHealthRisks", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHealthRisksCacheStats", getCodec(), taskQueue);
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
-                ArrayList<Object> args = (ArrayList<Object>) message;
-                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
                 try {
-                  HealthRisks output = api.getMinimalHealthRisks(healthRisksFactorsArg);
+                  HealthRisksCacheStats output = api.getHealthRisksCacheStats();
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -3753,15 +5920,15 @@ public class Pigeon {
       {
         BasicMessageChannel<Object> channel =
             new BasicMessageChannel<>(
-                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMaximalHealthRisks", getCodec());
+                binaryMessenger, "dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getPerformanceStats", getCodec());
         if (api != null) {
           channel.setMessageHandler(
               (message, reply) -> {
                 ArrayList<Object> wrapped = new ArrayList<Object>();
                 ArrayList<Object> args = (ArrayList<Object>) message;
-                RisksFactors healthRisksFactorsArg = (RisksFactors) args.get(0);
+                Boolean resetArg = (Boolean) args.get(0);
                 try {
-                  HealthRisks output = api.getMaximalHealthRisks(healthRisksFactorsArg);
+                  PerformanceStats output = api.getPerformanceStats(resetArg);
                   wrapped.add(0, output);
                 }
  catch (Throwable exception) {
@@ -14,10 +14,18 @@ import io.flutter.plugin.platform.PlatformView;
 import java.util.Map;
 
 class ShenaiNativeView implements PlatformView {
-   @NonNull private final ShenAIView shenaiView;
+   @Nullable private final ShenAIView shenaiView;
+   @NonNull private final View view;
 
-   ShenaiNativeView(@NonNull Context context, int id, @Nullable Map<String, Object> creationParams, @Nullable Lifecycle lifecycle) {
+   ShenaiNativeView(@NonNull Context context, int id, @Nullable Map<String, Object> creationParams, @Nullable Lifecycle lifecycle, boolean headless) {
+        if (headless) {
+            // headless stand-in, no ShenAIView is created
+            shenaiView = null;
+            view = new View(context);
+            return;
+        }
         shenaiView = new ShenAIView(context);
+        view = shenaiView;
         if (lifecycle != null) {
             shenaiView.setLifecycleOwner(lifecycle);
         }
@@ -26,12 +34,14 @@ class ShenaiNativeView implements PlatformView {
     @NonNull
     @Override
     public View getView() {
-        return shenaiView;
+        return view;
     }
 
     @Override
     public void dispose() {     
         Log.d("ShenaiNativeView", "dispose");   
-        shenaiView.activityPaused();      
+        if (shenaiView != null) {
+            shenaiView.activityPaused();
+        }
     }
 }
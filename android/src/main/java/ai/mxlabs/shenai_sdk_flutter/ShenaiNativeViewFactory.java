@@ -11,6 +11,8 @@ import java.util.Map;
 
 class ShenaiNativeViewFactory extends PlatformViewFactory {
   private Lifecycle lifecycle;
+  // set while the SDK runs headless: views are then created empty, without the SDK's render path
+  private volatile boolean headless;
 
   ShenaiNativeViewFactory() {
     super(StandardMessageCodec.INSTANCE);
@@ -20,10 +22,14 @@ class ShenaiNativeViewFactory extends PlatformViewFactory {
     this.lifecycle = lifecycle;
   }
 
+  public void setHeadless(boolean headless) {
+    this.headless = headless;
+  }
+
   @NonNull
   @Override
   public PlatformView create(@NonNull Context context, int id, @Nullable Object args) {
     final Map<String, Object> creationParams = (Map<String, Object>) args;
-    return new ShenaiNativeView(context, id, creationParams, lifecycle);
+    return new ShenaiNativeView(context, id, creationParams, lifecycle, headless);
   }
 }
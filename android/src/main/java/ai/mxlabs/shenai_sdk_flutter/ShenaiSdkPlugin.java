@@ -1,12 +1,23 @@
 package ai.mxlabs.shenai_sdk_flutter;
 
 import android.app.Activity;
+import android.os.Handler;
+import android.os.Looper;
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 import androidx.lifecycle.Lifecycle;
 import android.util.Log;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
 import java.util.ArrayList;
 import java.util.Optional;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.FutureTask;
+import java.util.concurrent.atomic.AtomicLong;
 
 import ai.mxlabs.shenai_sdk.ShenAIAndroidSDK;
 
@@ -14,6 +25,7 @@ import io.flutter.embedding.engine.plugins.FlutterPlugin;
 import io.flutter.embedding.engine.plugins.activity.ActivityPluginBinding;
 import io.flutter.embedding.engine.plugins.activity.ActivityAware;
 import io.flutter.embedding.engine.plugins.lifecycle.FlutterLifecycleAdapter;
+import io.flutter.plugin.common.EventChannel;
 
 /** ShenaiSdkPlugin */
 public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi, ActivityAware {
@@ -23,6 +35,23 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
   private ShenAIAndroidSDK shenai_sdk = new ShenAIAndroidSDK();
   
   private ShenaiNativeViewFactory viewFactory;
+  private EventChannel stateChannel;
+  private volatile HealthRisksCache healthRisksCache;
+  // Lifecycle calls (initialize, deinitialize, suspend, resume) are received on the main thread in Dart call order
+  // and run one after another here. Every other call keeps running on its own thread meanwhile: getters and setters
+  // reach the SDK while it initializes or deinitializes and see the state it is in at that moment, isInitialized
+  // answers false until initialize has completed.
+  private final ExecutorService lifecycleExecutor = Executors.newSingleThreadExecutor();
+  // initialize requests received so far and the last one received before a cancelInitialization
+  private final AtomicLong initializeRequests = new AtomicLong();
+  private final AtomicLong cancelledInitializeRequests = new AtomicLong();
+  // what suspend changed, restored by resume; cleared by initialize and deinitialize
+  private final Object suspendLock = new Object();
+  private ShenAIAndroidSDK.CameraMode suspendedCameraMode;
+  private ShenAIAndroidSDK.OperatingMode suspendedOperatingMode;
+  // only touched on the main thread, null while the SDK is not initialized or no quality floor was set
+  private LoadGovernor loadGovernor;
+  private final Handler mainHandler = new Handler(Looper.getMainLooper());
 
   public ShenaiSdkPlugin() {
     Log.d("mxlib", "ShenaiSdkPlugin: constructor");
@@ -62,15 +91,20 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
     Log.d("mxlib", "Attached to engine");
 
     Pigeon.ShenaiSdkNativeApi.setup(flutterPluginBinding.getBinaryMessenger(), this);
+
+    stateChannel = new EventChannel(flutterPluginBinding.getBinaryMessenger(), "shenai_sdk/state_changes");
+    stateChannel.setStreamHandler(new ShenaiStateStream(this));
   }
 
   @Override
   public void onDetachedFromEngine(@NonNull FlutterPluginBinding binding) {    
     Pigeon.ShenaiSdkNativeApi.setup(binding.getBinaryMessenger(), null);
+    stateChannel.setStreamHandler(null);
   }
 
   @Override
-  public Pigeon.InitializeResponse initialize(@NonNull String apiKey, @NonNull String userId, @Nullable Pigeon.InitializationSettings settings) {
+  public void initialize(@NonNull String apiKey, @NonNull String userId,
+      @Nullable Pigeon.InitializationSettings settings, @NonNull Pigeon.Result<Pigeon.InitializeResponse> result) {
     ShenAIAndroidSDK.InitializationSettings shenai_settings = shenai_sdk.getDefaultInitializationSettings();
     
     if(settings != null) {
@@ -115,25 +149,91 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
       }
     }
 
-    ShenAIAndroidSDK.InitializationResult res = shenai_sdk.initialize(this.activity, apiKey, userId, shenai_settings);
-    Pigeon.InitializeResponse.Builder builder = new Pigeon.InitializeResponse.Builder();
-    switch(res) {
-      case OK:
-        builder.setResult(Pigeon.InitializationResult.SUCCESS);
-        break;
-      case INVALID_API_KEY:
-        builder.setResult(Pigeon.InitializationResult.FAIL_INVALID_API_KEY);
-        break;
-      case CONNECTION_ERROR:
-        builder.setResult(Pigeon.InitializationResult.FAIL_CONNECTION_ERROR);
-        break;
-      case INVALID:
-        builder.setResult(Pigeon.InitializationResult.FAIL_INTERNAL_ERROR);
-        break;
+    // headless: nothing is drawn, so every overlay is off and the platform view is created empty
+    boolean headless = settings != null && Boolean.TRUE.equals(settings.getHeadless());
+    if (headless) {
+      shenai_settings.showUserInterface = false;
+      shenai_settings.showFacePositioningOverlay = false;
+      shenai_settings.showVisualWarnings = false;
+      shenai_settings.showFaceMask = false;
+      shenai_settings.showBloodFlow = false;
     }
-    return builder.build();
+
+    // numbered on receipt, in the same order as cancelInitialization: requests received before the latest cancel are
+    // skipped while they wait in the queue, or undone if they already started
+    long request = initializeRequests.incrementAndGet();
+    long enqueued = System.nanoTime();
+    Pigeon.QualityTier qualityFloor = settings != null && !headless ? settings.getQualityFloor() : null;
+    runLifecycle(result, () -> {
+      Pigeon.InitializeResponse.Builder builder = new Pigeon.InitializeResponse.Builder();
+      Pigeon.InitializationTimings.Builder timingsBuilder = new Pigeon.InitializationTimings.Builder();
+      long started = System.nanoTime();
+      if (request <= cancelledInitializeRequests.get()) {
+        timingsBuilder.setQueuedMs((started - enqueued) / 1e6);
+        timingsBuilder.setInitializeMs(0.0);
+        builder.setTimings(timingsBuilder.build());
+        builder.setResult(Pigeon.InitializationResult.CANCELLED);
+        return builder.build();
+      }
+
+      clearSuspendedState();
+      ShenAIAndroidSDK.InitializationResult res;
+      try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.INITIALIZE)) {
+        res = shenai_sdk.initialize(this.activity, apiKey, userId, shenai_settings);
+      }
+      long finished = System.nanoTime();
+
+      timingsBuilder.setQueuedMs((started - enqueued) / 1e6);
+      timingsBuilder.setInitializeMs((finished - started) / 1e6);
+      builder.setTimings(timingsBuilder.build());
+      if (request <= cancelledInitializeRequests.get()) {
+        if (res == ShenAIAndroidSDK.InitializationResult.OK) {
+          shenai_sdk.deinitialize();
+        }
+        builder.setResult(Pigeon.InitializationResult.CANCELLED);
+        return builder.build();
+      }
+      switch(res) {
+        case OK:
+          builder.setResult(Pigeon.InitializationResult.SUCCESS);
+          viewFactory.setHeadless(headless);
+          replaceLoadGovernor(qualityFloor != null ? qualityFloor : Pigeon.QualityTier.FULL,
+              shenai_settings.showFaceMask, shenai_settings.showBloodFlow);
+          break;
+        case INVALID_API_KEY:
+          builder.setResult(Pigeon.InitializationResult.FAIL_INVALID_API_KEY);
+          break;
+        case CONNECTION_ERROR:
+          builder.setResult(Pigeon.InitializationResult.FAIL_CONNECTION_ERROR);
+          break;
+        case INVALID:
+          builder.setResult(Pigeon.InitializationResult.FAIL_INTERNAL_ERROR);
+          break;
+      }
+      return builder.build();
+    });
+  }
+
+  // Runs a lifecycle call on the lifecycle executor and replies with its outcome from there
+  private <T> void runLifecycle(@NonNull Pigeon.Result<T> result, @NonNull Callable<T> call) {
+    lifecycleExecutor.execute(() -> {
+      T value;
+      try {
+        value = call.call();
+      } catch (Throwable error) {
+        result.error(error);
+        return;
+      }
+      result.success(value);
+    });
   }
 
+  @Override
+  public void cancelInitialization(@NonNull Pigeon.Result<Void> result) {
+    // not queued, it has to reach the initialize requests received before it while they wait or run
+    cancelledInitializeRequests.set(initializeRequests.get());
+    result.success(null);
+  }
 
   @Override
   public Boolean isInitialized() {
@@ -141,11 +241,36 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
   }
 
   @Override
-  public void deinitialize(Pigeon.Result<Void> result) {
-    new Thread(() -> {
+  public void deinitialize(@NonNull Pigeon.Result<Void> result) {
+    runLifecycle(result, () -> {
       shenai_sdk.deinitialize();
-      result.success(null);
-    }).start();    
+      clearSuspendedState();
+      replaceLoadGovernor(Pigeon.QualityTier.FULL, false, false);
+      viewFactory.setHeadless(false);
+      return null;
+    });
+  }
+
+  // Replaces the running governor (none for a FULL floor). Called from the lifecycle executor and waits for the main
+  // thread, so the governor is in place before initialize replies and setShowFaceMask/setShowBloodFlow, which run on
+  // the main thread, can't slip in before it. The main thread never waits for the lifecycle executor.
+  private void replaceLoadGovernor(@NonNull Pigeon.QualityTier floor, boolean showFaceMask, boolean showBloodFlow)
+      throws InterruptedException, ExecutionException {
+    Activity currentActivity = activity;
+    float refreshRate =
+        currentActivity != null ? currentActivity.getWindowManager().getDefaultDisplay().getRefreshRate() : 0;
+    FutureTask<Void> replace = new FutureTask<>(() -> {
+      if (loadGovernor != null) {
+        loadGovernor.stop();
+        loadGovernor = null;
+      }
+      if (floor != Pigeon.QualityTier.FULL) {
+        loadGovernor = new LoadGovernor(shenai_sdk, floor, refreshRate, showFaceMask, showBloodFlow);
+        loadGovernor.start();
+      }
+    }, null);
+    mainHandler.post(replace);
+    replace.get();
   }
 
   @Override
@@ -292,6 +417,50 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
     return builder.build();
   }
 
+  private void clearSuspendedState() {
+    synchronized (suspendLock) {
+      suspendedCameraMode = null;
+      suspendedOperatingMode = null;
+    }
+  }
+
+  @Override
+  public void suspend(@NonNull Pigeon.Result<Void> result) {
+    runLifecycle(result, () -> {
+      // the camera and frame processing stop with the camera, models and license stay loaded
+      synchronized (suspendLock) {
+        if (suspendedCameraMode == null && shenai_sdk.isInitialized()) {
+          suspendedCameraMode = shenai_sdk.getCameraMode();
+          suspendedOperatingMode = shenai_sdk.getOperatingMode();
+          shenai_sdk.setCameraMode(ShenAIAndroidSDK.CameraMode.OFF);
+        }
+      }
+      return null;
+    });
+  }
+
+  @Override
+  public void resume(@NonNull Pigeon.Result<Void> result) {
+    runLifecycle(result, () -> {
+      synchronized (suspendLock) {
+        if (suspendedCameraMode != null) {
+          shenai_sdk.setCameraMode(suspendedCameraMode);
+          shenai_sdk.setOperatingMode(suspendedOperatingMode);
+          suspendedCameraMode = null;
+          suspendedOperatingMode = null;
+        }
+      }
+      return null;
+    });
+  }
+
+  @Override
+  public Boolean isSuspended() {
+    synchronized (suspendLock) {
+      return suspendedCameraMode != null;
+    }
+  }
+
   @Override
   public void setShowUserInterface(@NonNull Boolean show) {
     shenai_sdk.setShowUserInterface(show);
@@ -334,6 +503,10 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
 
   @Override
   public void setShowFaceMask(@NonNull Boolean show) {
+    if (loadGovernor != null) {
+      loadGovernor.setShowFaceMask(show);
+      return;
+    }
     shenai_sdk.setShowFaceMask(show);
   }
 
@@ -344,6 +517,10 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
 
   @Override
   public void setShowBloodFlow(@NonNull Boolean show) {
+    if (loadGovernor != null) {
+      loadGovernor.setShowBloodFlow(show);
+      return;
+    }
     shenai_sdk.setShowBloodFlow(show);
   }
 
@@ -352,6 +529,13 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
     return shenai_sdk.getShowBloodFlow();
   }
 
+  @Override
+  public Pigeon.QualityTierResponse getQualityTier() {
+    Pigeon.QualityTierResponse.Builder builder = new Pigeon.QualityTierResponse.Builder();
+    builder.setTier(loadGovernor != null ? loadGovernor.getTier() : Pigeon.QualityTier.FULL);
+    return builder.build();
+  }
+
   @Override
   public void setEnableStartAfterSuccess(@NonNull Boolean enable) {
     shenai_sdk.setEnableStartAfterSuccess(enable);
@@ -452,6 +636,23 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
     return new Long(shenai_sdk.getHeartRate4s());
   }
 
+  @Override
+  public Pigeon.StateSnapshot getStateSnapshot() {
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.STATE_SNAPSHOT)) {
+      // one message instead of a getter round trip per field
+      Pigeon.StateSnapshot.Builder builder = new Pigeon.StateSnapshot.Builder();
+      builder.setFaceState(getFaceState().getState());
+      builder.setNormalizedFaceBbox(getNormalizedFaceBbox());
+      builder.setMeasurementState(getMeasurementState().getState());
+      builder.setMeasurementProgressPercentage(getMeasurementProgressPercentage());
+      builder.setHeartRate4s(getHeartRate4s());
+      builder.setHeartRate10s(getHeartRate10s());
+      builder.setSignalQuality(getCurrentSignalQualityMetric());
+      builder.setTotalBadSignalSeconds(getTotalBadSignalSeconds());
+      return builder.build();
+    }
+  }
+
   private Pigeon.MeasurementResults constructMeasurementResults(@NonNull ShenAIAndroidSDK.MeasurementResults results) {
     if (results == null) {
       return null;
@@ -480,17 +681,23 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
     }
     builder.setAverage_signal_quality(new Double(results.averageSignalQuality));
  
-    ArrayList<Pigeon.Heartbeat> beats = new ArrayList<Pigeon.Heartbeat>();
+    // parallel buffers instead of one boxed object per beat
+    int count = results.heartbeats.size();
+    double[] starts = new double[count];
+    double[] ends = new double[count];
+    double[] durations = new double[count];
+    int i = 0;
     for (ShenAIAndroidSDK.Heartbeat sourceItem : results.heartbeats) {
-      Pigeon.Heartbeat destinationItem = new Pigeon.Heartbeat.Builder()
-        .setStart_location_sec((double) sourceItem.startLocationSec)
-        .setEnd_location_sec((double) sourceItem.endLocationSec)
-        .setDuration_ms((double) sourceItem.durationMs)
-        .build();
-      beats.add(destinationItem);
+      starts[i] = sourceItem.startLocationSec;
+      ends[i] = sourceItem.endLocationSec;
+      durations[i] = sourceItem.durationMs;
+      ++i;
     }
-
-    builder.setHeartbeats(beats);
+    Pigeon.Heartbeats.Builder heartbeatsBuilder = new Pigeon.Heartbeats.Builder();
+    heartbeatsBuilder.setStartLocationsSec(starts);
+    heartbeatsBuilder.setEndLocationsSec(ends);
+    heartbeatsBuilder.setDurationsMs(durations);
+    builder.setHeartbeats(heartbeatsBuilder.build());
 
     return builder.build();
   }
@@ -527,17 +734,54 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
 
   @Override 
   public byte[] getSignalQualityMapPng() {
-    return shenai_sdk.getSignalQualityMapPng();
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.IMAGE_EXPORT)) {
+      return shenai_sdk.getSignalQualityMapPng();
+    }
   }
 
   @Override
   public byte[] getFaceTexturePng() {
-    return shenai_sdk.getFaceTexturePng();
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.IMAGE_EXPORT)) {
+      return shenai_sdk.getFaceTexturePng();
+    }
+  }
+
+  @Override
+  public byte[] getFullPpgSignal() {
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.SIGNAL_EXPORT)) {
+      // the SDK widens the signal to doubles, narrow it back once so it crosses the channel at its native size
+      double[] signal = shenai_sdk.getFullPpgSignal();
+      if (signal == null) {
+        return null;
+      }
+      // sent as native-order bytes that Dart views as a Float32List
+      ByteBuffer result = ByteBuffer.allocate(signal.length * Float.BYTES).order(ByteOrder.nativeOrder());
+      FloatBuffer floats = result.asFloatBuffer();
+      for (double sample : signal) {
+        floats.put((float) sample);
+      }
+      return result.array();
+    }
   }
 
   @Override
-  public double[] getFullPpgSignal() {
-    return shenai_sdk.getFullPpgSignal();
+  public Pigeon.HeartRateHistory getHeartRateHistory10s(@Nullable Double sinceSec) {
+    throw unsupported("getHeartRateHistory10s");
+  }
+
+  @Override
+  public Pigeon.HeartRateHistory getHeartRateHistory4s(@Nullable Double sinceSec) {
+    throw unsupported("getHeartRateHistory4s");
+  }
+
+  @Override
+  public Pigeon.Heartbeats getRealtimeHeartbeats(@Nullable Double sinceSec) {
+    throw unsupported("getRealtimeHeartbeats");
+  }
+
+  // The Android SDK does not expose the realtime histories yet
+  private static Pigeon.FlutterError unsupported(@NonNull String method) {
+    return new Pigeon.FlutterError("unsupported", method + " is not available on Android", null);
   }
 
   @Override 
@@ -730,6 +974,16 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
 
   @Override
   public Pigeon.HealthRisks computeHealthRisks(@NonNull Pigeon.RisksFactors healthRisksFactors) {
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.HEALTH_RISKS)) {
+      HealthRisksCache cache = healthRisksCache;
+      if (cache != null) {
+        return cache.compute(healthRisksFactors, this::computeHealthRisksUncached);
+      }
+      return computeHealthRisksUncached(healthRisksFactors);
+    }
+  }
+
+  private Pigeon.HealthRisks computeHealthRisksUncached(@NonNull Pigeon.RisksFactors healthRisksFactors) {
     ShenAIAndroidSDK.RisksFactors risksFactors = constructRisksFactors(healthRisksFactors);
     ShenAIAndroidSDK.HealthRisks healthRisksResult = shenai_sdk.computeHealthRisks(risksFactors);
     return constructHealthRisks(healthRisksResult);
@@ -737,16 +991,79 @@ public class ShenaiSdkPlugin implements FlutterPlugin, Pigeon.ShenaiSdkNativeApi
 
   @Override
   public Pigeon.HealthRisks getMinimalHealthRisks(@NonNull Pigeon.RisksFactors healthRisksFactors) {
-    ShenAIAndroidSDK.RisksFactors risksFactors = constructRisksFactors(healthRisksFactors);
-    ShenAIAndroidSDK.HealthRisks healthRisksResult = shenai_sdk.getMinimalHealthRisks(risksFactors);
-    return constructHealthRisks(healthRisksResult);
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.HEALTH_RISKS)) {
+      ShenAIAndroidSDK.RisksFactors risksFactors = constructRisksFactors(healthRisksFactors);
+      ShenAIAndroidSDK.HealthRisks healthRisksResult = shenai_sdk.getMinimalHealthRisks(risksFactors);
+      return constructHealthRisks(healthRisksResult);
+    }
   }
 
   @Override
   public Pigeon.HealthRisks getMaximalHealthRisks(@NonNull Pigeon.RisksFactors healthRisksFactors) {
-    ShenAIAndroidSDK.RisksFactors risksFactors = constructRisksFactors(healthRisksFactors);
-    ShenAIAndroidSDK.HealthRisks healthRisksResult = shenai_sdk.getMaximalHealthRisks(risksFactors);
-    return constructHealthRisks(healthRisksResult);
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.HEALTH_RISKS)) {
+      ShenAIAndroidSDK.RisksFactors risksFactors = constructRisksFactors(healthRisksFactors);
+      ShenAIAndroidSDK.HealthRisks healthRisksResult = shenai_sdk.getMaximalHealthRisks(risksFactors);
+      return constructHealthRisks(healthRisksResult);
+    }
+  }
+
+  @Override
+  public Pigeon.HealthRisksBundle computeHealthRisksBundle(@NonNull Pigeon.RisksFactors healthRisksFactors) {
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.HEALTH_RISKS)) {
+      ShenAIAndroidSDK.RisksFactors risksFactors = constructRisksFactors(healthRisksFactors);
+      Pigeon.HealthRisksBundle.Builder bundleBuilder = new Pigeon.HealthRisksBundle.Builder();
+      bundleBuilder.setActual(constructHealthRisks(shenai_sdk.computeHealthRisks(risksFactors)));
+      bundleBuilder.setMinimal(constructHealthRisks(shenai_sdk.getMinimalHealthRisks(risksFactors)));
+      bundleBuilder.setMaximal(constructHealthRisks(shenai_sdk.getMaximalHealthRisks(risksFactors)));
+      return bundleBuilder.build();
+    }
+  }
+
+  @Override
+  public Pigeon.HealthRisksSensitivity computeHealthRisksSensitivity(@NonNull Pigeon.RisksFactors healthRisksFactors) {
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.HEALTH_RISKS)) {
+      return HealthRisksAnalysis.computeSensitivity(healthRisksFactors, this::computeHealthRisksUncached);
+    }
   }
 
+  @Override
+  public byte[] computeHealthRisksGrid(@NonNull Pigeon.RisksFactors baseFactors,
+      @NonNull Pigeon.HealthRisksGridAxis xAxis, @NonNull Pigeon.HealthRisksGridAxis yAxis,
+      @NonNull Pigeon.HealthRisksMetric metric) {
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.HEALTH_RISKS)) {
+      return HealthRisksAnalysis.computeGrid(baseFactors, xAxis, yAxis, metric, this::computeHealthRisksUncached);
+    }
+  }
+
+  @Override
+  public Pigeon.HealthRisksInterval computeHealthRisksUncertainty(@NonNull Pigeon.RisksFactors healthRisksFactors,
+      @NonNull Pigeon.RisksFactorsUncertainty uncertainty, @NonNull Long samples, @NonNull Long seed) {
+    try (StageCounters.Scope stage = StageCounters.start(StageCounters.Stage.HEALTH_RISKS)) {
+      return HealthRisksAnalysis.computeUncertainty(
+          healthRisksFactors, uncertainty, samples, seed, this::computeHealthRisksUncached);
+    }
+  }
+
+  @Override
+  public void setHealthRisksCacheCapacity(@NonNull Long capacity) {
+    healthRisksCache = capacity > 0 ? new HealthRisksCache((int) Math.min(capacity, Integer.MAX_VALUE)) : null;
+  }
+
+  @Override
+  public Pigeon.HealthRisksCacheStats getHealthRisksCacheStats() {
+    HealthRisksCache cache = healthRisksCache;
+    if (cache == null) {
+      Pigeon.HealthRisksCacheStats.Builder statsBuilder = new Pigeon.HealthRisksCacheStats.Builder();
+      statsBuilder.setHits(0L);
+      statsBuilder.setMisses(0L);
+      return statsBuilder.build();
+    }
+    return cache.getStats();
+  }
+  @Override
+  public Pigeon.PerformanceStats getPerformanceStats(@NonNull Boolean reset) {
+    return StageCounters.stats(reset);
+  }
+
+
 }
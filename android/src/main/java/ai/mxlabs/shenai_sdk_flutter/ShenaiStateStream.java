@@ -0,0 +1,111 @@
+package ai.mxlabs.shenai_sdk_flutter;
+
+import android.os.Handler;
+import android.os.Looper;
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import io.flutter.plugin.common.EventChannel;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Objects;
+
+/**
+ * Pushes SDK state changes to Dart over the "shenai_sdk/state_changes" event channel, mirroring the iOS
+ * ShenaiSdkStateStream. While a listener is attached the state getters are sampled every POLL_INTERVAL_MS on the main
+ * thread and an event is sent only when one of them changed, carrying the whole state and the list of changed fields.
+ * The Android SDK reports no events, so the events list is always empty.
+ */
+final class ShenaiStateStream implements EventChannel.StreamHandler, Runnable {
+
+  // Field names in ShenaiStateField order, the "changed" list holds indices into it
+  private static final String[] STATE_KEYS = {
+    "measurementState", "faceState", "normalizedFaceBbox", "measurementProgressPercentage", "heartRate4s",
+    "signalQuality",
+  };
+  private static final int SIGNAL_QUALITY_FIELD = 5;
+
+  // fast enough for progress and face guidance UIs
+  private static final long POLL_INTERVAL_MS = 100;
+  // smaller signal quality changes are not reported, the metric moves a little on almost every frame
+  private static final double SIGNAL_QUALITY_THRESHOLD = 0.1;
+
+  private final Handler handler = new Handler(Looper.getMainLooper());
+
+  private final Pigeon.ShenaiSdkNativeApi api;
+  private @Nullable EventChannel.EventSink sink;
+  private @Nullable Object[] state;  // last sent value of every field
+
+  ShenaiStateStream(@NonNull Pigeon.ShenaiSdkNativeApi api) {
+    this.api = api;
+  }
+
+  @Override
+  public void onListen(Object arguments, EventChannel.EventSink events) {
+    sink = events;
+    state = null;
+    handler.post(this);
+  }
+
+  @Override
+  public void onCancel(Object arguments) {
+    handler.removeCallbacks(this);
+    sink = null;
+  }
+
+  @Override
+  public void run() {
+    if (sink == null) {
+      return;
+    }
+    handler.postDelayed(this, POLL_INTERVAL_MS);
+
+    Object[] current = currentState();
+    if (current == null) {
+      return;
+    }
+    // below the threshold the last sent value is kept, so small steps can't add up unnoticed
+    Object lastQuality = state != null ? state[SIGNAL_QUALITY_FIELD] : null;
+    Object quality = current[SIGNAL_QUALITY_FIELD];
+    if (lastQuality instanceof Double && quality instanceof Double
+        && Math.abs((Double) quality - (Double) lastQuality) < SIGNAL_QUALITY_THRESHOLD) {
+      current[SIGNAL_QUALITY_FIELD] = lastQuality;
+    }
+    ArrayList<Long> changed = new ArrayList<>();
+    for (int field = 0; field < STATE_KEYS.length; ++field) {
+      if (state == null || !Objects.equals(state[field], current[field])) {
+        changed.add((long) field);
+      }
+    }
+    if (changed.isEmpty()) {
+      return;
+    }
+
+    HashMap<String, Object> message = new HashMap<>();
+    for (int field = 0; field < STATE_KEYS.length; ++field) {
+      message.put(STATE_KEYS[field], current[field]);
+    }
+    message.put("changed", changed);
+    message.put("events", new ArrayList<Long>());
+    state = current;
+    sink.success(message);
+  }
+
+  private @Nullable Object[] currentState() {
+    if (!Boolean.TRUE.equals(api.isInitialized())) {
+      return null;
+    }
+    Pigeon.NormalizedFaceBbox bbox = api.getNormalizedFaceBbox();
+    List<Double> bboxValues =
+        bbox == null ? null : Arrays.asList(bbox.getX(), bbox.getY(), bbox.getWidth(), bbox.getHeight());
+    return new Object[] {
+      (long) api.getMeasurementState().getState().index,
+      (long) api.getFaceState().getState().index,
+      bboxValues,
+      api.getMeasurementProgressPercentage(),
+      api.getHeartRate4s(),
+      api.getCurrentSignalQualityMetric(),
+    };
+  }
+}
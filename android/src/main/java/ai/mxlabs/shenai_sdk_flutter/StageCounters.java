@@ -0,0 +1,137 @@
+package ai.mxlabs.shenai_sdk_flutter;
+
+import android.os.Process;
+import android.os.SystemClock;
+import androidx.annotation.NonNull;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicLongArray;
+
+/**
+ * Lock-free latency counters of the plugin stages, mirroring ios/Classes/performance/stage_counters.
+ * Every call lands in a histogram with four buckets per octave of microseconds, so percentiles are accurate to
+ * about 19%; recording costs two clock reads and a handful of atomic operations.
+ */
+final class StageCounters {
+
+  // In Pigeon.PerformanceStats field order
+  enum Stage { INITIALIZE, STATE_SNAPSHOT, IMAGE_EXPORT, SIGNAL_EXPORT, HEALTH_RISKS }
+
+  private static final int BUCKETS_PER_OCTAVE = 4;
+  private static final int BUCKETS = 1 + 28 * BUCKETS_PER_OCTAVE;
+
+  private static final Counters[] COUNTERS = new Counters[Stage.values().length];
+  private static final AtomicLong windowStartNanos = new AtomicLong(SystemClock.elapsedRealtimeNanos());
+  private static final AtomicLong windowStartCpuMs = new AtomicLong(Process.getElapsedCpuTime());
+
+  static {
+    for (int i = 0; i < COUNTERS.length; ++i) {
+      COUNTERS[i] = new Counters();
+    }
+  }
+
+  private StageCounters() {}
+
+  /** Records the time until close() as one call of the stage, meant for try-with-resources. */
+  static final class Scope implements AutoCloseable {
+    private final Counters counters;
+    private final long started;
+
+    private Scope(Counters counters) {
+      this.counters = counters;
+      long inFlight = counters.inFlight.incrementAndGet();
+      counters.maxInFlight.accumulateAndGet(inFlight, Math::max);
+      this.started = System.nanoTime();
+    }
+
+    @Override
+    public void close() {
+      long nanos = System.nanoTime() - started;
+      counters.buckets.incrementAndGet(bucketOf(nanos / 1000));
+      counters.maxNanos.accumulateAndGet(nanos, Math::max);
+      counters.inFlight.decrementAndGet();
+    }
+  }
+
+  static Scope start(@NonNull Stage stage) {
+    return new Scope(COUNTERS[stage.ordinal()]);
+  }
+
+  /** Stats since the last reset (or since the plugin was loaded), optionally starting a new window. */
+  static Pigeon.PerformanceStats stats(boolean reset) {
+    long now = SystemClock.elapsedRealtimeNanos();
+    long cpu = Process.getElapsedCpuTime();
+    long windowStart = reset ? windowStartNanos.getAndSet(now) : windowStartNanos.get();
+    long windowStartCpu = reset ? windowStartCpuMs.getAndSet(cpu) : windowStartCpuMs.get();
+
+    Pigeon.PerformanceStats.Builder builder = new Pigeon.PerformanceStats.Builder();
+    builder.setWindowSec((now - windowStart) / 1e9);
+    // CPU time of the whole process, SDK processing threads included
+    builder.setCpuTimeMs((double) (cpu - windowStartCpu));
+    builder.setInitialize(COUNTERS[Stage.INITIALIZE.ordinal()].stats(reset));
+    builder.setStateSnapshot(COUNTERS[Stage.STATE_SNAPSHOT.ordinal()].stats(reset));
+    builder.setImageExport(COUNTERS[Stage.IMAGE_EXPORT.ordinal()].stats(reset));
+    builder.setSignalExport(COUNTERS[Stage.SIGNAL_EXPORT.ordinal()].stats(reset));
+    builder.setHealthRisks(COUNTERS[Stage.HEALTH_RISKS.ordinal()].stats(reset));
+    return builder.build();
+  }
+
+  private static int bucketOf(long micros) {
+    if (micros <= 0) {
+      return 0;
+    }
+    int octave = 63 - Long.numberOfLeadingZeros(micros);
+    // the two bits below the leading one pick the quarter of the octave
+    long quarter = octave >= 2 ? (micros >> (octave - 2)) & 3 : (micros << (2 - octave)) & 3;
+    return (int) Math.min(BUCKETS - 1, 1 + (long) octave * BUCKETS_PER_OCTAVE + quarter);
+  }
+
+  private static double bucketUpperBoundMs(int bucket) {
+    if (bucket == 0) {
+      return 0.001;
+    }
+    int octave = (bucket - 1) / BUCKETS_PER_OCTAVE;
+    int quarter = (bucket - 1) % BUCKETS_PER_OCTAVE;
+    return (double) (1L << octave) * (1.0 + (quarter + 1) / (double) BUCKETS_PER_OCTAVE) / 1000.0;
+  }
+
+  private static final class Counters {
+    final AtomicLongArray buckets = new AtomicLongArray(BUCKETS);
+    final AtomicLong maxNanos = new AtomicLong();
+    final AtomicLong inFlight = new AtomicLong();
+    final AtomicLong maxInFlight = new AtomicLong();
+
+    Pigeon.StagePerformance stats(boolean reset) {
+      long[] counts = new long[BUCKETS];
+      long count = 0;
+      for (int bucket = 0; bucket < BUCKETS; ++bucket) {
+        counts[bucket] = reset ? buckets.getAndSet(bucket, 0) : buckets.get(bucket);
+        count += counts[bucket];
+      }
+      double maxMs = (reset ? maxNanos.getAndSet(0) : maxNanos.get()) / 1e6;
+      long maxConcurrent = reset ? maxInFlight.getAndSet(inFlight.get()) : maxInFlight.get();
+
+      Pigeon.StagePerformance.Builder builder = new Pigeon.StagePerformance.Builder();
+      builder.setCount(count);
+      builder.setP50Ms(percentile(counts, count, 0.50, maxMs));
+      builder.setP95Ms(percentile(counts, count, 0.95, maxMs));
+      builder.setMaxMs(maxMs);
+      builder.setMaxInFlight(maxConcurrent);
+      return builder.build();
+    }
+
+    private static double percentile(long[] counts, long count, double fraction, double maxMs) {
+      if (count == 0) {
+        return 0.0;
+      }
+      long rank = (long) (fraction * (count - 1));
+      long seen = 0;
+      for (int bucket = 0; bucket < BUCKETS; ++bucket) {
+        seen += counts[bucket];
+        if (seen > rank) {
+          return Math.min(bucketUpperBoundMs(bucket), maxMs);
+        }
+      }
+      return maxMs;
+    }
+  }
+}
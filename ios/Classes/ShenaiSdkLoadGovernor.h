@@ -0,0 +1,24 @@
+#import <Foundation/Foundation.h>
+
+#import "pigeon.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Degrades the SDK overlays in steps while display frames run late or the SDK reports it is overloaded, and
+/// restores them once there is headroom again, never going below the configured floor.
+/// Main thread only; the overlays the app asks for go through it while it runs.
+@interface ShenaiSdkLoadGovernor : NSObject
+
+- (instancetype)initWithFloor:(QualityTier)floor showFaceMask:(BOOL)showFaceMask showBloodFlow:(BOOL)showBloodFlow;
+
+- (void)start;
+- (void)stop;
+
+@property(nonatomic, readonly) QualityTier tier;
+/// Overlays requested by the app, shown whenever the current tier allows them.
+@property(nonatomic) BOOL showFaceMask;
+@property(nonatomic) BOOL showBloodFlow;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,72 @@
+extern "C" {
+#import "pigeon.h"
+}
+#import "ShenaiSdkLoadGovernor.h"
+
+#import <QuartzCore/QuartzCore.h>
+#import <ShenaiSDK/shenai_api_cpp.h>
+
+#include <optional>
+
+#include "performance/load_governor.h"
+
+@implementation ShenaiSdkLoadGovernor {
+  std::optional<mx::performance::LoadGovernor> _governor;
+  CADisplayLink *_displayLink;
+  CFTimeInterval _lastTimestamp;
+}
+
+- (instancetype)initWithFloor:(QualityTier)floor showFaceMask:(BOOL)showFaceMask showBloodFlow:(BOOL)showBloodFlow {
+  self = [super init];
+  if (self) {
+    _governor.emplace(mx::performance::LoadGovernorOptions{.floor = static_cast<mx::performance::QualityTier>(floor)});
+    _showFaceMask = showFaceMask;
+    _showBloodFlow = showBloodFlow;
+  }
+  return self;
+}
+
+- (QualityTier)tier {
+  return static_cast<QualityTier>(_governor->tier());
+}
+
+- (void)setShowFaceMask:(BOOL)showFaceMask {
+  _showFaceMask = showFaceMask;
+  [self applyTier];
+}
+
+- (void)setShowBloodFlow:(BOOL)showBloodFlow {
+  _showBloodFlow = showBloodFlow;
+  [self applyTier];
+}
+
+- (void)start {
+  _lastTimestamp = 0;
+  _displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(onFrame:)];
+  [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (void)stop {
+  [_displayLink invalidate];
+  _displayLink = nil;
+}
+
+- (void)applyTier {
+  const QualityTier tier = self.tier;
+  shen::SetShowBloodFlow(_showBloodFlow && tier < QualityTierReducedOverlays);
+  shen::SetShowFaceMask(_showFaceMask && tier < QualityTierMinimalOverlays);
+}
+
+- (void)onFrame:(CADisplayLink *)displayLink {
+  const CFTimeInterval interval = _lastTimestamp > 0 ? displayLink.timestamp - _lastTimestamp : 0;
+  _lastTimestamp = displayLink.timestamp;
+  if (interval <= 0 || !shen::IsInitialized()) {
+    return;
+  }
+  const bool overloaded = shen::GetOperatingMode() == shen::OperatingMode::SystemOverloaded;
+  if (_governor->onFrame(interval, displayLink.targetTimestamp - displayLink.timestamp, overloaded)) {
+    [self applyTier];
+  }
+}
+
+@end
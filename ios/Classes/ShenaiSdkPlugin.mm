@@ -3,20 +3,70 @@
 extern "C" {
 #import "pigeon.h"
 }
+#import "ShenaiSdkLoadGovernor.h"
+#import "ShenaiSdkStateStream.h"
+#import "shenai_c_api.h"
 
 #import <ShenaiSDK/health_risks.h>
 #import <ShenaiSDK/shenai_api_cpp.h>
-#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "health_risks/health_risks_bundle.h"
+#include "health_risks/health_risks_cache.h"
+#include "health_risks/health_risks_grid.h"
+#include "health_risks/health_risks_sensitivity.h"
+#include "health_risks/health_risks_uncertainty.h"
+#include "performance/stage_counters.h"
 
 @interface ShenFlutterApi : NSObject <ShenaiSdkNativeApi>
+@property(nonatomic, strong, nullable) ShenaiSdkStateStream *stateStream;
+// only touched on the main thread, nil while the SDK is not initialized or no quality floor was set
+@property(nonatomic, strong, nullable) ShenaiSdkLoadGovernor *loadGovernor;
+@property(nonatomic, strong, nullable) ShenaiSdkViewFactory *viewFactory;
 @end
 
-@implementation ShenFlutterApi
+namespace {
+
+struct SuspendedState {
+  shen::CameraMode camera_mode;
+  shen::Screen screen;
+  shen::OperatingMode operating_mode;
+};
+
+}  // namespace
+
+@implementation ShenFlutterApi {
+  std::shared_ptr<mx::health_risks::HealthRisksCache> _healthRisksCache;
+  // Lifecycle calls (initialize, deinitialize, suspend, resume) are received on the main thread in Dart call order
+  // and run one after another on this serial queue. Every other call keeps running on its own thread meanwhile:
+  // getters and setters reach the SDK while it initializes or deinitializes and see the state it is in at that
+  // moment, isInitialized answers false until initialize has completed.
+  dispatch_queue_t _lifecycleQueue;
+  // initialize requests received so far and the last one received before a cancelInitialization
+  std::atomic<uint64_t> _initializeRequests;
+  std::atomic<uint64_t> _cancelledInitializeRequests;
+  // what suspend changed, restored by resume; cleared by initialize and deinitialize
+  std::mutex _suspendMutex;
+  std::optional<SuspendedState> _suspendedState;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _lifecycleQueue = dispatch_queue_create("ai.mxlabs.shenai_sdk.lifecycle", DISPATCH_QUEUE_SERIAL);
+  }
+  return self;
+}
 
-- (nullable InitializeResponse *)initializeApiKey:(nonnull NSString *)apiKey
-                                           userId:(nonnull NSString *)userId
-                                         settings:(nullable InitializationSettings *)settings
-                                            error:(FlutterError *_Nullable *_Nonnull)error {
+- (void)initializeApiKey:(NSString *)apiKey
+                  userId:(NSString *)userId
+                settings:(nullable InitializationSettings *)settings
+              completion:(void (^)(InitializeResponse *_Nullable, FlutterError *_Nullable))completion {
   shen::initialization_settings settingsCpp;
   if (settings != nil) {
     if (settings.precisionMode != nil) {
@@ -60,18 +110,79 @@ extern "C" {
     }
   }
 
-  auto res = shen::Initialize(apiKey.UTF8String, userId.UTF8String, settingsCpp);
-  switch (res) {
+  // headless: nothing is drawn, so every overlay is off and the platform view is created empty
+  const BOOL headless = settings.headless != nil && [settings.headless boolValue];
+  if (headless) {
+    settingsCpp.showUserInterface = false;
+    settingsCpp.showFacePositioningOverlay = false;
+    settingsCpp.showVisualWarnings = false;
+    settingsCpp.showFaceMask = false;
+    settingsCpp.showBloodFlow = false;
+  }
+  const QualityTier qualityFloor =
+      settings.qualityFloor != nil && !headless ? settings.qualityFloor.value : QualityTierFull;
+
+  ShenaiSdkStateStream *stateStream = self.stateStream;
+  settingsCpp.eventCallback = [stateStream](shen::Event event) {
+    [stateStream addEvent:static_cast<NSInteger>(event)];
+  };
+
+  // numbered on receipt, in the same order as cancelInitialization: requests received before the latest cancel are
+  // skipped while they wait in the queue, or undone if they already started
+  const uint64_t request = ++_initializeRequests;
+  const auto enqueued = std::chrono::steady_clock::now();
+  dispatch_async(_lifecycleQueue, ^{
+    std::optional<shen::InitializationResult> res;
+    auto started = enqueued;
+    auto finished = enqueued;
+    if (request > self->_cancelledInitializeRequests.load()) {
+      [self clearSuspendedState];
+      mx::performance::ScopedStage stage(mx::performance::Stage::initialize);
+      started = std::chrono::steady_clock::now();
+      res = shen::Initialize(apiKey.UTF8String, userId.UTF8String, settingsCpp);
+      finished = std::chrono::steady_clock::now();
+      if (request <= self->_cancelledInitializeRequests.load()) {
+        if (*res == shen::InitializationResult::Success) {
+          shen::Deinitialize();
+        }
+        res.reset();
+      } else if (*res == shen::InitializationResult::Success) {
+        self.viewFactory.headless = headless;
+        [self replaceLoadGovernorWithFloor:qualityFloor
+                              showFaceMask:settingsCpp.showFaceMask
+                             showBloodFlow:settingsCpp.showBloodFlow];
+      }
+    }
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    InitializationTimings *timings =
+        [InitializationTimings makeWithQueuedMs:@(Milliseconds(started - enqueued).count())
+                                   initializeMs:@(Milliseconds(finished - started).count())];
+    completion([InitializeResponse makeWithResult:[self initializationResult:res] timings:timings], nil);
+  });
+}
+
+- (InitializationResult)initializationResult:(std::optional<shen::InitializationResult>)res {
+  if (!res) {
+    return InitializationResultCancelled;
+  }
+  switch (*res) {
     case shen::InitializationResult::Success:
-      return [InitializeResponse makeWithResult:InitializationResultSuccess];
+      return InitializationResultSuccess;
     case shen::InitializationResult::FailureInvalidApiKey:
-      return [InitializeResponse makeWithResult:InitializationResultFailInvalidApiKey];
+      return InitializationResultFailInvalidApiKey;
     case shen::InitializationResult::FailureConnectionError:
-      return [InitializeResponse makeWithResult:InitializationResultFailConnectionError];
+      return InitializationResultFailConnectionError;
     case shen::InitializationResult::FailureInternalError:
-      return [InitializeResponse makeWithResult:InitializationResultFailInternalError];
+      return InitializationResultFailInternalError;
   }
-  return nil;
+  return InitializationResultFailInternalError;
+}
+
+- (void)cancelInitializationWithCompletion:(void (^)(FlutterError *_Nullable))completion {
+  // not queued, it has to reach the initialize requests received before it while they wait or run
+  _cancelledInitializeRequests.store(_initializeRequests.load());
+  completion(nil);
 }
 
 - (nullable NSNumber *)isInitializedWithError:(FlutterError *_Nullable *_Nonnull)error {
@@ -79,10 +190,31 @@ extern "C" {
 }
 
 - (void)deinitializeWithCompletion:(void (^)(FlutterError *_Nullable))completion {
-  std::thread([completion]() {
+  dispatch_async(_lifecycleQueue, ^{
     shen::Deinitialize();
+    [self clearSuspendedState];
+    [self replaceLoadGovernorWithFloor:QualityTierFull showFaceMask:NO showBloodFlow:NO];
+    self.viewFactory.headless = NO;
     completion(nil);
-  }).detach();
+  });
+}
+
+// Replaces the running governor (none for a `full` floor). Called on the lifecycle queue and waits for the main
+// thread, so the governor is in place before initialize replies and setShowFaceMask/setShowBloodFlow, which run on
+// the main thread, can't slip in before it. The main thread never waits for the lifecycle queue.
+- (void)replaceLoadGovernorWithFloor:(QualityTier)floor
+                        showFaceMask:(BOOL)showFaceMask
+                       showBloodFlow:(BOOL)showBloodFlow {
+  dispatch_sync(dispatch_get_main_queue(), ^{
+    [self.loadGovernor stop];
+    self.loadGovernor = nil;
+    if (floor != QualityTierFull) {
+      self.loadGovernor = [[ShenaiSdkLoadGovernor alloc] initWithFloor:floor
+                                                          showFaceMask:showFaceMask
+                                                         showBloodFlow:showBloodFlow];
+      [self.loadGovernor start];
+    }
+  });
 }
 
 - (void)setOperatingModeMode:(OperatingMode)mode error:(FlutterError *_Nullable *_Nonnull)error {
@@ -153,6 +285,42 @@ extern "C" {
   }
   return nil;
 }
+- (void)clearSuspendedState {
+  std::lock_guard<std::mutex> lock(_suspendMutex);
+  _suspendedState.reset();
+}
+- (void)suspendWithCompletion:(void (^)(FlutterError *_Nullable))completion {
+  dispatch_async(_lifecycleQueue, ^{
+    // the camera and frame processing stop with the camera, models and license stay loaded
+    std::lock_guard<std::mutex> lock(self->_suspendMutex);
+    if (!self->_suspendedState && shen::IsInitialized()) {
+      self->_suspendedState = SuspendedState{
+          .camera_mode = shen::GetCameraMode(),
+          .screen = shen::GetScreen(),
+          .operating_mode = shen::GetOperatingMode(),
+      };
+      shen::SetCameraMode(shen::CameraMode::Off);
+    }
+    completion(nil);
+  });
+}
+- (void)resumeWithCompletion:(void (^)(FlutterError *_Nullable))completion {
+  dispatch_async(_lifecycleQueue, ^{
+    std::lock_guard<std::mutex> lock(self->_suspendMutex);
+    if (self->_suspendedState) {
+      shen::SetCameraMode(self->_suspendedState->camera_mode);
+      shen::SetScreen(self->_suspendedState->screen);
+      shen::SetOperatingMode(self->_suspendedState->operating_mode);
+      self->_suspendedState.reset();
+    }
+    completion(nil);
+  });
+}
+/// @return `nil` only when `error != nil`.
+- (nullable NSNumber *)isSuspendedWithError:(FlutterError *_Nullable *_Nonnull)error {
+  std::lock_guard<std::mutex> lock(_suspendMutex);
+  return @(_suspendedState.has_value());
+}
 - (void)setShowUserInterfaceShow:(NSNumber *)show error:(FlutterError *_Nullable *_Nonnull)error {
   shen::SetShowUserInterface([show boolValue]);
 }
@@ -182,6 +350,10 @@ extern "C" {
   return @(shen::GetEnableCameraSwap());
 }
 - (void)setShowFaceMaskShow:(NSNumber *)show error:(FlutterError *_Nullable *_Nonnull)error {
+  if (self.loadGovernor != nil) {
+    self.loadGovernor.showFaceMask = [show boolValue];
+    return;
+  }
   shen::SetShowFaceMask([show boolValue]);
 }
 /// @return `nil` only when `error != nil`.
@@ -189,12 +361,21 @@ extern "C" {
   return @(shen::GetShowFaceMask());
 }
 - (void)setShowBloodFlowShow:(NSNumber *)show error:(FlutterError *_Nullable *_Nonnull)error {
+  if (self.loadGovernor != nil) {
+    self.loadGovernor.showBloodFlow = [show boolValue];
+    return;
+  }
   shen::SetShowBloodFlow([show boolValue]);
 }
 /// @return `nil` only when `error != nil`.
 - (nullable NSNumber *)getShowBloodFlowWithError:(FlutterError *_Nullable *_Nonnull)error {
   return @(shen::GetShowBloodFlow());
 }
+/// @return `nil` only when `error != nil`.
+- (nullable QualityTierResponse *)getQualityTierWithError:(FlutterError *_Nullable *_Nonnull)error {
+  ShenaiSdkLoadGovernor *governor = self.loadGovernor;
+  return [QualityTierResponse makeWithTier:governor != nil ? governor.tier : QualityTierFull];
+}
 
 - (void)setEnableStartAfterSuccessEnable:(NSNumber *)enable error:(FlutterError *_Nullable *_Nonnull)error {
   shen::SetEnableStartAfterSuccess([enable boolValue]);
@@ -272,6 +453,42 @@ extern "C" {
   }
   return @(*hr);
 }
+/// @return `nil` only when `error != nil`.
+- (nullable StateSnapshot *)getStateSnapshotWithError:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::state_snapshot);
+  // one message instead of a getter round trip per field, read through the same C layer as the dart:ffi getters
+  ShenaiStateSnapshot snapshot = shenai_get_state_snapshot();
+  NormalizedFaceBbox *bbox = nil;
+  if (snapshot.normalized_face_bbox.present) {
+    const auto &box = snapshot.normalized_face_bbox;
+    bbox = [NormalizedFaceBbox makeWithX:@(box.x) y:@(box.y) width:@(box.width) height:@(box.height)];
+  }
+  return [StateSnapshot makeWithFaceState:static_cast<FaceState>(snapshot.face_state)
+                       normalizedFaceBbox:bbox
+                         measurementState:static_cast<MeasurementState>(snapshot.measurement_state)
+            measurementProgressPercentage:@(snapshot.measurement_progress_percentage)
+                              heartRate4s:snapshot.heart_rate_4s.present ? @(snapshot.heart_rate_4s.value) : nil
+                             heartRate10s:snapshot.heart_rate_10s.present ? @(snapshot.heart_rate_10s.value) : nil
+                            signalQuality:@(snapshot.signal_quality)
+                    totalBadSignalSeconds:@(snapshot.total_bad_signal_seconds)];
+}
+- (Heartbeats *)createHeartbeats:(const shen::heartbeat *)heartbeats count:(NSUInteger)count {
+  // parallel buffers instead of one boxed object per beat
+  NSMutableData *starts = [NSMutableData dataWithLength:count * sizeof(double)];
+  NSMutableData *ends = [NSMutableData dataWithLength:count * sizeof(double)];
+  NSMutableData *durations = [NSMutableData dataWithLength:count * sizeof(double)];
+  auto *startsData = static_cast<double *>(starts.mutableBytes);
+  auto *endsData = static_cast<double *>(ends.mutableBytes);
+  auto *durationsData = static_cast<double *>(durations.mutableBytes);
+  for (NSUInteger i = 0; i < count; ++i) {
+    startsData[i] = heartbeats[i].start_location_sec;
+    endsData[i] = heartbeats[i].end_location_sec;
+    durationsData[i] = heartbeats[i].duration_ms;
+  }
+  return [Heartbeats makeWithStartLocationsSec:[FlutterStandardTypedData typedDataWithFloat64:starts]
+                               endLocationsSec:[FlutterStandardTypedData typedDataWithFloat64:ends]
+                                   durationsMs:[FlutterStandardTypedData typedDataWithFloat64:durations]];
+}
 - (nullable MeasurementResults *)getRealtimeMetricsPeriod_sec:(NSNumber *)period_sec
                                                         error:(FlutterError *_Nullable *_Nonnull)error {
   float period_float = [period_sec floatValue];
@@ -280,14 +497,6 @@ extern "C" {
     return nil;
   }
 
-  NSMutableArray<Heartbeat *> *heartbeats = [NSMutableArray array];
-  for (int i = 0; i < res->heartbeats.size(); i++) {
-    const auto &hb = res->heartbeats[i];
-    [heartbeats addObject:[Heartbeat makeWithStart_location_sec:@(hb.start_location_sec)
-                                               end_location_sec:@(hb.end_location_sec)
-                                                    duration_ms:@(hb.duration_ms)]];
-  }
-
   return [MeasurementResults
              makeWithHeart_rate_bpm:@(res->heart_rate_bpm)
                         hrv_sdnn_ms:res->hrv_sdnn_ms ? @(*res->hrv_sdnn_ms) : nil
@@ -296,7 +505,7 @@ extern "C" {
                  breathing_rate_bpm:res->breathing_rate_bpm ? @(*res->breathing_rate_bpm) : nil
        systolic_blood_pressure_mmhg:res->systolic_blood_pressure_mmhg ? @(*res->systolic_blood_pressure_mmhg) : nil
       diastolic_blood_pressure_mmhg:res->diastolic_blood_pressure_mmhg ? @(*res->diastolic_blood_pressure_mmhg) : nil
-                         heartbeats:heartbeats
+                         heartbeats:[self createHeartbeats:res->heartbeats.data() count:res->heartbeats.size()]
              average_signal_quality:@(res->average_signal_quality)];
 }
 - (nullable MeasurementResults *)getMeasurementResultsWithError:(FlutterError *_Nullable *_Nonnull)error {
@@ -305,14 +514,6 @@ extern "C" {
     return nil;
   }
 
-  NSMutableArray<Heartbeat *> *heartbeats = [NSMutableArray array];
-  for (int i = 0; i < res->heartbeats.size(); i++) {
-    const auto &hb = res->heartbeats[i];
-    [heartbeats addObject:[Heartbeat makeWithStart_location_sec:@(hb.start_location_sec)
-                                               end_location_sec:@(hb.end_location_sec)
-                                                    duration_ms:@(hb.duration_ms)]];
-  }
-
   return [MeasurementResults
              makeWithHeart_rate_bpm:@(res->heart_rate_bpm)
                         hrv_sdnn_ms:res->hrv_sdnn_ms ? @(*res->hrv_sdnn_ms) : nil
@@ -321,7 +522,7 @@ extern "C" {
                  breathing_rate_bpm:res->breathing_rate_bpm ? @(*res->breathing_rate_bpm) : nil
        systolic_blood_pressure_mmhg:res->systolic_blood_pressure_mmhg ? @(*res->systolic_blood_pressure_mmhg) : nil
       diastolic_blood_pressure_mmhg:res->diastolic_blood_pressure_mmhg ? @(*res->diastolic_blood_pressure_mmhg) : nil
-                         heartbeats:heartbeats
+                         heartbeats:[self createHeartbeats:res->heartbeats.data() count:res->heartbeats.size()]
              average_signal_quality:@(res->average_signal_quality)];
 }
 - (void)setRecordingEnabledEnabled:(NSNumber *)enabled error:(FlutterError *_Nullable *_Nonnull)error {
@@ -341,6 +542,7 @@ extern "C" {
 }
 
 - (nullable FlutterStandardTypedData *)getSignalQualityMapPngWithError:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::image_export);
   std::vector<uint8_t> res = shen::GetSignalQualityMapPng();
   if (res.empty()) {
     return nil;
@@ -349,6 +551,7 @@ extern "C" {
 }
 
 - (nullable FlutterStandardTypedData *)getFaceTexturePngWithError:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::image_export);
   std::vector<uint8_t> res = shen::GetFaceTexturePng();
   if (res.empty()) {
     return nil;
@@ -357,21 +560,73 @@ extern "C" {
 }
 
 - (nullable FlutterStandardTypedData *)getFullPpgSignalWithError:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::signal_export);
   std::vector<float> res = shen::GetFullPPGSignal();
   if (res.empty()) {
     return nil;
   }
 
-  // Convert std::vector<float> to std::vector<double>
-  std::vector<double> resDouble(res.begin(), res.end());
+  // Hand the vector's buffer over to NSData instead of copying it, the codec serializes it as is. The floats go as
+  // raw bytes, Dart views them as a Float32List.
+  auto *signal = new std::vector<float>(std::move(res));
+  NSData *data = [[NSData alloc] initWithBytesNoCopy:signal->data()
+                                              length:signal->size() * sizeof(float)
+                                         deallocator:^(void *, NSUInteger) {
+                                           delete signal;
+                                         }];
+  return [FlutterStandardTypedData typedDataWithBytes:data];
+}
+
+- (HeartRateHistory *)createHeartRateHistory:(const std::vector<shen::momentary_hr_value> &)history
+                                    sinceSec:(nullable NSNumber *)sinceSec {
+  // history is ordered by time, only entries after the cursor are sent
+  auto begin = history.begin();
+  if (sinceSec != nil) {
+    const double since = [sinceSec doubleValue];
+    begin = std::partition_point(history.begin(), history.end(),
+                                 [since](const shen::momentary_hr_value &value) { return value.timestamp_sec <= since; });
+  }
+  const auto count = static_cast<NSUInteger>(history.end() - begin);
+  NSMutableData *timestamps = [NSMutableData dataWithLength:count * sizeof(double)];
+  NSMutableData *heartRates = [NSMutableData dataWithLength:count * sizeof(int32_t)];
+  auto *timestampsData = static_cast<double *>(timestamps.mutableBytes);
+  auto *heartRatesData = static_cast<int32_t *>(heartRates.mutableBytes);
+  for (NSUInteger i = 0; i < count; ++i, ++begin) {
+    timestampsData[i] = begin->timestamp_sec;
+    heartRatesData[i] = begin->hr_bpm;
+  }
+  return [HeartRateHistory makeWithTimestampsSec:[FlutterStandardTypedData typedDataWithFloat64:timestamps]
+                                   heartRatesBpm:[FlutterStandardTypedData typedDataWithInt32:heartRates]];
+}
 
-  // Convert std::vector<double> to NSData
-  NSData *data = [NSData dataWithBytes:resDouble.data() length:resDouble.size() * sizeof(double)];
+/// @return `nil` only when `error != nil`.
+- (nullable HeartRateHistory *)getHeartRateHistory10sSinceSec:(nullable NSNumber *)sinceSec
+                                                        error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::signal_export);
+  return [self createHeartRateHistory:shen::GetHeartRateHistory10s() sinceSec:sinceSec];
+}
 
-  // Then convert NSData to FlutterStandardTypedData
-  FlutterStandardTypedData *typedData = [FlutterStandardTypedData typedDataWithFloat64:data];
+/// @return `nil` only when `error != nil`.
+- (nullable HeartRateHistory *)getHeartRateHistory4sSinceSec:(nullable NSNumber *)sinceSec
+                                                       error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::signal_export);
+  return [self createHeartRateHistory:shen::GetHeartRateHistory4s() sinceSec:sinceSec];
+}
 
-  return typedData;
+/// @return `nil` only when `error != nil`.
+- (nullable Heartbeats *)getRealtimeHeartbeatsSinceSec:(nullable NSNumber *)sinceSec
+                                                 error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::signal_export);
+  std::vector<shen::heartbeat> heartbeats = shen::GetRealtimeHeartbeats();
+  // heartbeats are ordered by time, only the ones ending after the cursor are sent
+  auto begin = heartbeats.begin();
+  if (sinceSec != nil) {
+    const double since = [sinceSec doubleValue];
+    begin = std::partition_point(heartbeats.begin(), heartbeats.end(),
+                                 [since](const shen::heartbeat &beat) { return beat.end_location_sec <= since; });
+  }
+  return [self createHeartbeats:heartbeats.data() + (begin - heartbeats.begin())
+                          count:static_cast<NSUInteger>(heartbeats.end() - begin)];
 }
 
 - (nullable NSString *)getTraceIDWithError:(FlutterError *_Nullable *_Nonnull)error {
@@ -466,8 +721,10 @@ std::optional<T> boxedEnumToOptional(S *boxed) {
 /// @return `nil` only when `error != nil`.
 - (nullable HealthRisks *)computeHealthRisksHealthRisksFactors:(RisksFactors *)healthRisksFactors
                                                          error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::health_risks);
   mx::health_risks::RisksFactors factors = [self convertToRisksFactors:healthRisksFactors];
-  auto risks = mx::health_risks::computeHealthRisks(factors);
+  auto cache = std::atomic_load(&_healthRisksCache);
+  auto risks = cache ? cache->compute(factors) : mx::health_risks::computeHealthRisks(factors);
 
   return [self createHealthRisksFromRisks:risks];
 }
@@ -475,6 +732,7 @@ std::optional<T> boxedEnumToOptional(S *boxed) {
 /// @return `nil` only when `error != nil`.
 - (nullable HealthRisks *)getMinimalHealthRisksHealthRisksFactors:(RisksFactors *)healthRisksFactors
                                                             error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::health_risks);
   mx::health_risks::RisksFactors factors = [self convertToRisksFactors:healthRisksFactors];
   auto risks = mx::health_risks::getMinimalRisks(factors);
 
@@ -483,12 +741,148 @@ std::optional<T> boxedEnumToOptional(S *boxed) {
 /// @return `nil` only when `error != nil`.
 - (nullable HealthRisks *)getMaximalHealthRisksHealthRisksFactors:(RisksFactors *)healthRisksFactors
                                                             error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::health_risks);
   mx::health_risks::RisksFactors factors = [self convertToRisksFactors:healthRisksFactors];
   auto risks = mx::health_risks::getMaximalRisks(factors);
 
   return [self createHealthRisksFromRisks:risks];
 }
 
+/// @return `nil` only when `error != nil`.
+- (nullable HealthRisksBundle *)computeHealthRisksBundleHealthRisksFactors:(RisksFactors *)healthRisksFactors
+                                                                     error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::health_risks);
+  mx::health_risks::RisksFactors factors = [self convertToRisksFactors:healthRisksFactors];
+  auto bundle = mx::health_risks::computeHealthRisksBundle(factors);
+
+  return [HealthRisksBundle makeWithActual:[self createHealthRisksFromRisks:bundle.actual]
+                                   minimal:[self createHealthRisksFromRisks:bundle.minimal]
+                                   maximal:[self createHealthRisksFromRisks:bundle.maximal]];
+}
+
+/// @return `nil` only when `error != nil`.
+- (nullable HealthRisksSensitivity *)computeHealthRisksSensitivityHealthRisksFactors:(RisksFactors *)healthRisksFactors
+                                                                               error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::health_risks);
+  mx::health_risks::RisksFactors factors = [self convertToRisksFactors:healthRisksFactors];
+  auto sensitivity = mx::health_risks::computeHealthRisksSensitivity(factors);
+
+  NSMutableArray<RiskFactorSensitivity *> *sensitivities =
+      [NSMutableArray arrayWithCapacity:sensitivity.factors.size()];
+  for (const auto &factor : sensitivity.factors) {
+    [sensitivities addObject:[RiskFactorSensitivity makeWithFactor:static_cast<ModifiableRiskFactor>(factor.factor)
+                                                              step:@(factor.step)
+                                                             delta:[self createHealthRisksFromRisks:factor.delta]]];
+  }
+  return [HealthRisksSensitivity makeWithRisks:[self createHealthRisksFromRisks:sensitivity.risks]
+                                 sensitivities:sensitivities];
+}
+
+- (mx::health_risks::GridAxis)convertToGridAxis:(HealthRisksGridAxis *)axis {
+  return {
+      .factor = static_cast<mx::health_risks::GridFactor>(axis.factor),
+      .min = [axis.min floatValue],
+      .max = [axis.max floatValue],
+      .steps = static_cast<uint32_t>([axis.steps unsignedIntValue]),
+  };
+}
+
+/// @return `nil` only when `error != nil`.
+- (nullable FlutterStandardTypedData *)computeHealthRisksGridBaseFactors:(RisksFactors *)baseFactors
+                                                                   xAxis:(HealthRisksGridAxis *)xAxis
+                                                                   yAxis:(HealthRisksGridAxis *)yAxis
+                                                                  metric:(HealthRisksMetric)metric
+                                                                   error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::health_risks);
+  const long long columns = [xAxis.steps longLongValue];
+  const long long rows = [yAxis.steps longLongValue];
+  if (columns < 0 || rows < 0 || columns > mx::health_risks::kMaxGridAxisSteps ||
+      rows > mx::health_risks::kMaxGridAxisSteps || columns * rows > (long long)mx::health_risks::kMaxGridCells) {
+    NSString *message =
+        [NSString stringWithFormat:@"grid axes take 0 to %u steps and %zu cells in total, got %lld x %lld",
+                                   mx::health_risks::kMaxGridAxisSteps, mx::health_risks::kMaxGridCells, columns, rows];
+    *error = [FlutterError errorWithCode:@"invalid-argument" message:message details:nil];
+    return nil;
+  }
+  std::vector<float> values = mx::health_risks::computeHealthRisksGrid(
+      [self convertToRisksFactors:baseFactors], [self convertToGridAxis:xAxis], [self convertToGridAxis:yAxis],
+      static_cast<mx::health_risks::HealthRisksMetric>(metric));
+
+  NSData *data = [NSData dataWithBytes:values.data() length:values.size() * sizeof(float)];
+  return [FlutterStandardTypedData typedDataWithBytes:data];
+}
+
+/// @return `nil` only when `error != nil`.
+- (nullable HealthRisksInterval *)computeHealthRisksUncertaintyHealthRisksFactors:(RisksFactors *)healthRisksFactors
+                                                                      uncertainty:(RisksFactorsUncertainty *)uncertainty
+                                                                          samples:(NSNumber *)samples
+                                                                             seed:(NSNumber *)seed
+                                                                            error:(FlutterError *_Nullable *_Nonnull)error {
+  mx::performance::ScopedStage stage(mx::performance::Stage::health_risks);
+  if ([samples longLongValue] < 1 || [samples longLongValue] > mx::health_risks::kMaxUncertaintySamples) {
+    NSString *message = [NSString stringWithFormat:@"samples must be between 1 and %u, got %lld",
+                                                   mx::health_risks::kMaxUncertaintySamples, [samples longLongValue]];
+    *error = [FlutterError errorWithCode:@"invalid-argument" message:message details:nil];
+    return nil;
+  }
+  mx::health_risks::RisksFactorsUncertainty deviations{
+      .sbp = [uncertainty.sbp floatValue],
+      .cholesterol = [uncertainty.cholesterol floatValue],
+      .cholesterol_hdl = [uncertainty.cholesterolHdl floatValue],
+      .body_height = [uncertainty.bodyHeight floatValue],
+      .body_weight = [uncertainty.bodyWeight floatValue],
+  };
+  mx::health_risks::UncertaintyOptions options;
+  options.samples = [samples unsignedIntValue];
+  options.seed = [seed unsignedLongLongValue];
+
+  auto interval = mx::health_risks::computeHealthRisksUncertainty([self convertToRisksFactors:healthRisksFactors],
+                                                                  deviations, options);
+  return [HealthRisksInterval makeWithLower:[self createHealthRisksFromRisks:interval.lower]
+                                     median:[self createHealthRisksFromRisks:interval.median]
+                                      upper:[self createHealthRisksFromRisks:interval.upper]];
+}
+
+- (void)setHealthRisksCacheCapacityCapacity:(NSNumber *)capacity error:(FlutterError *_Nullable *_Nonnull)error {
+  // the cache is read from the health risks task queues, swap it atomically
+  long long entries = [capacity longLongValue];
+  std::shared_ptr<mx::health_risks::HealthRisksCache> cache;
+  if (entries > 0) {
+    cache = std::make_shared<mx::health_risks::HealthRisksCache>(static_cast<size_t>(entries));
+  }
+  std::atomic_store(&_healthRisksCache, cache);
+}
+
+/// @return `nil` only when `error != nil`.
+- (nullable HealthRisksCacheStats *)getHealthRisksCacheStatsWithError:(FlutterError *_Nullable *_Nonnull)error {
+  auto cache = std::atomic_load(&_healthRisksCache);
+  mx::health_risks::HealthRisksCacheStats stats = cache ? cache->stats() : mx::health_risks::HealthRisksCacheStats{};
+  return [HealthRisksCacheStats makeWithHits:@(stats.hits) misses:@(stats.misses)];
+}
+
+- (StagePerformance *)convertStageStats:(const mx::performance::StageStats &)stats {
+  return [StagePerformance makeWithCount:@(stats.count)
+                                   p50Ms:@(stats.p50_ms)
+                                   p95Ms:@(stats.p95_ms)
+                                   maxMs:@(stats.max_ms)
+                             maxInFlight:@(stats.max_in_flight)];
+}
+
+/// @return `nil` only when `error != nil`.
+- (nullable PerformanceStats *)getPerformanceStatsReset:(NSNumber *)reset
+                                                  error:(FlutterError *_Nullable *_Nonnull)error {
+  using mx::performance::Stage;
+  mx::performance::PerformanceStats stats = mx::performance::performanceStats([reset boolValue]);
+  const auto stage = [&stats](Stage which) { return stats.stages[static_cast<size_t>(which)]; };
+  return [PerformanceStats makeWithWindowSec:@(stats.window_sec)
+                                   cpuTimeMs:@(stats.cpu_time_ms)
+                                  initialize:[self convertStageStats:stage(Stage::initialize)]
+                               stateSnapshot:[self convertStageStats:stage(Stage::state_snapshot)]
+                                 imageExport:[self convertStageStats:stage(Stage::image_export)]
+                                signalExport:[self convertStageStats:stage(Stage::signal_export)]
+                                 healthRisks:[self convertStageStats:stage(Stage::health_risks)]];
+}
+
 - (void)setCustomMeasurementConfigConfig:(CustomMeasurementConfig *)config
                                    error:(FlutterError *_Nullable *_Nonnull)error {
   shen::custom_measurement_config cppConfig;
@@ -548,8 +942,13 @@ std::optional<T> boxedEnumToOptional(S *boxed) {
   ShenFlutterApi *api = [[ShenFlutterApi alloc] init];
   ShenaiSdkNativeApiSetup([registrar messenger], api);
 
-  ShenaiSdkViewFactory *factory = [[ShenaiSdkViewFactory alloc] initWithMessenger:[registrar messenger]];
-  [registrar registerViewFactory:factory withId:@"ShenaiSdkView"];
+  api.stateStream = [[ShenaiSdkStateStream alloc] initWithApi:api];
+  FlutterEventChannel *stateChannel = [FlutterEventChannel eventChannelWithName:@"shenai_sdk/state_changes"
+                                                                binaryMessenger:[registrar messenger]];
+  [stateChannel setStreamHandler:api.stateStream];
+
+  api.viewFactory = [[ShenaiSdkViewFactory alloc] initWithMessenger:[registrar messenger]];
+  [registrar registerViewFactory:api.viewFactory withId:@"ShenaiSdkView"];
 }
 
 @end
@@ -0,0 +1,20 @@
+#import <Flutter/Flutter.h>
+
+#import "pigeon.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Pushes SDK state changes to Dart over the "shenai_sdk/state_changes" event channel.
+/// While a listener is attached the state getters are sampled ten times a second on the main thread and an event
+/// is sent only when one of them changed or an SDK event arrived, carrying the whole state and the list of changed
+/// fields. Signal quality only counts as changed once it moved by 0.1 from the last sent value.
+@interface ShenaiSdkStateStream : NSObject <FlutterStreamHandler>
+
+- (instancetype)initWithApi:(NSObject<ShenaiSdkNativeApi> *)api;
+
+/// Queues an SDK event for the next frame, callable from any thread.
+- (void)addEvent:(NSInteger)event;
+
+@end
+
+NS_ASSUME_NONNULL_END
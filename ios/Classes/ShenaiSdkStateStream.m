@@ -0,0 +1,110 @@
+#import "ShenaiSdkStateStream.h"
+
+// Field names in ShenaiStateField order, the "changed" list holds indices into it
+static NSString *const kStateKeys[] = {
+    @"measurementState", @"faceState", @"normalizedFaceBbox", @"measurementProgressPercentage", @"heartRate4s",
+    @"signalQuality",
+};
+static const NSInteger kStateFieldCount = sizeof(kStateKeys) / sizeof(kStateKeys[0]);
+static const NSInteger kSignalQualityField = 5;
+
+// Polling rate of the getters, fast enough for progress and face guidance UIs
+static const NSInteger kPollsPerSecond = 10;
+// Smaller signal quality changes are not reported, the metric moves a little on almost every frame
+static const double kSignalQualityThreshold = 0.1;
+
+@implementation ShenaiSdkStateStream {
+  __weak NSObject<ShenaiSdkNativeApi> *_api;
+  FlutterEventSink _sink;
+  CADisplayLink *_displayLink;
+  NSArray *_state;  // last sent value of every field, NSNull when missing
+  NSMutableArray<NSNumber *> *_pendingEvents;
+}
+
+- (instancetype)initWithApi:(NSObject<ShenaiSdkNativeApi> *)api {
+  self = [super init];
+  if (self) {
+    _api = api;
+    _pendingEvents = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (FlutterError *_Nullable)onListenWithArguments:(id _Nullable)arguments eventSink:(FlutterEventSink)events {
+  _sink = events;
+  _state = nil;
+  _displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(onFrame:)];
+  _displayLink.preferredFramesPerSecond = kPollsPerSecond;
+  [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+  return nil;
+}
+
+- (FlutterError *_Nullable)onCancelWithArguments:(id _Nullable)arguments {
+  [_displayLink invalidate];
+  _displayLink = nil;
+  _sink = nil;
+  [_pendingEvents removeAllObjects];
+  return nil;
+}
+
+- (void)addEvent:(NSInteger)event {
+  dispatch_async(dispatch_get_main_queue(), ^{
+    if (self->_sink != nil) {
+      [self->_pendingEvents addObject:@(event)];
+    }
+  });
+}
+
+- (NSArray *)currentState {
+  NSObject<ShenaiSdkNativeApi> *api = _api;
+  FlutterError *error = nil;
+  if (api == nil || ![[api isInitializedWithError:&error] boolValue]) {
+    return nil;
+  }
+  NormalizedFaceBbox *bbox = [api getNormalizedFaceBboxWithError:&error];
+  id values[] = {
+      @([api getMeasurementStateWithError:&error].state),
+      @([api getFaceStateWithError:&error].state),
+      bbox != nil ? @[ bbox.x, bbox.y, bbox.width, bbox.height ] : [NSNull null],
+      [api getMeasurementProgressPercentageWithError:&error] ?: [NSNull null],
+      [api getHeartRate4sWithError:&error] ?: [NSNull null],
+      [api getCurrentSignalQualityMetricWithError:&error] ?: [NSNull null],
+  };
+  return [NSArray arrayWithObjects:values count:kStateFieldCount];
+}
+
+- (void)onFrame:(CADisplayLink *)displayLink {
+  NSMutableArray *state = [[self currentState] mutableCopy];
+  if (state == nil) {
+    return;
+  }
+  // below the threshold the last sent value is kept, so small steps can't add up unnoticed
+  id lastQuality = _state[kSignalQualityField];
+  id quality = state[kSignalQualityField];
+  if ([lastQuality isKindOfClass:[NSNumber class]] && [quality isKindOfClass:[NSNumber class]] &&
+      fabs([quality doubleValue] - [lastQuality doubleValue]) < kSignalQualityThreshold) {
+    state[kSignalQualityField] = lastQuality;
+  }
+
+  NSMutableArray<NSNumber *> *changed = [NSMutableArray array];
+  for (NSInteger field = 0; field < kStateFieldCount; ++field) {
+    if (_state == nil || ![_state[field] isEqual:state[field]]) {
+      [changed addObject:@(field)];
+    }
+  }
+  if (changed.count == 0 && _pendingEvents.count == 0) {
+    return;
+  }
+
+  NSMutableDictionary *message = [NSMutableDictionary dictionaryWithCapacity:kStateFieldCount + 2];
+  for (NSInteger field = 0; field < kStateFieldCount; ++field) {
+    message[kStateKeys[field]] = state[field];
+  }
+  message[@"changed"] = changed;
+  message[@"events"] = [_pendingEvents copy];
+  [_pendingEvents removeAllObjects];
+  _state = state;
+  _sink(message);
+}
+
+@end
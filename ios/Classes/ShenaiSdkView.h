@@ -2,6 +2,8 @@
 
 @interface ShenaiSdkViewFactory : NSObject <FlutterPlatformViewFactory>
 - (instancetype)initWithMessenger:(NSObject<FlutterBinaryMessenger>*)messenger;
+/// Set while the SDK runs headless: views are then created empty, without the SDK's render path.
+@property(atomic) BOOL headless;
 @end
 
 @interface ShenaiSdkView : NSObject <FlutterPlatformView>
@@ -9,7 +11,8 @@
 - (instancetype)initWithFrame:(CGRect)frame
                viewIdentifier:(int64_t)viewId
                     arguments:(id _Nullable)args
-              binaryMessenger:(NSObject<FlutterBinaryMessenger>*)messenger;
+              binaryMessenger:(NSObject<FlutterBinaryMessenger>*)messenger
+                     headless:(BOOL)headless;
 
 - (UIView*)view;
 @end
\ No newline at end of file
@@ -16,27 +16,37 @@
 - (NSObject<FlutterPlatformView>*)createWithFrame:(CGRect)frame
                                    viewIdentifier:(int64_t)viewId
                                         arguments:(id _Nullable)args {
-  return [[ShenaiSdkView alloc] initWithFrame:frame viewIdentifier:viewId arguments:args binaryMessenger:_messenger];
+  return [[ShenaiSdkView alloc] initWithFrame:frame
+                               viewIdentifier:viewId
+                                    arguments:args
+                              binaryMessenger:_messenger
+                                     headless:self.headless];
 }
 
 @end
 
 @implementation ShenaiSdkView {
   ShenaiView* _vc;
+  UIView* _emptyView;  // headless stand-in, no ShenaiView is created
 }
 
 - (instancetype)initWithFrame:(CGRect)frame
                viewIdentifier:(int64_t)viewId
                     arguments:(id _Nullable)args
-              binaryMessenger:(NSObject<FlutterBinaryMessenger>*)messenger {
+              binaryMessenger:(NSObject<FlutterBinaryMessenger>*)messenger
+                     headless:(BOOL)headless {
   if (self = [super init]) {
-    _vc = [[ShenaiView alloc] init];
+    if (headless) {
+      _emptyView = [[UIView alloc] initWithFrame:frame];
+    } else {
+      _vc = [[ShenaiView alloc] init];
+    }
   }
   return self;
 }
 
 - (UIView*)view {
-  return [_vc view];
+  return _vc != nil ? [_vc view] : _emptyView;
 }
 
 @end
@@ -0,0 +1,174 @@
+#include "health_risks_batch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace mx::health_risks {
+
+namespace {
+
+std::optional<float> floatAt(const float* column, std::size_t index) {
+  if (column == nullptr || std::isnan(column[index])) {
+    return std::nullopt;
+  }
+  return column[index];
+}
+
+std::optional<bool> flagAt(uint8_t flags, uint8_t known_bit, uint8_t value_bit) {
+  if ((flags & known_bit) == 0) {
+    return std::nullopt;
+  }
+  return (flags & value_bit) != 0;
+}
+
+void store(float* column, std::size_t index, const std::optional<float>& value) {
+  if (column != nullptr) {
+    column[index] = value ? *value : std::numeric_limits<float>::quiet_NaN();
+  }
+}
+
+void store(int32_t* column, std::size_t index, const std::optional<int>& value) {
+  if (column != nullptr) {
+    column[index] = value ? *value : kMissingInt;
+  }
+}
+
+// Fills `factors` with record `index`, reusing its country string when the code did not change
+void loadRisksFactors(const RisksFactorsColumns& columns, std::size_t index, RisksFactors& factors,
+                      uint16_t& loaded_country) {
+  factors.age = std::nullopt;
+  if (columns.age != nullptr && columns.age[index] != kMissingInt) {
+    factors.age = columns.age[index];
+  }
+  factors.cholesterol = floatAt(columns.cholesterol, index);
+  factors.cholesterol_hdl = floatAt(columns.cholesterol_hdl, index);
+  factors.sbp = floatAt(columns.sbp, index);
+  factors.body_height = floatAt(columns.body_height, index);
+  factors.body_weight = floatAt(columns.body_weight, index);
+
+  const uint8_t flags = columns.flags != nullptr ? columns.flags[index] : 0;
+  factors.is_smoker = flagAt(flags, kIsSmokerKnown, kIsSmoker);
+  factors.hypertension_treatment = flagAt(flags, kHypertensionTreatmentKnown, kHypertensionTreatment);
+  factors.has_diabetes = flagAt(flags, kHasDiabetesKnown, kHasDiabetes);
+
+  // bytes outside of the enums (kMissingCategory included) are missing values
+  factors.gender = std::nullopt;
+  if (columns.gender != nullptr && columns.gender[index] <= static_cast<uint8_t>(Gender::other)) {
+    factors.gender = static_cast<Gender>(columns.gender[index]);
+  }
+  factors.race = std::nullopt;
+  if (columns.race != nullptr && columns.race[index] <= static_cast<uint8_t>(Race::other)) {
+    factors.race = static_cast<Race>(columns.race[index]);
+  }
+
+  const uint16_t country = columns.country != nullptr ? columns.country[index] : kMissingCountry;
+  if (country != loaded_country) {
+    factors.country = decodeCountryCode(country);
+    loaded_country = country;
+  }
+}
+
+// Scores records [begin, end) of the batch
+void computeRange(const RisksFactorsColumns& input, const HealthRisksColumns& output, std::size_t begin,
+                  std::size_t end) {
+  RisksFactors factors;
+  uint16_t loaded_country = kMissingCountry;
+  for (std::size_t i = begin; i < end; ++i) {
+    loadRisksFactors(input, i, factors, loaded_country);
+    storeHealthRisks(computeHealthRisks(factors), output, i);
+  }
+}
+
+// Splits [0, count) into contiguous blocks and runs `range` on each of them in parallel
+template <typename Range>
+void runBatch(std::size_t count, const BatchOptions& options, const Range& range) {
+  unsigned num_threads = options.num_threads != 0 ? options.num_threads : std::thread::hardware_concurrency();
+  const std::size_t min_records = std::max<std::size_t>(options.min_records_per_thread, 1);
+  num_threads = static_cast<unsigned>(std::clamp<std::size_t>(count / min_records, 1, std::max(num_threads, 1u)));
+
+  if (num_threads == 1) {
+    range(std::size_t{0}, count);
+    return;
+  }
+
+  // contiguous blocks keep every worker on its own output cache lines
+  const std::size_t block = (count + num_threads - 1) / num_threads;
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads - 1);
+  for (unsigned t = 1; t < num_threads; ++t) {
+    const std::size_t begin = std::min(count, t * block);
+    const std::size_t end = std::min(count, begin + block);
+    workers.emplace_back([&range, begin, end] { range(begin, end); });
+  }
+  range(std::size_t{0}, std::min(count, block));
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+}  // namespace
+
+uint8_t risksFactorsFlags(const RisksFactors& risk_factors) {
+  uint8_t flags = 0;
+  if (risk_factors.is_smoker) {
+    flags |= kIsSmokerKnown | (*risk_factors.is_smoker ? kIsSmoker : 0);
+  }
+  if (risk_factors.hypertension_treatment) {
+    flags |= kHypertensionTreatmentKnown | (*risk_factors.hypertension_treatment ? kHypertensionTreatment : 0);
+  }
+  if (risk_factors.has_diabetes) {
+    flags |= kHasDiabetesKnown | (*risk_factors.has_diabetes ? kHasDiabetes : 0);
+  }
+  return flags;
+}
+
+RisksFactors risksFactorsAt(const RisksFactorsColumns& columns, std::size_t index) {
+  RisksFactors factors;
+  uint16_t loaded_country = kMissingCountry;
+  loadRisksFactors(columns, index, factors, loaded_country);
+  return factors;
+}
+
+void storeHealthRisks(const HealthRisks& risks, const HealthRisksColumns& columns, std::size_t index) {
+  store(columns.coronary_death_event_risk, index, risks.hard_and_fatal_events.coronary_death_event_risk);
+  store(columns.fatal_stroke_event_risk, index, risks.hard_and_fatal_events.fatal_stroke_event_risk);
+  store(columns.total_cv_mortality_risk, index, risks.hard_and_fatal_events.total_cv_mortality_risk);
+  store(columns.hard_cv_event_risk, index, risks.hard_and_fatal_events.hard_cv_event_risk);
+
+  store(columns.overall_risk, index, risks.cv_diseases.overall_risk);
+  store(columns.coronary_heart_disease_risk, index, risks.cv_diseases.coronary_heart_disease_risk);
+  store(columns.stroke_risk, index, risks.cv_diseases.stroke_risk);
+  store(columns.heart_failure_risk, index, risks.cv_diseases.heart_failure_risk);
+  store(columns.peripheral_vascular_disease_risk, index, risks.cv_diseases.peripheral_vascular_disease_risk);
+
+  store(columns.vascular_age, index, risks.vascular_age);
+
+  store(columns.age_score, index, risks.scores.age_score);
+  store(columns.sbp_score, index, risks.scores.sbp_score);
+  store(columns.smoking_score, index, risks.scores.smoking_score);
+  store(columns.diabetes_score, index, risks.scores.diabetes_score);
+  store(columns.bmi_score, index, risks.scores.bmi_score);
+  store(columns.cholesterol_score, index, risks.scores.cholesterol_score);
+  store(columns.cholesterol_hdl_score, index, risks.scores.cholesterol_hdl_score);
+  store(columns.total_score, index, risks.scores.total_score);
+}
+
+void computeHealthRisksBatch(const RisksFactorsColumns& input, const HealthRisksColumns& output,
+                             const BatchOptions& options) {
+  runBatch(input.count, options, [&](std::size_t begin, std::size_t end) { computeRange(input, output, begin, end); });
+}
+
+void computeHealthRisksBatch(const PackedRisksFactors* input, PackedHealthRisks* output, std::size_t count,
+                             const BatchOptions& options) {
+  const PackedHealthRisks missing = missingPackedHealthRisks();
+  runBatch(count, options, [input, output, &missing](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      // scores outside of int16 don't occur for valid factors, such results are stored as missing
+      output[i] = packHealthRisks(computeHealthRisks(unpackRisksFactors(input[i]))).value_or(missing);
+    }
+  });
+}
+
+}  // namespace mx::health_risks
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <ShenaiSDK/health_risks.h>
+
+#include "health_risks_packed.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace mx::health_risks {
+
+// Sentinel values used by the columnar representation
+constexpr int32_t kMissingInt = std::numeric_limits<int32_t>::min();
+constexpr uint8_t kMissingCategory = 0xFF;
+constexpr uint16_t kMissingCountry = 0;
+
+// Bits of the per-record flags column: every boolean factor has a "known" bit and a value bit
+enum RisksFactorsFlag : uint8_t {
+  kIsSmokerKnown = 1 << 0,
+  kIsSmoker = 1 << 1,
+  kHypertensionTreatmentKnown = 1 << 2,
+  kHypertensionTreatment = 1 << 3,
+  kHasDiabetesKnown = 1 << 4,
+  kHasDiabetes = 1 << 5,
+};
+
+// ISO 3166-1 alpha-2 country code packed into two bytes, kMissingCountry for anything else
+constexpr uint16_t encodeCountryCode(std::string_view country) {
+  if (country.size() != 2) {
+    return kMissingCountry;
+  }
+  return static_cast<uint16_t>((static_cast<uint8_t>(country[0]) << 8) | static_cast<uint8_t>(country[1]));
+}
+
+inline std::string decodeCountryCode(uint16_t code) {
+  if (code == kMissingCountry) {
+    return {};
+  }
+  return {static_cast<char>(code >> 8), static_cast<char>(code & 0xFF)};
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Struct-of-arrays view over a population of risk factors.
+/// All columns hold `count` entries. A null column means the factor is missing for every record;
+/// individual missing values are NaN (floats), kMissingInt (age) or kMissingCategory (gender, race).
+/// Gender and race bytes that are not a Gender / Race value are read as missing.
+struct RisksFactorsColumns {
+  std::size_t count = 0;
+  const int32_t* age = nullptr;
+  const float* cholesterol = nullptr;
+  const float* cholesterol_hdl = nullptr;
+  const float* sbp = nullptr;
+  const float* body_height = nullptr;  // centimeters
+  const float* body_weight = nullptr;  // kilograms
+  const uint8_t* flags = nullptr;      // RisksFactorsFlag bits
+  const uint8_t* gender = nullptr;     // Gender value
+  const uint8_t* race = nullptr;       // Race value
+  const uint16_t* country = nullptr;   // encodeCountryCode()
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Struct-of-arrays output for a population, indexed like the input columns.
+/// Columns left null are not written. Missing risks are NaN, missing ages and scores kMissingInt.
+struct HealthRisksColumns {
+  float* coronary_death_event_risk = nullptr;
+  float* fatal_stroke_event_risk = nullptr;
+  float* total_cv_mortality_risk = nullptr;
+  float* hard_cv_event_risk = nullptr;
+
+  float* overall_risk = nullptr;
+  float* coronary_heart_disease_risk = nullptr;
+  float* stroke_risk = nullptr;
+  float* heart_failure_risk = nullptr;
+  float* peripheral_vascular_disease_risk = nullptr;
+
+  int32_t* vascular_age = nullptr;
+
+  int32_t* age_score = nullptr;
+  int32_t* sbp_score = nullptr;
+  int32_t* smoking_score = nullptr;
+  int32_t* diabetes_score = nullptr;
+  int32_t* bmi_score = nullptr;
+  int32_t* cholesterol_score = nullptr;
+  int32_t* cholesterol_hdl_score = nullptr;
+  int32_t* total_score = nullptr;
+};
+
+struct BatchOptions {
+  // number of worker threads, 0 means std::thread::hardware_concurrency()
+  unsigned num_threads = 0;
+  // records below which splitting the work across threads is not worth it
+  std::size_t min_records_per_thread = 512;
+};
+
+// RisksFactorsFlag bits of the boolean factors
+uint8_t risksFactorsFlags(const RisksFactors& risk_factors);
+
+// Gathers a single record from the columns
+RisksFactors risksFactorsAt(const RisksFactorsColumns& columns, std::size_t index);
+
+// Scatters a single result into the columns
+void storeHealthRisks(const HealthRisks& risks, const HealthRisksColumns& columns, std::size_t index);
+
+// Compute health risks for every record of the population.
+// Records are independent, so the range is split into contiguous blocks scored in parallel. This relies on
+// computeHealthRisks being reentrant: it takes the factors by const reference and returns the risks by value, with
+// no SDK handle or state in between. The grid and uncertainty analyses call it from several threads on the same
+// basis, and so does Android through ShenAIAndroidSDK.computeHealthRisks, which wraps the same function.
+void computeHealthRisksBatch(const RisksFactorsColumns& input, const HealthRisksColumns& output,
+                             const BatchOptions& options = {});
+
+// Same for an array of packed records, output[i] receives the risks of input[i]
+void computeHealthRisksBatch(const PackedRisksFactors* input, PackedHealthRisks* output, std::size_t count,
+                             const BatchOptions& options = {});
+
+}  // namespace mx::health_risks
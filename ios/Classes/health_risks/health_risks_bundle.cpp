@@ -0,0 +1,13 @@
+#include "health_risks_bundle.h"
+
+namespace mx::health_risks {
+
+HealthRisksBundle computeHealthRisksBundle(const RisksFactors& risk_factors) {
+  return {
+      .actual = computeHealthRisks(risk_factors),
+      .minimal = getMinimalRisks(risk_factors),
+      .maximal = getMaximalRisks(risk_factors),
+  };
+}
+
+}  // namespace mx::health_risks
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <ShenaiSDK/health_risks.h>
+
+namespace mx::health_risks {
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Everything a risks dashboard shows for a single person
+struct HealthRisksBundle {
+  HealthRisks actual;
+  HealthRisks minimal;
+  HealthRisks maximal;
+};
+
+// Compute actual, minimal and maximal risks for the same factors in a single call
+HealthRisksBundle computeHealthRisksBundle(const RisksFactors& risk_factors);
+
+}  // namespace mx::health_risks
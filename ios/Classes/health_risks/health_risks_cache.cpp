@@ -0,0 +1,180 @@
+#include "health_risks_cache.h"
+
+#include "health_risks_batch.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mx::health_risks {
+
+namespace {
+
+bool quantize(const std::optional<float>& value, float scale, int32_t& result) {
+  if (!value) {
+    result = kMissingInt;
+    return true;
+  }
+  if (!std::isfinite(*value) || std::fabs(*value * scale) >= static_cast<float>(1 << 30)) {
+    return false;
+  }
+  result = static_cast<int32_t>(std::lround(*value * scale));
+  return true;
+}
+
+std::optional<float> dequantize(int32_t value, float scale) {
+  if (value == kMissingInt) {
+    return std::nullopt;
+  }
+  return static_cast<float>(value) / scale;
+}
+
+std::optional<bool> unpackFlag(uint8_t flags, uint8_t known_bit, uint8_t value_bit) {
+  if ((flags & known_bit) == 0) {
+    return std::nullopt;
+  }
+  return (flags & value_bit) != 0;
+}
+
+uint64_t mix(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+}  // namespace
+
+bool QuantizedRisksFactors::operator==(const QuantizedRisksFactors& other) const {
+  return age == other.age && sbp == other.sbp && cholesterol == other.cholesterol &&
+         cholesterol_hdl == other.cholesterol_hdl && body_height == other.body_height &&
+         body_weight == other.body_weight && country == other.country && flags == other.flags &&
+         gender == other.gender && race == other.race;
+}
+
+std::optional<QuantizedRisksFactors> quantizeRisksFactors(const RisksFactors& risk_factors) {
+  QuantizedRisksFactors quantized;
+  quantized.age = risk_factors.age ? *risk_factors.age : kMissingInt;
+  if (!quantize(risk_factors.sbp, 1.0f, quantized.sbp) ||
+      !quantize(risk_factors.cholesterol, 10.0f, quantized.cholesterol) ||
+      !quantize(risk_factors.cholesterol_hdl, 10.0f, quantized.cholesterol_hdl) ||
+      !quantize(risk_factors.body_height, 10.0f, quantized.body_height) ||
+      !quantize(risk_factors.body_weight, 10.0f, quantized.body_weight)) {
+    return std::nullopt;
+  }
+
+  quantized.country = encodeCountryCode(risk_factors.country);
+  if (quantized.country == kMissingCountry && !risk_factors.country.empty()) {
+    return std::nullopt;
+  }
+
+  quantized.flags = risksFactorsFlags(risk_factors);
+  quantized.gender = risk_factors.gender ? static_cast<uint8_t>(*risk_factors.gender) : kMissingCategory;
+  quantized.race = risk_factors.race ? static_cast<uint8_t>(*risk_factors.race) : kMissingCategory;
+  return quantized;
+}
+
+RisksFactors dequantizeRisksFactors(const QuantizedRisksFactors& quantized) {
+  RisksFactors factors;
+  if (quantized.age != kMissingInt) {
+    factors.age = quantized.age;
+  }
+  factors.sbp = dequantize(quantized.sbp, 1.0f);
+  factors.cholesterol = dequantize(quantized.cholesterol, 10.0f);
+  factors.cholesterol_hdl = dequantize(quantized.cholesterol_hdl, 10.0f);
+  factors.body_height = dequantize(quantized.body_height, 10.0f);
+  factors.body_weight = dequantize(quantized.body_weight, 10.0f);
+  factors.is_smoker = unpackFlag(quantized.flags, kIsSmokerKnown, kIsSmoker);
+  factors.hypertension_treatment = unpackFlag(quantized.flags, kHypertensionTreatmentKnown, kHypertensionTreatment);
+  factors.has_diabetes = unpackFlag(quantized.flags, kHasDiabetesKnown, kHasDiabetes);
+  if (quantized.gender != kMissingCategory) {
+    factors.gender = static_cast<Gender>(quantized.gender);
+  }
+  if (quantized.race != kMissingCategory) {
+    factors.race = static_cast<Race>(quantized.race);
+  }
+  factors.country = decodeCountryCode(quantized.country);
+  return factors;
+}
+
+std::size_t HealthRisksCache::KeyHash::operator()(const QuantizedRisksFactors& key) const {
+  uint64_t h = mix((static_cast<uint64_t>(static_cast<uint32_t>(key.age)) << 32) | static_cast<uint32_t>(key.sbp));
+  h = mix(h ^ ((static_cast<uint64_t>(static_cast<uint32_t>(key.cholesterol)) << 32) |
+               static_cast<uint32_t>(key.cholesterol_hdl)));
+  h = mix(h ^ ((static_cast<uint64_t>(static_cast<uint32_t>(key.body_height)) << 32) |
+               static_cast<uint32_t>(key.body_weight)));
+  h = mix(h ^ ((static_cast<uint64_t>(key.country) << 24) | (static_cast<uint64_t>(key.flags) << 16) |
+               (static_cast<uint64_t>(key.gender) << 8) | key.race));
+  return static_cast<std::size_t>(h);
+}
+
+HealthRisksCache::HealthRisksCache(std::size_t capacity, std::size_t num_shards)
+    : capacity_(capacity), shard_capacity_(0) {
+  num_shards = std::max<std::size_t>(1, std::min(num_shards, std::max<std::size_t>(capacity, 1)));
+  shard_capacity_ = (capacity + num_shards - 1) / num_shards;
+  shards_.reserve(num_shards);
+  for (std::size_t i = 0; i < num_shards; ++i) {
+    shards_.push_back(std::make_unique<Shard>());
+  }
+}
+
+HealthRisks HealthRisksCache::compute(const RisksFactors& risk_factors) {
+  // a disabled cache and factors the key can't represent bypass it entirely, without touching the counters
+  if (capacity_ == 0) {
+    return computeHealthRisks(risk_factors);
+  }
+  const auto key = quantizeRisksFactors(risk_factors);
+  if (!key) {
+    return computeHealthRisks(risk_factors);
+  }
+
+  const std::size_t hash = KeyHash{}(*key);
+  Shard& shard = *shards_[(hash >> 7) % shards_.size()];
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.index.find(*key);
+    if (found != shard.index.end()) {
+      shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return found->second->second;
+    }
+  }
+
+  // compute outside of the lock, concurrent misses on the same key just store the same value twice
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  HealthRisks risks = computeHealthRisks(dequantizeRisksFactors(*key));
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto found = shard.index.find(*key);
+  if (found != shard.index.end()) {
+    shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+    return risks;
+  }
+  shard.lru.emplace_front(*key, risks);
+  shard.index.emplace(*key, shard.lru.begin());
+  if (shard.lru.size() > shard_capacity_) {
+    shard.index.erase(shard.lru.back().first);
+    shard.lru.pop_back();
+  }
+  return risks;
+}
+
+void HealthRisksCache::clear() {
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    shard->index.clear();
+    shard->lru.clear();
+  }
+  hits_.store(0, std::memory_order_relaxed);
+  misses_.store(0, std::memory_order_relaxed);
+}
+
+HealthRisksCacheStats HealthRisksCache::stats() const {
+  return {
+      .hits = hits_.load(std::memory_order_relaxed),
+      .misses = misses_.load(std::memory_order_relaxed),
+  };
+}
+
+}  // namespace mx::health_risks
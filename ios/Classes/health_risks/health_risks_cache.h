@@ -0,0 +1,80 @@
+#pragma once
+
+#include <ShenaiSDK/health_risks.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace mx::health_risks {
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Risk factors rounded to the resolution at which results are memoized:
+/// integer age, SBP to 1 mmHg, cholesterol, HDL, height and weight to 0.1, plus flags and category codes.
+struct QuantizedRisksFactors {
+  int32_t age;
+  int32_t sbp;
+  int32_t cholesterol;      // tenths
+  int32_t cholesterol_hdl;  // tenths
+  int32_t body_height;      // tenths of centimeter
+  int32_t body_weight;      // tenths of kilogram
+  uint16_t country;
+  uint8_t flags;
+  uint8_t gender;
+  uint8_t race;
+
+  bool operator==(const QuantizedRisksFactors& other) const;
+};
+
+// Quantize the factors, std::nullopt when they can't be represented exactly by the key
+// (non alpha-2 country, non-finite values)
+std::optional<QuantizedRisksFactors> quantizeRisksFactors(const RisksFactors& risk_factors);
+
+// Factors the quantized key stands for
+RisksFactors dequantizeRisksFactors(const QuantizedRisksFactors& quantized);
+
+struct HealthRisksCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Bounded LRU memo of computeHealthRisks results, safe to use from many threads.
+/// Results are always computed from the quantized factors, so a cached and a fresh answer never differ.
+/// Factors the key can't represent, and every call while the capacity is 0, are computed as given and not counted.
+/// Entries are spread over independently locked shards by key hash.
+class HealthRisksCache {
+ public:
+  explicit HealthRisksCache(std::size_t capacity = 4096, std::size_t num_shards = 16);
+
+  HealthRisks compute(const RisksFactors& risk_factors);
+
+  void clear();
+  HealthRisksCacheStats stats() const;
+  std::size_t capacity() const { return capacity_; }
+
+ private:
+  struct KeyHash {
+    std::size_t operator()(const QuantizedRisksFactors& key) const;
+  };
+  using Entry = std::pair<QuantizedRisksFactors, HealthRisks>;
+  struct Shard {
+    std::mutex mutex;
+    std::list<Entry> lru;  // most recently used first
+    std::unordered_map<QuantizedRisksFactors, std::list<Entry>::iterator, KeyHash> index;
+  };
+
+  std::size_t capacity_;
+  std::size_t shard_capacity_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+};
+
+}  // namespace mx::health_risks
@@ -0,0 +1,187 @@
+#include "health_risks_grid.h"
+
+#include <cmath>
+#include <limits>
+
+namespace mx::health_risks {
+
+namespace {
+
+float axisValue(const GridAxis& axis, uint32_t index) {
+  if (axis.steps <= 1) {
+    return axis.min;
+  }
+  return axis.min + (axis.max - axis.min) * static_cast<float>(index) / static_cast<float>(axis.steps - 1);
+}
+
+// Input columns of the whole grid, filled with the base factors
+struct GridColumns {
+  explicit GridColumns(const RisksFactors& base, std::size_t count)
+      : age(count, base.age ? *base.age : kMissingInt),
+        cholesterol(count, base.cholesterol.value_or(kNaN)),
+        cholesterol_hdl(count, base.cholesterol_hdl.value_or(kNaN)),
+        sbp(count, base.sbp.value_or(kNaN)),
+        body_height(count, base.body_height.value_or(kNaN)),
+        body_weight(count, base.body_weight.value_or(kNaN)) {}
+
+  static constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+  void set(GridFactor factor, std::size_t index, float value) {
+    switch (factor) {
+      case GridFactor::age:
+        age[index] = static_cast<int32_t>(std::lround(value));
+        break;
+      case GridFactor::sbp:
+        sbp[index] = value;
+        break;
+      case GridFactor::cholesterol:
+        cholesterol[index] = value;
+        break;
+      case GridFactor::cholesterol_hdl:
+        cholesterol_hdl[index] = value;
+        break;
+      case GridFactor::body_weight:
+        body_weight[index] = value;
+        break;
+      case GridFactor::body_height:
+        body_height[index] = value;
+        break;
+    }
+  }
+
+  std::vector<int32_t> age;
+  std::vector<float> cholesterol;
+  std::vector<float> cholesterol_hdl;
+  std::vector<float> sbp;
+  std::vector<float> body_height;
+  std::vector<float> body_weight;
+};
+
+// Points the output column of `metric` at the given buffers
+void selectMetric(HealthRisksColumns& columns, HealthRisksMetric metric, float* values, int32_t* integers) {
+  switch (metric) {
+    case HealthRisksMetric::coronary_death_event_risk:
+      columns.coronary_death_event_risk = values;
+      break;
+    case HealthRisksMetric::fatal_stroke_event_risk:
+      columns.fatal_stroke_event_risk = values;
+      break;
+    case HealthRisksMetric::total_cv_mortality_risk:
+      columns.total_cv_mortality_risk = values;
+      break;
+    case HealthRisksMetric::hard_cv_event_risk:
+      columns.hard_cv_event_risk = values;
+      break;
+    case HealthRisksMetric::overall_risk:
+      columns.overall_risk = values;
+      break;
+    case HealthRisksMetric::coronary_heart_disease_risk:
+      columns.coronary_heart_disease_risk = values;
+      break;
+    case HealthRisksMetric::stroke_risk:
+      columns.stroke_risk = values;
+      break;
+    case HealthRisksMetric::heart_failure_risk:
+      columns.heart_failure_risk = values;
+      break;
+    case HealthRisksMetric::peripheral_vascular_disease_risk:
+      columns.peripheral_vascular_disease_risk = values;
+      break;
+    case HealthRisksMetric::vascular_age:
+      columns.vascular_age = integers;
+      break;
+    case HealthRisksMetric::age_score:
+      columns.age_score = integers;
+      break;
+    case HealthRisksMetric::sbp_score:
+      columns.sbp_score = integers;
+      break;
+    case HealthRisksMetric::smoking_score:
+      columns.smoking_score = integers;
+      break;
+    case HealthRisksMetric::diabetes_score:
+      columns.diabetes_score = integers;
+      break;
+    case HealthRisksMetric::bmi_score:
+      columns.bmi_score = integers;
+      break;
+    case HealthRisksMetric::cholesterol_score:
+      columns.cholesterol_score = integers;
+      break;
+    case HealthRisksMetric::cholesterol_hdl_score:
+      columns.cholesterol_hdl_score = integers;
+      break;
+    case HealthRisksMetric::total_score:
+      columns.total_score = integers;
+      break;
+  }
+}
+
+}  // namespace
+
+std::vector<float> computeHealthRisksGrid(const RisksFactors& base, const GridAxis& x, const GridAxis& y,
+                                          HealthRisksMetric metric, const BatchOptions& options) {
+  const std::size_t count = static_cast<std::size_t>(x.steps) * y.steps;
+  std::vector<float> values(count, GridColumns::kNaN);
+  if (count == 0) {
+    return values;
+  }
+
+  GridColumns grid(base, count);
+  for (uint32_t row = 0; row < y.steps; ++row) {
+    const float y_value = axisValue(y, row);
+    for (uint32_t column = 0; column < x.steps; ++column) {
+      const std::size_t index = static_cast<std::size_t>(row) * x.steps + column;
+      grid.set(x.factor, index, axisValue(x, column));
+      grid.set(y.factor, index, y_value);
+    }
+  }
+
+  // categorical factors are shared by every cell, so they are single value columns repeated over the grid
+  const uint16_t country = encodeCountryCode(base.country);
+  const uint8_t gender = base.gender ? static_cast<uint8_t>(*base.gender) : kMissingCategory;
+  const uint8_t race = base.race ? static_cast<uint8_t>(*base.race) : kMissingCategory;
+  const std::vector<uint16_t> countries(count, country);
+  const std::vector<uint8_t> genders(count, gender);
+  const std::vector<uint8_t> races(count, race);
+  const std::vector<uint8_t> flags(count, risksFactorsFlags(base));
+
+  RisksFactorsColumns input;
+  input.count = count;
+  input.age = grid.age.data();
+  input.cholesterol = grid.cholesterol.data();
+  input.cholesterol_hdl = grid.cholesterol_hdl.data();
+  input.sbp = grid.sbp.data();
+  input.body_height = grid.body_height.data();
+  input.body_weight = grid.body_weight.data();
+  input.flags = flags.data();
+  input.gender = genders.data();
+  input.race = races.data();
+  input.country = countries.data();
+
+  // vascular age and scores are integers, converted to floats once scored
+  std::vector<int32_t> integers;
+  if (metric >= HealthRisksMetric::vascular_age) {
+    integers.assign(count, kMissingInt);
+  }
+  HealthRisksColumns output;
+  selectMetric(output, metric, values.data(), integers.data());
+
+  if (country == kMissingCountry && !base.country.empty()) {
+    // countries the columns can't encode are scored record by record with the original string
+    for (std::size_t i = 0; i < count; ++i) {
+      RisksFactors factors = risksFactorsAt(input, i);
+      factors.country = base.country;
+      storeHealthRisks(computeHealthRisks(factors), output, i);
+    }
+  } else {
+    computeHealthRisksBatch(input, output, options);
+  }
+
+  for (std::size_t i = 0; i < integers.size(); ++i) {
+    values[i] = integers[i] == kMissingInt ? GridColumns::kNaN : static_cast<float>(integers[i]);
+  }
+  return values;
+}
+
+}  // namespace mx::health_risks
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <ShenaiSDK/health_risks.h>
+
+#include "health_risks_batch.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace mx::health_risks {
+
+// Factors a grid axis can sweep
+enum class GridFactor { age, sbp, cholesterol, cholesterol_hdl, body_weight, body_height };
+
+// Single HealthRisks field, in declaration order
+enum class HealthRisksMetric {
+  coronary_death_event_risk,
+  fatal_stroke_event_risk,
+  total_cv_mortality_risk,
+  hard_cv_event_risk,
+  overall_risk,
+  coronary_heart_disease_risk,
+  stroke_risk,
+  heart_failure_risk,
+  peripheral_vascular_disease_risk,
+  vascular_age,
+  age_score,
+  sbp_score,
+  smoking_score,
+  diabetes_score,
+  bmi_score,
+  cholesterol_score,
+  cholesterol_hdl_score,
+  total_score,
+};
+
+// Largest grid the plugin accepts, a full one is 1 MB of output and as many SDK calls as cells
+constexpr uint32_t kMaxGridAxisSteps = 1024;
+constexpr std::size_t kMaxGridCells = std::size_t{1} << 18;
+
+// `steps` values evenly spaced from `min` to `max` inclusive (ages are rounded)
+struct GridAxis {
+  GridFactor factor;
+  float min;
+  float max;
+  uint32_t steps;
+};
+
+// Evaluate `metric` over the x * y grid with all other factors taken from `base`.
+// Returns a row-major matrix of y.steps rows and x.steps columns, NaN where the metric is missing.
+std::vector<float> computeHealthRisksGrid(const RisksFactors& base, const GridAxis& x, const GridAxis& y,
+                                          HealthRisksMetric metric, const BatchOptions& options = {});
+
+}  // namespace mx::health_risks
@@ -0,0 +1,195 @@
+#include "health_risks_packed.h"
+
+#include <cstring>
+#include <limits>
+
+namespace mx::health_risks {
+
+namespace {
+
+template <typename Bits>
+float packFloat(const std::optional<float>& value, Bits bit, Bits& presence) {
+  if (!value) {
+    return std::numeric_limits<float>::quiet_NaN();
+  }
+  presence |= bit;
+  return *value;
+}
+
+template <typename Bits>
+std::optional<float> unpackFloat(float value, Bits bit, Bits presence) {
+  if ((presence & bit) == 0) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+bool packInt16(const std::optional<int>& value, uint32_t bit, uint32_t& presence, int16_t& result) {
+  result = 0;
+  if (!value) {
+    return true;
+  }
+  if (*value < std::numeric_limits<int16_t>::min() || *value > std::numeric_limits<int16_t>::max()) {
+    return false;
+  }
+  presence |= bit;
+  result = static_cast<int16_t>(*value);
+  return true;
+}
+
+std::optional<int> unpackInt16(int16_t value, uint32_t bit, uint32_t presence) {
+  if ((presence & bit) == 0) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+void packFlag(const std::optional<bool>& value, uint16_t bit, uint8_t flag, PackedRisksFactors& packed) {
+  if (value) {
+    packed.presence |= bit;
+    packed.flags |= *value ? flag : 0;
+  }
+}
+
+std::optional<bool> unpackFlag(const PackedRisksFactors& packed, uint16_t bit, uint8_t flag) {
+  if ((packed.presence & bit) == 0) {
+    return std::nullopt;
+  }
+  return (packed.flags & flag) != 0;
+}
+
+}  // namespace
+
+std::optional<PackedRisksFactors> packRisksFactors(const RisksFactors& risk_factors) {
+  using P = PackedRisksFactors;
+  if (risk_factors.country.size() > sizeof(P::country) ||
+      risk_factors.country.find('\0') != std::string::npos) {
+    return std::nullopt;
+  }
+
+  PackedRisksFactors packed{};
+  packed.cholesterol = packFloat<uint16_t>(risk_factors.cholesterol, P::kCholesterol, packed.presence);
+  packed.cholesterol_hdl = packFloat<uint16_t>(risk_factors.cholesterol_hdl, P::kCholesterolHdl, packed.presence);
+  packed.sbp = packFloat<uint16_t>(risk_factors.sbp, P::kSbp, packed.presence);
+  packed.body_height = packFloat<uint16_t>(risk_factors.body_height, P::kBodyHeight, packed.presence);
+  packed.body_weight = packFloat<uint16_t>(risk_factors.body_weight, P::kBodyWeight, packed.presence);
+  if (risk_factors.age) {
+    packed.presence |= P::kAge;
+    packed.age = *risk_factors.age;
+  }
+  packFlag(risk_factors.is_smoker, P::kIsSmoker, P::kSmoker, packed);
+  packFlag(risk_factors.hypertension_treatment, P::kHypertensionTreatment, P::kTreatedHypertension, packed);
+  packFlag(risk_factors.has_diabetes, P::kHasDiabetes, P::kDiabetes, packed);
+  if (risk_factors.gender) {
+    packed.presence |= P::kGender;
+    packed.gender = static_cast<uint8_t>(*risk_factors.gender);
+  }
+  if (risk_factors.race) {
+    packed.presence |= P::kRace;
+    packed.race = static_cast<uint8_t>(*risk_factors.race);
+  }
+  std::memcpy(packed.country, risk_factors.country.data(), risk_factors.country.size());
+  return packed;
+}
+
+RisksFactors unpackRisksFactors(const PackedRisksFactors& packed) {
+  using P = PackedRisksFactors;
+  RisksFactors factors;
+  if (packed.presence & P::kAge) {
+    factors.age = packed.age;
+  }
+  factors.cholesterol = unpackFloat<uint16_t>(packed.cholesterol, P::kCholesterol, packed.presence);
+  factors.cholesterol_hdl = unpackFloat<uint16_t>(packed.cholesterol_hdl, P::kCholesterolHdl, packed.presence);
+  factors.sbp = unpackFloat<uint16_t>(packed.sbp, P::kSbp, packed.presence);
+  factors.is_smoker = unpackFlag(packed, P::kIsSmoker, P::kSmoker);
+  factors.hypertension_treatment = unpackFlag(packed, P::kHypertensionTreatment, P::kTreatedHypertension);
+  factors.has_diabetes = unpackFlag(packed, P::kHasDiabetes, P::kDiabetes);
+  factors.body_height = unpackFloat<uint16_t>(packed.body_height, P::kBodyHeight, packed.presence);
+  factors.body_weight = unpackFloat<uint16_t>(packed.body_weight, P::kBodyWeight, packed.presence);
+  if ((packed.presence & P::kGender) && packed.gender <= static_cast<uint8_t>(Gender::other)) {
+    factors.gender = static_cast<Gender>(packed.gender);
+  }
+  factors.country.assign(packed.country, strnlen(packed.country, sizeof(packed.country)));
+  if ((packed.presence & P::kRace) && packed.race <= static_cast<uint8_t>(Race::other)) {
+    factors.race = static_cast<Race>(packed.race);
+  }
+  return factors;
+}
+
+PackedHealthRisks missingPackedHealthRisks() {
+  // packing an empty HealthRisks can't fail, every optional is missing
+  return *packHealthRisks(HealthRisks{});
+}
+
+std::optional<PackedHealthRisks> packHealthRisks(const HealthRisks& risks) {
+  using P = PackedHealthRisks;
+  PackedHealthRisks packed{};
+  const auto& hard = risks.hard_and_fatal_events;
+  packed.coronary_death_event_risk =
+      packFloat<uint32_t>(hard.coronary_death_event_risk, P::kCoronaryDeathEventRisk, packed.presence);
+  packed.fatal_stroke_event_risk =
+      packFloat<uint32_t>(hard.fatal_stroke_event_risk, P::kFatalStrokeEventRisk, packed.presence);
+  packed.total_cv_mortality_risk =
+      packFloat<uint32_t>(hard.total_cv_mortality_risk, P::kTotalCvMortalityRisk, packed.presence);
+  packed.hard_cv_event_risk = packFloat<uint32_t>(hard.hard_cv_event_risk, P::kHardCvEventRisk, packed.presence);
+
+  const auto& cvd = risks.cv_diseases;
+  packed.overall_risk = packFloat<uint32_t>(cvd.overall_risk, P::kOverallRisk, packed.presence);
+  packed.coronary_heart_disease_risk =
+      packFloat<uint32_t>(cvd.coronary_heart_disease_risk, P::kCoronaryHeartDiseaseRisk, packed.presence);
+  packed.stroke_risk = packFloat<uint32_t>(cvd.stroke_risk, P::kStrokeRisk, packed.presence);
+  packed.heart_failure_risk = packFloat<uint32_t>(cvd.heart_failure_risk, P::kHeartFailureRisk, packed.presence);
+  packed.peripheral_vascular_disease_risk =
+      packFloat<uint32_t>(cvd.peripheral_vascular_disease_risk, P::kPeripheralVascularDiseaseRisk, packed.presence);
+
+  const auto& scores = risks.scores;
+  if (!packInt16(risks.vascular_age, P::kVascularAge, packed.presence, packed.vascular_age) ||
+      !packInt16(scores.age_score, P::kAgeScore, packed.presence, packed.age_score) ||
+      !packInt16(scores.sbp_score, P::kSbpScore, packed.presence, packed.sbp_score) ||
+      !packInt16(scores.smoking_score, P::kSmokingScore, packed.presence, packed.smoking_score) ||
+      !packInt16(scores.diabetes_score, P::kDiabetesScore, packed.presence, packed.diabetes_score) ||
+      !packInt16(scores.bmi_score, P::kBmiScore, packed.presence, packed.bmi_score) ||
+      !packInt16(scores.cholesterol_score, P::kCholesterolScore, packed.presence, packed.cholesterol_score) ||
+      !packInt16(scores.cholesterol_hdl_score, P::kCholesterolHdlScore, packed.presence,
+                 packed.cholesterol_hdl_score) ||
+      !packInt16(scores.total_score, P::kTotalScore, packed.presence, packed.total_score)) {
+    return std::nullopt;
+  }
+  return packed;
+}
+
+HealthRisks unpackHealthRisks(const PackedHealthRisks& packed) {
+  using P = PackedHealthRisks;
+  HealthRisks risks;
+  auto& hard = risks.hard_and_fatal_events;
+  hard.coronary_death_event_risk =
+      unpackFloat<uint32_t>(packed.coronary_death_event_risk, P::kCoronaryDeathEventRisk, packed.presence);
+  hard.fatal_stroke_event_risk =
+      unpackFloat<uint32_t>(packed.fatal_stroke_event_risk, P::kFatalStrokeEventRisk, packed.presence);
+  hard.total_cv_mortality_risk =
+      unpackFloat<uint32_t>(packed.total_cv_mortality_risk, P::kTotalCvMortalityRisk, packed.presence);
+  hard.hard_cv_event_risk = unpackFloat<uint32_t>(packed.hard_cv_event_risk, P::kHardCvEventRisk, packed.presence);
+
+  auto& cvd = risks.cv_diseases;
+  cvd.overall_risk = unpackFloat<uint32_t>(packed.overall_risk, P::kOverallRisk, packed.presence);
+  cvd.coronary_heart_disease_risk =
+      unpackFloat<uint32_t>(packed.coronary_heart_disease_risk, P::kCoronaryHeartDiseaseRisk, packed.presence);
+  cvd.stroke_risk = unpackFloat<uint32_t>(packed.stroke_risk, P::kStrokeRisk, packed.presence);
+  cvd.heart_failure_risk = unpackFloat<uint32_t>(packed.heart_failure_risk, P::kHeartFailureRisk, packed.presence);
+  cvd.peripheral_vascular_disease_risk = unpackFloat<uint32_t>(packed.peripheral_vascular_disease_risk,
+                                                               P::kPeripheralVascularDiseaseRisk, packed.presence);
+
+  risks.vascular_age = unpackInt16(packed.vascular_age, P::kVascularAge, packed.presence);
+  auto& scores = risks.scores;
+  scores.age_score = unpackInt16(packed.age_score, P::kAgeScore, packed.presence);
+  scores.sbp_score = unpackInt16(packed.sbp_score, P::kSbpScore, packed.presence);
+  scores.smoking_score = unpackInt16(packed.smoking_score, P::kSmokingScore, packed.presence);
+  scores.diabetes_score = unpackInt16(packed.diabetes_score, P::kDiabetesScore, packed.presence);
+  scores.bmi_score = unpackInt16(packed.bmi_score, P::kBmiScore, packed.presence);
+  scores.cholesterol_score = unpackInt16(packed.cholesterol_score, P::kCholesterolScore, packed.presence);
+  scores.cholesterol_hdl_score = unpackInt16(packed.cholesterol_hdl_score, P::kCholesterolHdlScore, packed.presence);
+  scores.total_score = unpackInt16(packed.total_score, P::kTotalScore, packed.presence);
+  return risks;
+}
+
+}  // namespace mx::health_risks
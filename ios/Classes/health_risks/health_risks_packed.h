@@ -0,0 +1,114 @@
+#pragma once
+
+#include <ShenaiSDK/health_risks.h>
+
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace mx::health_risks {
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Trivially copyable RisksFactors: one presence bit per field, absent floats stored as NaN.
+/// Safe to memcpy into files or across language boundaries.
+struct PackedRisksFactors {
+  enum Presence : uint16_t {
+    kAge = 1 << 0,
+    kCholesterol = 1 << 1,
+    kCholesterolHdl = 1 << 2,
+    kSbp = 1 << 3,
+    kIsSmoker = 1 << 4,
+    kHypertensionTreatment = 1 << 5,
+    kHasDiabetes = 1 << 6,
+    kBodyHeight = 1 << 7,
+    kBodyWeight = 1 << 8,
+    kGender = 1 << 9,
+    kRace = 1 << 10,
+  };
+  enum Flag : uint8_t {
+    kSmoker = 1 << 0,
+    kTreatedHypertension = 1 << 1,
+    kDiabetes = 1 << 2,
+  };
+
+  float cholesterol;
+  float cholesterol_hdl;
+  float sbp;
+  float body_height;  // centimeters
+  float body_weight;  // kilograms
+  int32_t age;
+  uint16_t presence;  // Presence bits
+  char country[2];    // ISO 3166-1 alpha-2, zero padded
+  uint8_t gender;
+  uint8_t race;
+  uint8_t flags;  // Flag bits
+  uint8_t reserved;
+};
+
+static_assert(std::is_trivially_copyable_v<PackedRisksFactors>);
+static_assert(sizeof(PackedRisksFactors) == 32);
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Trivially copyable HealthRisks: one presence bit per field, absent risks stored as NaN.
+struct PackedHealthRisks {
+  enum Presence : uint32_t {
+    kCoronaryDeathEventRisk = 1 << 0,
+    kFatalStrokeEventRisk = 1 << 1,
+    kTotalCvMortalityRisk = 1 << 2,
+    kHardCvEventRisk = 1 << 3,
+    kOverallRisk = 1 << 4,
+    kCoronaryHeartDiseaseRisk = 1 << 5,
+    kStrokeRisk = 1 << 6,
+    kHeartFailureRisk = 1 << 7,
+    kPeripheralVascularDiseaseRisk = 1 << 8,
+    kVascularAge = 1 << 9,
+    kAgeScore = 1 << 10,
+    kSbpScore = 1 << 11,
+    kSmokingScore = 1 << 12,
+    kDiabetesScore = 1 << 13,
+    kBmiScore = 1 << 14,
+    kCholesterolScore = 1 << 15,
+    kCholesterolHdlScore = 1 << 16,
+    kTotalScore = 1 << 17,
+  };
+
+  float coronary_death_event_risk;
+  float fatal_stroke_event_risk;
+  float total_cv_mortality_risk;
+  float hard_cv_event_risk;
+
+  float overall_risk;
+  float coronary_heart_disease_risk;
+  float stroke_risk;
+  float heart_failure_risk;
+  float peripheral_vascular_disease_risk;
+
+  uint32_t presence;  // Presence bits
+
+  int16_t vascular_age;
+  int16_t age_score;
+  int16_t sbp_score;
+  int16_t smoking_score;
+  int16_t diabetes_score;
+  int16_t bmi_score;
+  int16_t cholesterol_score;
+  int16_t cholesterol_hdl_score;
+  int16_t total_score;
+};
+
+static_assert(std::is_trivially_copyable_v<PackedHealthRisks>);
+static_assert(sizeof(PackedHealthRisks) <= 60);
+
+// Lossless conversions. Packing fails (std::nullopt) for values the packed layout can't hold:
+// countries longer than two characters or containing '\0', vascular age or scores outside of int16.
+std::optional<PackedRisksFactors> packRisksFactors(const RisksFactors& risk_factors);
+// gender and race bytes outside of the enums are unpacked as missing
+RisksFactors unpackRisksFactors(const PackedRisksFactors& packed);
+
+std::optional<PackedHealthRisks> packHealthRisks(const HealthRisks& risks);
+HealthRisks unpackHealthRisks(const PackedHealthRisks& packed);
+
+// Record with every field missing: no presence bits, NaN risks and zero scores
+PackedHealthRisks missingPackedHealthRisks();
+
+}  // namespace mx::health_risks
@@ -0,0 +1,118 @@
+#include "health_risks_sensitivity.h"
+
+namespace mx::health_risks {
+
+namespace {
+
+constexpr float kSbpStep = -10.0f;
+constexpr float kCholesterolRelativeStep = -0.1f;
+constexpr float kCholesterolHdlRelativeStep = 0.1f;
+constexpr float kBmiStep = -1.0f;
+
+template <typename T>
+std::optional<T> subtract(const std::optional<T>& a, const std::optional<T>& b) {
+  if (!a || !b) {
+    return std::nullopt;
+  }
+  return *a - *b;
+}
+
+struct Perturbation {
+  ModifiableFactor factor;
+  float step;
+  RisksFactors factors;
+};
+
+std::vector<Perturbation> perturbations(const RisksFactors& base) {
+  std::vector<Perturbation> result;
+  RisksFactors factors = base;
+
+  if (base.sbp) {
+    factors.sbp = *base.sbp + kSbpStep;
+    result.push_back({ModifiableFactor::sbp, kSbpStep, factors});
+    factors.sbp = base.sbp;
+  }
+  if (base.cholesterol) {
+    const float step = *base.cholesterol * kCholesterolRelativeStep;
+    factors.cholesterol = *base.cholesterol + step;
+    result.push_back({ModifiableFactor::cholesterol, step, factors});
+    factors.cholesterol = base.cholesterol;
+  }
+  if (base.cholesterol_hdl) {
+    const float step = *base.cholesterol_hdl * kCholesterolHdlRelativeStep;
+    factors.cholesterol_hdl = *base.cholesterol_hdl + step;
+    result.push_back({ModifiableFactor::cholesterol_hdl, step, factors});
+    factors.cholesterol_hdl = base.cholesterol_hdl;
+  }
+  if (base.body_weight && base.body_height && *base.body_height > 0) {
+    const float height_m = *base.body_height / 100.0f;
+    factors.body_weight = *base.body_weight + kBmiStep * height_m * height_m;
+    result.push_back({ModifiableFactor::bmi, kBmiStep, factors});
+    factors.body_weight = base.body_weight;
+  }
+
+  const auto toggle = [&base, &result](std::optional<bool> RisksFactors::*flag, ModifiableFactor factor) {
+    if (!(base.*flag)) {
+      return;
+    }
+    RisksFactors toggled = base;
+    toggled.*flag = !*(base.*flag);
+    result.push_back({factor, *(base.*flag) ? -1.0f : 1.0f, std::move(toggled)});
+  };
+  toggle(&RisksFactors::is_smoker, ModifiableFactor::smoking);
+  toggle(&RisksFactors::has_diabetes, ModifiableFactor::diabetes);
+  toggle(&RisksFactors::hypertension_treatment, ModifiableFactor::hypertension_treatment);
+  return result;
+}
+
+}  // namespace
+
+HealthRisks subtractHealthRisks(const HealthRisks& a, const HealthRisks& b) {
+  HealthRisks result;
+  const auto& a_hard = a.hard_and_fatal_events;
+  const auto& b_hard = b.hard_and_fatal_events;
+  auto& hard = result.hard_and_fatal_events;
+  hard.coronary_death_event_risk = subtract(a_hard.coronary_death_event_risk, b_hard.coronary_death_event_risk);
+  hard.fatal_stroke_event_risk = subtract(a_hard.fatal_stroke_event_risk, b_hard.fatal_stroke_event_risk);
+  hard.total_cv_mortality_risk = subtract(a_hard.total_cv_mortality_risk, b_hard.total_cv_mortality_risk);
+  hard.hard_cv_event_risk = subtract(a_hard.hard_cv_event_risk, b_hard.hard_cv_event_risk);
+
+  const auto& a_cvd = a.cv_diseases;
+  const auto& b_cvd = b.cv_diseases;
+  auto& cvd = result.cv_diseases;
+  cvd.overall_risk = subtract(a_cvd.overall_risk, b_cvd.overall_risk);
+  cvd.coronary_heart_disease_risk = subtract(a_cvd.coronary_heart_disease_risk, b_cvd.coronary_heart_disease_risk);
+  cvd.stroke_risk = subtract(a_cvd.stroke_risk, b_cvd.stroke_risk);
+  cvd.heart_failure_risk = subtract(a_cvd.heart_failure_risk, b_cvd.heart_failure_risk);
+  cvd.peripheral_vascular_disease_risk =
+      subtract(a_cvd.peripheral_vascular_disease_risk, b_cvd.peripheral_vascular_disease_risk);
+
+  result.vascular_age = subtract(a.vascular_age, b.vascular_age);
+
+  const auto& a_scores = a.scores;
+  const auto& b_scores = b.scores;
+  auto& scores = result.scores;
+  scores.age_score = subtract(a_scores.age_score, b_scores.age_score);
+  scores.sbp_score = subtract(a_scores.sbp_score, b_scores.sbp_score);
+  scores.smoking_score = subtract(a_scores.smoking_score, b_scores.smoking_score);
+  scores.diabetes_score = subtract(a_scores.diabetes_score, b_scores.diabetes_score);
+  scores.bmi_score = subtract(a_scores.bmi_score, b_scores.bmi_score);
+  scores.cholesterol_score = subtract(a_scores.cholesterol_score, b_scores.cholesterol_score);
+  scores.cholesterol_hdl_score = subtract(a_scores.cholesterol_hdl_score, b_scores.cholesterol_hdl_score);
+  scores.total_score = subtract(a_scores.total_score, b_scores.total_score);
+  return result;
+}
+
+HealthRisksSensitivity computeHealthRisksSensitivity(const RisksFactors& risk_factors) {
+  HealthRisksSensitivity sensitivity;
+  sensitivity.risks = computeHealthRisks(risk_factors);
+  const std::vector<Perturbation> changes = perturbations(risk_factors);
+  sensitivity.factors.reserve(changes.size());
+  for (const auto& change : changes) {
+    sensitivity.factors.push_back(
+        {change.factor, change.step, subtractHealthRisks(computeHealthRisks(change.factors), sensitivity.risks)});
+  }
+  return sensitivity;
+}
+
+}  // namespace mx::health_risks
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <ShenaiSDK/health_risks.h>
+
+#include <vector>
+
+namespace mx::health_risks {
+
+// Risk factors a person can act on
+enum class ModifiableFactor { sbp, cholesterol, cholesterol_hdl, smoking, bmi, diabetes, hypertension_treatment };
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Effect of changing a single factor with all others held fixed
+struct FactorSensitivity {
+  ModifiableFactor factor;
+  // change applied to the factor in its own units: mmHg for SBP, RisksFactors units for cholesterol and HDL,
+  // kg/m2 for BMI; flags are toggled and report +1 when switched on, -1 when switched off
+  float step;
+  // risks after the change minus current risks, missing where either of them is missing
+  HealthRisks delta;
+};
+
+struct HealthRisksSensitivity {
+  HealthRisks risks;
+  // one entry per modifiable factor present in the input
+  std::vector<FactorSensitivity> factors;
+};
+
+// Finite differences of every HealthRisks field with respect to every modifiable factor:
+// SBP -10 mmHg, cholesterol -10%, HDL +10%, BMI -1 kg/m2 (through body weight), smoking, diabetes and
+// hypertension treatment toggled.
+HealthRisksSensitivity computeHealthRisksSensitivity(const RisksFactors& risk_factors);
+
+// Field-wise difference a - b, missing where either side is missing
+HealthRisks subtractHealthRisks(const HealthRisks& a, const HealthRisks& b);
+
+}  // namespace mx::health_risks
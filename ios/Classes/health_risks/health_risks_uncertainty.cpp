@@ -0,0 +1,301 @@
+#include "health_risks_uncertainty.h"
+
+#include "health_risks_batch.h"
+#include "health_risks_grid.h"
+#include "work_stealing_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace mx::health_risks {
+
+namespace {
+
+// samples per random stream and per pool task, fixed so the draws don't depend on the thread count
+constexpr std::size_t kChunkSamples = 256;
+constexpr std::size_t kFloatMetrics = static_cast<std::size_t>(HealthRisksMetric::vascular_age);
+constexpr std::size_t kMetrics = static_cast<std::size_t>(HealthRisksMetric::total_score) + 1;
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+constexpr double kTwoPi = 6.283185307179586;
+
+uint64_t splitmix64(uint64_t& state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+// Independent normal stream per (seed, chunk), Box-Muller over splitmix64
+class NormalStream {
+ public:
+  NormalStream(uint64_t seed, uint64_t chunk) : state_(seed) {
+    uint64_t mix = chunk;
+    state_ ^= splitmix64(mix);
+  }
+
+  double next() {
+    if (spare_) {
+      const double value = *spare_;
+      spare_.reset();
+      return value;
+    }
+    // 53 random bits in (0, 1], so the logarithm is finite
+    const double u1 = static_cast<double>((splitmix64(state_) >> 11) + 1) * 0x1.0p-53;
+    const double u2 = static_cast<double>(splitmix64(state_) >> 11) * 0x1.0p-53;
+    const double radius = std::sqrt(-2.0 * std::log(u1));
+    const double angle = kTwoPi * u2;
+    spare_ = radius * std::sin(angle);
+    return radius * std::cos(angle);
+  }
+
+  // normal draw truncated at zero, measured factors are never negative
+  float positive(float mean, float sd) {
+    while (true) {
+      const float value = static_cast<float>(mean + sd * next());
+      if (value > 0) {
+        return value;
+      }
+    }
+  }
+
+ private:
+  uint64_t state_;
+  std::optional<double> spare_;
+};
+
+WorkStealingPool& samplingPool() {
+  static WorkStealingPool pool;
+  return pool;
+}
+
+// Sampled inputs and their scores for every sample, in columns
+struct SampleColumns {
+  SampleColumns(const RisksFactors& base, std::size_t count)
+      : age(count, base.age ? *base.age : kMissingInt),
+        cholesterol(count, base.cholesterol.value_or(kNaN)),
+        cholesterol_hdl(count, base.cholesterol_hdl.value_or(kNaN)),
+        sbp(count, base.sbp.value_or(kNaN)),
+        body_height(count, base.body_height.value_or(kNaN)),
+        body_weight(count, base.body_weight.value_or(kNaN)),
+        flags(count, risksFactorsFlags(base)),
+        gender(count, base.gender ? static_cast<uint8_t>(*base.gender) : kMissingCategory),
+        race(count, base.race ? static_cast<uint8_t>(*base.race) : kMissingCategory),
+        country(count, encodeCountryCode(base.country)) {
+    for (auto& column : risks) {
+      column.assign(count, kNaN);
+    }
+    for (auto& column : integers) {
+      column.assign(count, kMissingInt);
+    }
+  }
+
+  RisksFactorsColumns inputAt(std::size_t begin, std::size_t end) const {
+    RisksFactorsColumns input;
+    input.count = end - begin;
+    input.age = age.data() + begin;
+    input.cholesterol = cholesterol.data() + begin;
+    input.cholesterol_hdl = cholesterol_hdl.data() + begin;
+    input.sbp = sbp.data() + begin;
+    input.body_height = body_height.data() + begin;
+    input.body_weight = body_weight.data() + begin;
+    input.flags = flags.data() + begin;
+    input.gender = gender.data() + begin;
+    input.race = race.data() + begin;
+    input.country = country.data() + begin;
+    return input;
+  }
+
+  HealthRisksColumns outputAt(std::size_t begin) {
+    HealthRisksColumns output;
+    output.coronary_death_event_risk = risks[0].data() + begin;
+    output.fatal_stroke_event_risk = risks[1].data() + begin;
+    output.total_cv_mortality_risk = risks[2].data() + begin;
+    output.hard_cv_event_risk = risks[3].data() + begin;
+    output.overall_risk = risks[4].data() + begin;
+    output.coronary_heart_disease_risk = risks[5].data() + begin;
+    output.stroke_risk = risks[6].data() + begin;
+    output.heart_failure_risk = risks[7].data() + begin;
+    output.peripheral_vascular_disease_risk = risks[8].data() + begin;
+    output.vascular_age = integers[0].data() + begin;
+    output.age_score = integers[1].data() + begin;
+    output.sbp_score = integers[2].data() + begin;
+    output.smoking_score = integers[3].data() + begin;
+    output.diabetes_score = integers[4].data() + begin;
+    output.bmi_score = integers[5].data() + begin;
+    output.cholesterol_score = integers[6].data() + begin;
+    output.cholesterol_hdl_score = integers[7].data() + begin;
+    output.total_score = integers[8].data() + begin;
+    return output;
+  }
+
+  std::vector<int32_t> age;
+  std::vector<float> cholesterol;
+  std::vector<float> cholesterol_hdl;
+  std::vector<float> sbp;
+  std::vector<float> body_height;
+  std::vector<float> body_weight;
+  std::vector<uint8_t> flags;
+  std::vector<uint8_t> gender;
+  std::vector<uint8_t> race;
+  std::vector<uint16_t> country;
+
+  std::array<std::vector<float>, kFloatMetrics> risks;
+  std::array<std::vector<int32_t>, kMetrics - kFloatMetrics> integers;
+};
+
+void sampleFactor(NormalStream& stream, const std::optional<float>& mean, float sd, float& value) {
+  if (mean && *mean > 0 && sd > 0) {
+    value = stream.positive(*mean, sd);
+  }
+}
+
+// Nearest-rank percentiles of the present values, reordering them in place
+std::array<std::optional<float>, 3> percentiles(std::vector<float>& values, const UncertaintyOptions& options) {
+  if (values.empty()) {
+    return {};
+  }
+  const auto rank = [&values](float percentile) {
+    const float clamped = std::clamp(percentile, 0.0f, 100.0f);
+    return static_cast<std::size_t>(std::lround(clamped / 100.0f * static_cast<float>(values.size() - 1)));
+  };
+  std::array<std::optional<float>, 3> result;
+  const std::array<std::size_t, 3> ranks = {rank(options.lower_percentile), rank(50.0f),
+                                            rank(options.upper_percentile)};
+  for (std::size_t i = 0; i < ranks.size(); ++i) {
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(ranks[i]), values.end());
+    result[i] = values[ranks[i]];
+  }
+  return result;
+}
+
+void setMetric(HealthRisks& risks, HealthRisksMetric metric, const std::optional<float>& value) {
+  const std::optional<int> integer = value ? std::optional<int>(static_cast<int>(std::lround(*value))) : std::nullopt;
+  switch (metric) {
+    case HealthRisksMetric::coronary_death_event_risk:
+      risks.hard_and_fatal_events.coronary_death_event_risk = value;
+      break;
+    case HealthRisksMetric::fatal_stroke_event_risk:
+      risks.hard_and_fatal_events.fatal_stroke_event_risk = value;
+      break;
+    case HealthRisksMetric::total_cv_mortality_risk:
+      risks.hard_and_fatal_events.total_cv_mortality_risk = value;
+      break;
+    case HealthRisksMetric::hard_cv_event_risk:
+      risks.hard_and_fatal_events.hard_cv_event_risk = value;
+      break;
+    case HealthRisksMetric::overall_risk:
+      risks.cv_diseases.overall_risk = value;
+      break;
+    case HealthRisksMetric::coronary_heart_disease_risk:
+      risks.cv_diseases.coronary_heart_disease_risk = value;
+      break;
+    case HealthRisksMetric::stroke_risk:
+      risks.cv_diseases.stroke_risk = value;
+      break;
+    case HealthRisksMetric::heart_failure_risk:
+      risks.cv_diseases.heart_failure_risk = value;
+      break;
+    case HealthRisksMetric::peripheral_vascular_disease_risk:
+      risks.cv_diseases.peripheral_vascular_disease_risk = value;
+      break;
+    case HealthRisksMetric::vascular_age:
+      risks.vascular_age = integer;
+      break;
+    case HealthRisksMetric::age_score:
+      risks.scores.age_score = integer;
+      break;
+    case HealthRisksMetric::sbp_score:
+      risks.scores.sbp_score = integer;
+      break;
+    case HealthRisksMetric::smoking_score:
+      risks.scores.smoking_score = integer;
+      break;
+    case HealthRisksMetric::diabetes_score:
+      risks.scores.diabetes_score = integer;
+      break;
+    case HealthRisksMetric::bmi_score:
+      risks.scores.bmi_score = integer;
+      break;
+    case HealthRisksMetric::cholesterol_score:
+      risks.scores.cholesterol_score = integer;
+      break;
+    case HealthRisksMetric::cholesterol_hdl_score:
+      risks.scores.cholesterol_hdl_score = integer;
+      break;
+    case HealthRisksMetric::total_score:
+      risks.scores.total_score = integer;
+      break;
+  }
+}
+
+}  // namespace
+
+HealthRisksInterval computeHealthRisksUncertainty(const RisksFactors& risk_factors,
+                                                  const RisksFactorsUncertainty& uncertainty,
+                                                  const UncertaintyOptions& options) {
+  const std::size_t count = std::max<uint32_t>(options.samples, 1);
+  const std::size_t chunks = (count + kChunkSamples - 1) / kChunkSamples;
+  // countries the columns can't encode are scored record by record with the original string
+  const bool per_record = encodeCountryCode(risk_factors.country) == kMissingCountry && !risk_factors.country.empty();
+
+  SampleColumns samples(risk_factors, count);
+  WorkStealingPool& pool = samplingPool();
+  pool.parallelFor(chunks, [&](std::size_t chunk) {
+    const std::size_t begin = chunk * kChunkSamples;
+    const std::size_t end = std::min(count, begin + kChunkSamples);
+
+    NormalStream stream(options.seed, chunk);
+    for (std::size_t i = begin; i < end; ++i) {
+      sampleFactor(stream, risk_factors.sbp, uncertainty.sbp, samples.sbp[i]);
+      sampleFactor(stream, risk_factors.cholesterol, uncertainty.cholesterol, samples.cholesterol[i]);
+      sampleFactor(stream, risk_factors.cholesterol_hdl, uncertainty.cholesterol_hdl, samples.cholesterol_hdl[i]);
+      sampleFactor(stream, risk_factors.body_height, uncertainty.body_height, samples.body_height[i]);
+      sampleFactor(stream, risk_factors.body_weight, uncertainty.body_weight, samples.body_weight[i]);
+    }
+
+    const RisksFactorsColumns input = samples.inputAt(begin, end);
+    const HealthRisksColumns output = samples.outputAt(begin);
+    if (per_record) {
+      for (std::size_t i = 0; i < input.count; ++i) {
+        RisksFactors factors = risksFactorsAt(input, i);
+        factors.country = risk_factors.country;
+        storeHealthRisks(computeHealthRisks(factors), output, i);
+      }
+    } else {
+      computeHealthRisksBatch(input, output, {.num_threads = 1});
+    }
+  });
+
+  std::array<std::array<std::optional<float>, 3>, kMetrics> bounds;
+  pool.parallelFor(kMetrics, [&](std::size_t metric) {
+    std::vector<float> values;
+    values.reserve(count);
+    if (metric < kFloatMetrics) {
+      std::copy_if(samples.risks[metric].begin(), samples.risks[metric].end(), std::back_inserter(values),
+                   [](float value) { return !std::isnan(value); });
+    } else {
+      for (int32_t value : samples.integers[metric - kFloatMetrics]) {
+        if (value != kMissingInt) {
+          values.push_back(static_cast<float>(value));
+        }
+      }
+    }
+    bounds[metric] = percentiles(values, options);
+  });
+
+  HealthRisksInterval interval;
+  for (std::size_t metric = 0; metric < kMetrics; ++metric) {
+    const auto field = static_cast<HealthRisksMetric>(metric);
+    setMetric(interval.lower, field, bounds[metric][0]);
+    setMetric(interval.median, field, bounds[metric][1]);
+    setMetric(interval.upper, field, bounds[metric][2]);
+  }
+  return interval;
+}
+
+}  // namespace mx::health_risks
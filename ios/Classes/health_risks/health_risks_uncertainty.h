@@ -0,0 +1,49 @@
+#pragma once
+
+#include <ShenaiSDK/health_risks.h>
+
+#include <cstdint>
+
+namespace mx::health_risks {
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Standard deviations of the measured factors, in RisksFactors units.
+/// The RisksFactors values are the means; a zero deviation (or a missing factor) is not sampled.
+struct RisksFactorsUncertainty {
+  float sbp = 0;
+  float cholesterol = 0;
+  float cholesterol_hdl = 0;
+  float body_height = 0;
+  float body_weight = 0;
+};
+
+// Most samples the plugin accepts per call, every sample is one SDK call
+constexpr uint32_t kMaxUncertaintySamples = 100000;
+
+struct UncertaintyOptions {
+  uint32_t samples = 2000;
+  // results only depend on the seed, never on the number of threads
+  uint64_t seed = 0;
+  // percentiles in [0, 100] reported as the interval bounds
+  float lower_percentile = 2.5f;
+  float upper_percentile = 97.5f;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Percentiles of every HealthRisks field over the sampled factors.
+/// A field is missing where it was missing for every sample.
+struct HealthRisksInterval {
+  HealthRisks lower;
+  HealthRisks median;
+  HealthRisks upper;
+};
+
+// Monte Carlo propagation of measurement errors into the health risks.
+// Factors are drawn from normal distributions truncated at zero, in fixed-size chunks whose random streams are
+// derived from the seed and the chunk index. Chunks are sampled and scored through the columnar batch on a shared
+// work-stealing pool.
+HealthRisksInterval computeHealthRisksUncertainty(const RisksFactors& risk_factors,
+                                                  const RisksFactorsUncertainty& uncertainty,
+                                                  const UncertaintyOptions& options = {});
+
+}  // namespace mx::health_risks
@@ -0,0 +1,125 @@
+#include "work_stealing_pool.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace mx::health_risks {
+
+WorkStealingPool::WorkStealingPool(unsigned num_threads) {
+  if (num_threads == 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(num_threads);
+  for (unsigned i = 0; i < num_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  threads_.reserve(num_threads);
+  for (unsigned i = 0; i < num_threads; ++i) {
+    threads_.emplace_back(&WorkStealingPool::workerLoop, this, i);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(job_mutex_);
+    stop_ = true;
+  }
+  job_cv_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkStealingPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) {
+  if (count == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+  const std::size_t block = (count + workers_.size() - 1) / workers_.size();
+  for (std::size_t w = 0; w < workers_.size(); ++w) {
+    std::lock_guard<std::mutex> lock(workers_[w]->mutex);
+    for (std::size_t i = w * block; i < std::min(count, (w + 1) * block); ++i) {
+      workers_[w]->tasks.push_back(i);
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(job_mutex_);
+  remaining_.store(count, std::memory_order_relaxed);
+  job_ = &task;
+  ++generation_;
+  job_cv_.notify_all();
+  done_cv_.wait(lock, [this] { return remaining_.load(std::memory_order_acquire) == 0 && active_workers_ == 0; });
+  // workers waking up late must not pick up a finished job
+  job_ = nullptr;
+}
+
+std::vector<double> WorkStealingPool::busySeconds() const {
+  std::vector<double> seconds;
+  seconds.reserve(workers_.size());
+  for (const auto& worker : workers_) {
+    seconds.push_back(static_cast<double>(worker->busy_ns.load(std::memory_order_relaxed)) * 1e-9);
+  }
+  return seconds;
+}
+
+bool WorkStealingPool::takeTask(std::size_t self, std::size_t& index) {
+  {
+    Worker& own = *workers_[self];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      index = own.tasks.front();
+      own.tasks.pop_front();
+      return true;
+    }
+  }
+  for (std::size_t offset = 1; offset < workers_.size(); ++offset) {
+    Worker& victim = *workers_[(self + offset) % workers_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      index = victim.tasks.back();
+      victim.tasks.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingPool::workerLoop(std::size_t self) {
+  uint64_t seen_generation = 0;
+  Worker& worker = *workers_[self];
+  while (true) {
+    const std::function<void(std::size_t)>* job = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(job_mutex_);
+      job_cv_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+      if (stop_) {
+        return;
+      }
+      seen_generation = generation_;
+      if (job_ == nullptr) {
+        continue;
+      }
+      job = job_;
+      ++active_workers_;
+    }
+
+    std::size_t index = 0;
+    while (takeTask(self, index)) {
+      const auto start = std::chrono::steady_clock::now();
+      (*job)(index);
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+      worker.busy_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                               std::memory_order_relaxed);
+      remaining_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(job_mutex_);
+      --active_workers_;
+    }
+    done_cv_.notify_one();
+  }
+}
+
+}  // namespace mx::health_risks
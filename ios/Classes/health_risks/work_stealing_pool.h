@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mx::health_risks {
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Fixed set of worker threads running indexed tasks.
+/// Every worker owns a deque seeded with a contiguous block of task indices, pops from its front and, once empty,
+/// steals from the back of the other workers, so uneven tasks still keep all cores busy.
+class WorkStealingPool {
+ public:
+  // 0 means std::thread::hardware_concurrency()
+  explicit WorkStealingPool(unsigned num_threads = 0);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  // Runs task(index) for every index in [0, count) and blocks until all of them finished
+  void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+
+  unsigned size() const { return static_cast<unsigned>(threads_.size()); }
+
+  // Time every worker spent running tasks since the pool was created
+  std::vector<double> busySeconds() const;
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::size_t> tasks;
+    std::atomic<int64_t> busy_ns{0};
+  };
+
+  void workerLoop(std::size_t self);
+  bool takeTask(std::size_t self, std::size_t& index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+
+  std::mutex run_mutex_;  // serializes parallelFor calls
+  std::mutex job_mutex_;
+  std::condition_variable job_cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(std::size_t)>* job_ = nullptr;
+  uint64_t generation_ = 0;
+  std::size_t active_workers_ = 0;
+  std::atomic<std::size_t> remaining_{0};
+  bool stop_ = false;
+};
+
+}  // namespace mx::health_risks
@@ -0,0 +1,46 @@
+#include "load_governor.h"
+
+namespace mx::performance {
+
+LoadGovernor::LoadGovernor(const LoadGovernorOptions& options) : options_(options) {}
+
+bool LoadGovernor::onFrame(double interval_sec, double expected_interval_sec, bool overloaded) {
+  if (options_.floor == QualityTier::full) {
+    return false;
+  }
+  ++frames_;
+  if (expected_interval_sec > 0 && interval_sec > expected_interval_sec * options_.late_frame_factor) {
+    ++late_frames_;
+  }
+  overloaded_ = overloaded_ || overloaded;
+  // an overloaded SDK has already stopped measuring, don't wait for the window to end
+  if (frames_ < options_.window_frames && !overloaded_) {
+    return false;
+  }
+
+  const double late_share = static_cast<double>(late_frames_) / frames_;
+  const QualityTier previous = tier_;
+  if (overloaded_ || late_share >= options_.step_down_late_share) {
+    headroom_windows_ = 0;
+    if (tier_ < options_.floor) {
+      tier_ = static_cast<QualityTier>(static_cast<uint8_t>(tier_) + 1);
+    }
+  } else if (late_share <= options_.step_up_late_share) {
+    if (++headroom_windows_ >= options_.step_up_windows && tier_ != QualityTier::full) {
+      tier_ = static_cast<QualityTier>(static_cast<uint8_t>(tier_) - 1);
+      headroom_windows_ = 0;
+    }
+  } else {
+    headroom_windows_ = 0;
+  }
+  startWindow();
+  return tier_ != previous;
+}
+
+void LoadGovernor::startWindow() {
+  frames_ = 0;
+  late_frames_ = 0;
+  overloaded_ = false;
+}
+
+}  // namespace mx::performance
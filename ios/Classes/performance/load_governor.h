@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+namespace mx::performance {
+
+// Quality tiers from best to cheapest, in Pigeon QualityTier order
+enum class QualityTier : uint8_t {
+  full,
+  reduced_overlays,  // blood flow overlay off
+  minimal_overlays,  // blood flow and face mask overlays off
+};
+
+struct LoadGovernorOptions {
+  // lowest tier the governor may step down to, `full` disables it
+  QualityTier floor = QualityTier::full;
+  // frames per evaluation window
+  uint32_t window_frames = 60;
+  // a frame is late when it took longer than this many expected frame intervals
+  double late_frame_factor = 1.5;
+  // share of late frames in a window that steps the tier down
+  double step_down_late_share = 0.25;
+  // share of late frames under which a window counts as having headroom
+  double step_up_late_share = 0.05;
+  // consecutive windows with headroom needed to step back up
+  uint32_t step_up_windows = 3;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Steps the quality tier down one level when too many display frames run late, or when the SDK reports it is
+/// overloaded, and back up one level after several windows with headroom.
+/// Not thread safe, fed from the display frame callback.
+class LoadGovernor {
+ public:
+  explicit LoadGovernor(const LoadGovernorOptions& options);
+
+  // Accounts one display frame, returns true when the tier changed
+  bool onFrame(double interval_sec, double expected_interval_sec, bool overloaded);
+
+  QualityTier tier() const { return tier_; }
+
+ private:
+  void startWindow();
+
+  LoadGovernorOptions options_;
+  QualityTier tier_ = QualityTier::full;
+  uint32_t frames_ = 0;
+  uint32_t late_frames_ = 0;
+  bool overloaded_ = false;
+  uint32_t headroom_windows_ = 0;
+};
+
+}  // namespace mx::performance
@@ -0,0 +1,138 @@
+#include "stage_counters.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace mx::performance {
+
+namespace {
+
+// Four buckets per octave of microseconds, bucket 0 holds calls under 1 us, the last one everything above ~4 min
+constexpr std::size_t kBucketsPerOctave = 4;
+constexpr std::size_t kBuckets = 1 + 28 * kBucketsPerOctave;
+
+std::size_t bucketOf(uint64_t micros) {
+  if (micros == 0) {
+    return 0;
+  }
+  const int octave = 63 - __builtin_clzll(micros);
+  // the two bits below the leading one pick the quarter of the octave
+  const uint64_t quarter = octave >= 2 ? (micros >> (octave - 2)) & 3 : (micros << (2 - octave)) & 3;
+  return std::min(kBuckets - 1, 1 + static_cast<std::size_t>(octave) * kBucketsPerOctave + quarter);
+}
+
+double bucketUpperBoundMs(std::size_t bucket) {
+  if (bucket == 0) {
+    return 0.001;
+  }
+  const std::size_t octave = (bucket - 1) / kBucketsPerOctave;
+  const std::size_t quarter = (bucket - 1) % kBucketsPerOctave;
+  return static_cast<double>(uint64_t{1} << octave) * (1.0 + static_cast<double>(quarter + 1) / kBucketsPerOctave) /
+         1000.0;
+}
+
+void atomicMax(std::atomic<uint64_t>& target, uint64_t value) {
+  uint64_t current = target.load(std::memory_order_relaxed);
+  while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+struct StageCounters {
+  std::array<std::atomic<uint64_t>, kBuckets> buckets{};
+  std::atomic<uint64_t> max_ns{0};
+  std::atomic<uint64_t> in_flight{0};
+  std::atomic<uint64_t> max_in_flight{0};
+
+  uint64_t take(std::atomic<uint64_t>& counter, bool reset) {
+    return reset ? counter.exchange(0, std::memory_order_relaxed) : counter.load(std::memory_order_relaxed);
+  }
+
+  StageStats stats(bool reset) {
+    std::array<uint64_t, kBuckets> counts;
+    StageStats stats;
+    for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+      counts[bucket] = take(buckets[bucket], reset);
+      stats.count += counts[bucket];
+    }
+    stats.max_ms = static_cast<double>(take(max_ns, reset)) / 1e6;
+    stats.max_in_flight = static_cast<uint32_t>(
+        reset ? max_in_flight.exchange(in_flight.load(std::memory_order_relaxed), std::memory_order_relaxed)
+              : max_in_flight.load(std::memory_order_relaxed));
+    if (stats.count == 0) {
+      return stats;
+    }
+
+    const auto percentile = [&](double fraction) {
+      const auto rank = static_cast<uint64_t>(fraction * static_cast<double>(stats.count - 1));
+      uint64_t seen = 0;
+      for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+        seen += counts[bucket];
+        if (seen > rank) {
+          return std::min(bucketUpperBoundMs(bucket), stats.max_ms);
+        }
+      }
+      return stats.max_ms;
+    };
+    stats.p50_ms = percentile(0.50);
+    stats.p95_ms = percentile(0.95);
+    return stats;
+  }
+};
+
+std::array<StageCounters, kStageCount>& stageCounters() {
+  static std::array<StageCounters, kStageCount> counters;
+  return counters;
+}
+
+int64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int64_t processCpuTimeUs() {
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  return (static_cast<int64_t>(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000000 + usage.ru_utime.tv_usec +
+         usage.ru_stime.tv_usec;
+}
+
+// Start of the current window, both process wide
+std::atomic<int64_t> g_window_start_ns{nowNs()};
+std::atomic<int64_t> g_window_start_cpu_us{processCpuTimeUs()};
+
+}  // namespace
+
+PerformanceStats performanceStats(bool reset) {
+  const int64_t now = nowNs();
+  const int64_t cpu = processCpuTimeUs();
+  const int64_t window_start = reset ? g_window_start_ns.exchange(now) : g_window_start_ns.load();
+  const int64_t window_start_cpu = reset ? g_window_start_cpu_us.exchange(cpu) : g_window_start_cpu_us.load();
+
+  PerformanceStats stats;
+  stats.window_sec = static_cast<double>(now - window_start) / 1e9;
+  stats.cpu_time_ms = static_cast<double>(cpu - window_start_cpu) / 1e3;
+  for (std::size_t stage = 0; stage < kStageCount; ++stage) {
+    stats.stages[stage] = stageCounters()[stage].stats(reset);
+  }
+  return stats;
+}
+
+ScopedStage::ScopedStage(Stage stage) : stage_(stage), started_(std::chrono::steady_clock::now()) {
+  StageCounters& counters = stageCounters()[static_cast<std::size_t>(stage_)];
+  atomicMax(counters.max_in_flight, counters.in_flight.fetch_add(1, std::memory_order_relaxed) + 1);
+}
+
+ScopedStage::~ScopedStage() {
+  const auto duration = std::chrono::steady_clock::now() - started_;
+  const auto nanos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+  StageCounters& counters = stageCounters()[static_cast<std::size_t>(stage_)];
+  counters.buckets[bucketOf(nanos / 1000)].fetch_add(1, std::memory_order_relaxed);
+  atomicMax(counters.max_ns, nanos);
+  counters.in_flight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}  // namespace mx::performance
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace mx::performance {
+
+// Plugin stages whose latency is tracked, in Pigeon PerformanceStats field order
+enum class Stage : uint8_t {
+  initialize,
+  state_snapshot,
+  image_export,
+  signal_export,
+  health_risks,
+};
+
+constexpr std::size_t kStageCount = static_cast<std::size_t>(Stage::health_risks) + 1;
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Latency distribution of one stage over the stats window.
+/// Percentiles are read from a histogram with four buckets per octave, so they are accurate to about 19%.
+struct StageStats {
+  uint64_t count = 0;
+  double p50_ms = 0;
+  double p95_ms = 0;
+  double max_ms = 0;
+  // largest number of calls of the stage running at once, e.g. queued behind each other on the main thread
+  uint32_t max_in_flight = 0;
+};
+
+struct PerformanceStats {
+  double window_sec = 0;
+  // CPU time of the whole process (SDK processing threads included) over the window
+  double cpu_time_ms = 0;
+  std::array<StageStats, kStageCount> stages;
+};
+
+// Stats since the last reset (or since the process started), optionally starting a new window
+PerformanceStats performanceStats(bool reset);
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Records the lifetime of the scope as one call of the stage.
+/// Costs two clock reads and a handful of relaxed atomic operations, cheap enough to wrap every bridged call.
+class ScopedStage {
+ public:
+  explicit ScopedStage(Stage stage);
+  ~ScopedStage();
+
+  ScopedStage(const ScopedStage&) = delete;
+  ScopedStage& operator=(const ScopedStage&) = delete;
+
+ private:
+  Stage stage_;
+  std::chrono::steady_clock::time_point started_;
+};
+
+}  // namespace mx::performance
@@ -15,6 +15,7 @@ typedef NS_ENUM(NSUInteger, InitializationResult) {
   InitializationResultFailInvalidApiKey = 1,
   InitializationResultFailConnectionError = 2,
   InitializationResultFailInternalError = 3,
+  InitializationResultCancelled = 4,
 };
 
 /// Wrapper for InitializationResult to allow for nullability.
@@ -85,6 +86,18 @@ typedef NS_ENUM(NSUInteger, OnboardingMode) {
 - (instancetype)initWithValue:(OnboardingMode)value;
 @end
 
+typedef NS_ENUM(NSUInteger, QualityTier) {
+  QualityTierFull = 0,
+  QualityTierReducedOverlays = 1,
+  QualityTierMinimalOverlays = 2,
+};
+
+/// Wrapper for QualityTier to allow for nullability.
+@interface QualityTierBox : NSObject
+@property(nonatomic, assign) QualityTier value;
+- (instancetype)initWithValue:(QualityTier)value;
+@end
+
 typedef NS_ENUM(NSUInteger, FaceState) {
   FaceStateOk = 0,
   FaceStateTooFar = 1,
@@ -141,15 +154,78 @@ typedef NS_ENUM(NSUInteger, Race) {
 - (instancetype)initWithValue:(Race)value;
 @end
 
+typedef NS_ENUM(NSUInteger, ModifiableRiskFactor) {
+  ModifiableRiskFactorSbp = 0,
+  ModifiableRiskFactorCholesterol = 1,
+  ModifiableRiskFactorCholesterolHdl = 2,
+  ModifiableRiskFactorSmoking = 3,
+  ModifiableRiskFactorBmi = 4,
+  ModifiableRiskFactorDiabetes = 5,
+  ModifiableRiskFactorHypertensionTreatment = 6,
+};
+
+/// Wrapper for ModifiableRiskFactor to allow for nullability.
+@interface ModifiableRiskFactorBox : NSObject
+@property(nonatomic, assign) ModifiableRiskFactor value;
+- (instancetype)initWithValue:(ModifiableRiskFactor)value;
+@end
+
+typedef NS_ENUM(NSUInteger, HealthRisksGridFactor) {
+  HealthRisksGridFactorAge = 0,
+  HealthRisksGridFactorSbp = 1,
+  HealthRisksGridFactorCholesterol = 2,
+  HealthRisksGridFactorCholesterolHdl = 3,
+  HealthRisksGridFactorBodyWeight = 4,
+  HealthRisksGridFactorBodyHeight = 5,
+};
+
+/// Wrapper for HealthRisksGridFactor to allow for nullability.
+@interface HealthRisksGridFactorBox : NSObject
+@property(nonatomic, assign) HealthRisksGridFactor value;
+- (instancetype)initWithValue:(HealthRisksGridFactor)value;
+@end
+
+typedef NS_ENUM(NSUInteger, HealthRisksMetric) {
+  HealthRisksMetricCoronaryDeathEventRisk = 0,
+  HealthRisksMetricFatalStrokeEventRisk = 1,
+  HealthRisksMetricTotalCVMortalityRisk = 2,
+  HealthRisksMetricHardCVEventRisk = 3,
+  HealthRisksMetricOverallRisk = 4,
+  HealthRisksMetricCoronaryHeartDiseaseRisk = 5,
+  HealthRisksMetricStrokeRisk = 6,
+  HealthRisksMetricHeartFailureRisk = 7,
+  HealthRisksMetricPeripheralVascularDiseaseRisk = 8,
+  HealthRisksMetricVascularAge = 9,
+  HealthRisksMetricAgeScore = 10,
+  HealthRisksMetricSbpScore = 11,
+  HealthRisksMetricSmokingScore = 12,
+  HealthRisksMetricDiabetesScore = 13,
+  HealthRisksMetricBmiScore = 14,
+  HealthRisksMetricCholesterolScore = 15,
+  HealthRisksMetricCholesterolHdlScore = 16,
+  HealthRisksMetricTotalScore = 17,
+};
+
+/// Wrapper for HealthRisksMetric to allow for nullability.
+@interface HealthRisksMetricBox : NSObject
+@property(nonatomic, assign) HealthRisksMetric value;
+- (instancetype)initWithValue:(HealthRisksMetric)value;
+@end
+
+@class InitializationTimings;
 @class InitializeResponse;
 @class OperatingModeResponse;
 @class PrecisionModeResponse;
 @class MeasurementPresetResponse;
 @class CameraModeResponse;
+@class QualityTierResponse;
 @class FaceStateResponse;
 @class NormalizedFaceBbox;
 @class MeasurementStateResponse;
 @class Heartbeat;
+@class StateSnapshot;
+@class HeartRateHistory;
+@class Heartbeats;
 @class MeasurementResults;
 @class InitializationSettings;
 @class CustomMeasurementConfig;
@@ -159,12 +235,30 @@ typedef NS_ENUM(NSUInteger, Race) {
 @class CVDiseasesRisks;
 @class RisksFactorsScores;
 @class HealthRisks;
+@class HealthRisksBundle;
+@class RiskFactorSensitivity;
+@class HealthRisksSensitivity;
+@class HealthRisksGridAxis;
+@class RisksFactorsUncertainty;
+@class HealthRisksInterval;
+@class HealthRisksCacheStats;
+@class StagePerformance;
+@class PerformanceStats;
+
+@interface InitializationTimings : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithQueuedMs:(NSNumber *)queuedMs initializeMs:(NSNumber *)initializeMs;
+@property(nonatomic, strong) NSNumber *queuedMs;
+@property(nonatomic, strong) NSNumber *initializeMs;
+@end
 
 @interface InitializeResponse : NSObject
 /// `init` unavailable to enforce nonnull fields, see the `make` class method.
 - (instancetype)init NS_UNAVAILABLE;
-+ (instancetype)makeWithResult:(InitializationResult)result;
++ (instancetype)makeWithResult:(InitializationResult)result timings:(nullable InitializationTimings *)timings;
 @property(nonatomic, assign) InitializationResult result;
+@property(nonatomic, strong, nullable) InitializationTimings *timings;
 @end
 
 @interface OperatingModeResponse : NSObject
@@ -195,6 +289,13 @@ typedef NS_ENUM(NSUInteger, Race) {
 @property(nonatomic, assign) CameraMode mode;
 @end
 
+@interface QualityTierResponse : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithTier:(QualityTier)tier;
+@property(nonatomic, assign) QualityTier tier;
+@end
+
 @interface FaceStateResponse : NSObject
 /// `init` unavailable to enforce nonnull fields, see the `make` class method.
 - (instancetype)init NS_UNAVAILABLE;
@@ -230,6 +331,47 @@ typedef NS_ENUM(NSUInteger, Race) {
 @property(nonatomic, strong) NSNumber *duration_ms;
 @end
 
+@interface StateSnapshot : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithFaceState:(FaceState)faceState
+               normalizedFaceBbox:(nullable NormalizedFaceBbox *)normalizedFaceBbox
+                 measurementState:(MeasurementState)measurementState
+    measurementProgressPercentage:(NSNumber *)measurementProgressPercentage
+                      heartRate4s:(nullable NSNumber *)heartRate4s
+                     heartRate10s:(nullable NSNumber *)heartRate10s
+                    signalQuality:(NSNumber *)signalQuality
+            totalBadSignalSeconds:(NSNumber *)totalBadSignalSeconds;
+@property(nonatomic, assign) FaceState faceState;
+@property(nonatomic, strong, nullable) NormalizedFaceBbox *normalizedFaceBbox;
+@property(nonatomic, assign) MeasurementState measurementState;
+@property(nonatomic, strong) NSNumber *measurementProgressPercentage;
+@property(nonatomic, strong, nullable) NSNumber *heartRate4s;
+@property(nonatomic, strong, nullable) NSNumber *heartRate10s;
+@property(nonatomic, strong) NSNumber *signalQuality;
+@property(nonatomic, strong) NSNumber *totalBadSignalSeconds;
+@end
+
+@interface HeartRateHistory : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithTimestampsSec:(FlutterStandardTypedData *)timestampsSec
+                        heartRatesBpm:(FlutterStandardTypedData *)heartRatesBpm;
+@property(nonatomic, strong) FlutterStandardTypedData *timestampsSec;
+@property(nonatomic, strong) FlutterStandardTypedData *heartRatesBpm;
+@end
+
+@interface Heartbeats : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithStartLocationsSec:(FlutterStandardTypedData *)startLocationsSec
+                          endLocationsSec:(FlutterStandardTypedData *)endLocationsSec
+                              durationsMs:(FlutterStandardTypedData *)durationsMs;
+@property(nonatomic, strong) FlutterStandardTypedData *startLocationsSec;
+@property(nonatomic, strong) FlutterStandardTypedData *endLocationsSec;
+@property(nonatomic, strong) FlutterStandardTypedData *durationsMs;
+@end
+
 @interface MeasurementResults : NSObject
 /// `init` unavailable to enforce nonnull fields, see the `make` class method.
 - (instancetype)init NS_UNAVAILABLE;
@@ -240,7 +382,7 @@ typedef NS_ENUM(NSUInteger, Race) {
                     breathing_rate_bpm:(nullable NSNumber *)breathing_rate_bpm
           systolic_blood_pressure_mmhg:(nullable NSNumber *)systolic_blood_pressure_mmhg
          diastolic_blood_pressure_mmhg:(nullable NSNumber *)diastolic_blood_pressure_mmhg
-                            heartbeats:(NSArray<Heartbeat *> *)heartbeats
+                            heartbeats:(Heartbeats *)heartbeats
                 average_signal_quality:(NSNumber *)average_signal_quality;
 @property(nonatomic, strong) NSNumber *heart_rate_bpm;
 @property(nonatomic, strong, nullable) NSNumber *hrv_sdnn_ms;
@@ -249,7 +391,7 @@ typedef NS_ENUM(NSUInteger, Race) {
 @property(nonatomic, strong, nullable) NSNumber *breathing_rate_bpm;
 @property(nonatomic, strong, nullable) NSNumber *systolic_blood_pressure_mmhg;
 @property(nonatomic, strong, nullable) NSNumber *diastolic_blood_pressure_mmhg;
-@property(nonatomic, strong) NSArray<Heartbeat *> *heartbeats;
+@property(nonatomic, strong) Heartbeats *heartbeats;
 @property(nonatomic, strong) NSNumber *average_signal_quality;
 @end
 
@@ -266,7 +408,9 @@ typedef NS_ENUM(NSUInteger, Race) {
                          showFaceMask:(nullable NSNumber *)showFaceMask
                         showBloodFlow:(nullable NSNumber *)showBloodFlow
                        proVersionLock:(nullable NSNumber *)proVersionLock
-                       hideShenaiLogo:(nullable NSNumber *)hideShenaiLogo;
+                       hideShenaiLogo:(nullable NSNumber *)hideShenaiLogo
+                             headless:(nullable NSNumber *)headless
+                         qualityFloor:(nullable QualityTierBox *)qualityFloor;
 @property(nonatomic, strong, nullable) PrecisionModeBox *precisionMode;
 @property(nonatomic, strong, nullable) OperatingModeBox *operatingMode;
 @property(nonatomic, strong, nullable) MeasurementPresetBox *measurementPreset;
@@ -280,6 +424,8 @@ typedef NS_ENUM(NSUInteger, Race) {
 @property(nonatomic, strong, nullable) NSNumber *showBloodFlow;
 @property(nonatomic, strong, nullable) NSNumber *proVersionLock;
 @property(nonatomic, strong, nullable) NSNumber *hideShenaiLogo;
+@property(nonatomic, strong, nullable) NSNumber *headless;
+@property(nonatomic, strong, nullable) QualityTierBox *qualityFloor;
 @end
 
 @interface CustomMeasurementConfig : NSObject
@@ -401,15 +547,118 @@ typedef NS_ENUM(NSUInteger, Race) {
 @property(nonatomic, strong) RisksFactorsScores *scores;
 @end
 
+@interface HealthRisksBundle : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithActual:(HealthRisks *)actual minimal:(HealthRisks *)minimal maximal:(HealthRisks *)maximal;
+@property(nonatomic, strong) HealthRisks *actual;
+@property(nonatomic, strong) HealthRisks *minimal;
+@property(nonatomic, strong) HealthRisks *maximal;
+@end
+
+@interface RiskFactorSensitivity : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithFactor:(ModifiableRiskFactor)factor step:(NSNumber *)step delta:(HealthRisks *)delta;
+@property(nonatomic, assign) ModifiableRiskFactor factor;
+@property(nonatomic, strong) NSNumber *step;
+@property(nonatomic, strong) HealthRisks *delta;
+@end
+
+@interface HealthRisksSensitivity : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithRisks:(HealthRisks *)risks sensitivities:(NSArray<RiskFactorSensitivity *> *)sensitivities;
+@property(nonatomic, strong) HealthRisks *risks;
+@property(nonatomic, strong) NSArray<RiskFactorSensitivity *> *sensitivities;
+@end
+
+@interface HealthRisksGridAxis : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithFactor:(HealthRisksGridFactor)factor
+                           min:(NSNumber *)min
+                           max:(NSNumber *)max
+                         steps:(NSNumber *)steps;
+@property(nonatomic, assign) HealthRisksGridFactor factor;
+@property(nonatomic, strong) NSNumber *min;
+@property(nonatomic, strong) NSNumber *max;
+@property(nonatomic, strong) NSNumber *steps;
+@end
+
+@interface RisksFactorsUncertainty : NSObject
++ (instancetype)makeWithSbp:(nullable NSNumber *)sbp
+                cholesterol:(nullable NSNumber *)cholesterol
+             cholesterolHdl:(nullable NSNumber *)cholesterolHdl
+                 bodyHeight:(nullable NSNumber *)bodyHeight
+                 bodyWeight:(nullable NSNumber *)bodyWeight;
+@property(nonatomic, strong, nullable) NSNumber *sbp;
+@property(nonatomic, strong, nullable) NSNumber *cholesterol;
+@property(nonatomic, strong, nullable) NSNumber *cholesterolHdl;
+@property(nonatomic, strong, nullable) NSNumber *bodyHeight;
+@property(nonatomic, strong, nullable) NSNumber *bodyWeight;
+@end
+
+@interface HealthRisksInterval : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithLower:(HealthRisks *)lower median:(HealthRisks *)median upper:(HealthRisks *)upper;
+@property(nonatomic, strong) HealthRisks *lower;
+@property(nonatomic, strong) HealthRisks *median;
+@property(nonatomic, strong) HealthRisks *upper;
+@end
+
+@interface HealthRisksCacheStats : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithHits:(NSNumber *)hits misses:(NSNumber *)misses;
+@property(nonatomic, strong) NSNumber *hits;
+@property(nonatomic, strong) NSNumber *misses;
+@end
+
+@interface StagePerformance : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithCount:(NSNumber *)count
+                        p50Ms:(NSNumber *)p50Ms
+                        p95Ms:(NSNumber *)p95Ms
+                        maxMs:(NSNumber *)maxMs
+                  maxInFlight:(NSNumber *)maxInFlight;
+@property(nonatomic, strong) NSNumber *count;
+@property(nonatomic, strong) NSNumber *p50Ms;
+@property(nonatomic, strong) NSNumber *p95Ms;
+@property(nonatomic, strong) NSNumber *maxMs;
+@property(nonatomic, strong) NSNumber *maxInFlight;
+@end
+
+@interface PerformanceStats : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithWindowSec:(NSNumber *)windowSec
+                        cpuTimeMs:(NSNumber *)cpuTimeMs
+                       initialize:(StagePerformance *)initialize
+                    stateSnapshot:(StagePerformance *)stateSnapshot
+                      imageExport:(StagePerformance *)imageExport
+                     signalExport:(StagePerformance *)signalExport
+                      healthRisks:(StagePerformance *)healthRisks;
+@property(nonatomic, strong) NSNumber *windowSec;
+@property(nonatomic, strong) NSNumber *cpuTimeMs;
+@property(nonatomic, strong) StagePerformance *initialize;
+@property(nonatomic, strong) StagePerformance *stateSnapshot;
+@property(nonatomic, strong) StagePerformance *imageExport;
+@property(nonatomic, strong) StagePerformance *signalExport;
+@property(nonatomic, strong) StagePerformance *healthRisks;
+@end
+
 /// The codec used by ShenaiSdkNativeApi.
 NSObject<FlutterMessageCodec> *ShenaiSdkNativeApiGetCodec(void);
 
 @protocol ShenaiSdkNativeApi
-/// @return `nil` only when `error != nil`.
-- (nullable InitializeResponse *)initializeApiKey:(NSString *)apiKey
-                                           userId:(NSString *)userId
-                                         settings:(nullable InitializationSettings *)settings
-                                            error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)initializeApiKey:(NSString *)apiKey
+                  userId:(NSString *)userId
+                settings:(nullable InitializationSettings *)settings
+              completion:(void (^)(InitializeResponse *_Nullable, FlutterError *_Nullable))completion;
+- (void)cancelInitializationWithCompletion:(void (^)(FlutterError *_Nullable))completion;
 /// @return `nil` only when `error != nil`.
 - (nullable NSNumber *)isInitializedWithError:(FlutterError *_Nullable *_Nonnull)error;
 - (void)deinitializeWithCompletion:(void (^)(FlutterError *_Nullable))completion;
@@ -428,6 +677,10 @@ NSObject<FlutterMessageCodec> *ShenaiSdkNativeApiGetCodec(void);
 - (void)setCameraModeMode:(CameraMode)mode error:(FlutterError *_Nullable *_Nonnull)error;
 /// @return `nil` only when `error != nil`.
 - (nullable CameraModeResponse *)getCameraModeWithError:(FlutterError *_Nullable *_Nonnull)error;
+- (void)suspendWithCompletion:(void (^)(FlutterError *_Nullable))completion;
+- (void)resumeWithCompletion:(void (^)(FlutterError *_Nullable))completion;
+/// @return `nil` only when `error != nil`.
+- (nullable NSNumber *)isSuspendedWithError:(FlutterError *_Nullable *_Nonnull)error;
 - (void)setShowUserInterfaceShow:(NSNumber *)show error:(FlutterError *_Nullable *_Nonnull)error;
 /// @return `nil` only when `error != nil`.
 - (nullable NSNumber *)getShowUserInterfaceWithError:(FlutterError *_Nullable *_Nonnull)error;
@@ -446,6 +699,8 @@ NSObject<FlutterMessageCodec> *ShenaiSdkNativeApiGetCodec(void);
 - (void)setShowBloodFlowShow:(NSNumber *)show error:(FlutterError *_Nullable *_Nonnull)error;
 /// @return `nil` only when `error != nil`.
 - (nullable NSNumber *)getShowBloodFlowWithError:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable QualityTierResponse *)getQualityTierWithError:(FlutterError *_Nullable *_Nonnull)error;
 - (void)setEnableStartAfterSuccessEnable:(NSNumber *)enable error:(FlutterError *_Nullable *_Nonnull)error;
 /// @return `nil` only when `error != nil`.
 - (nullable NSNumber *)getEnableStartAfterSuccessWithError:(FlutterError *_Nullable *_Nonnull)error;
@@ -458,6 +713,8 @@ NSObject<FlutterMessageCodec> *ShenaiSdkNativeApiGetCodec(void);
 - (nullable NSNumber *)getMeasurementProgressPercentageWithError:(FlutterError *_Nullable *_Nonnull)error;
 - (nullable NSNumber *)getHeartRate10sWithError:(FlutterError *_Nullable *_Nonnull)error;
 - (nullable NSNumber *)getHeartRate4sWithError:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable StateSnapshot *)getStateSnapshotWithError:(FlutterError *_Nullable *_Nonnull)error;
 - (nullable MeasurementResults *)getRealtimeMetricsPeriod_sec:(NSNumber *)period_sec
                                                         error:(FlutterError *_Nullable *_Nonnull)error;
 - (nullable MeasurementResults *)getMeasurementResultsWithError:(FlutterError *_Nullable *_Nonnull)error;
@@ -472,6 +729,15 @@ NSObject<FlutterMessageCodec> *ShenaiSdkNativeApiGetCodec(void);
 - (nullable FlutterStandardTypedData *)getFaceTexturePngWithError:(FlutterError *_Nullable *_Nonnull)error;
 - (nullable FlutterStandardTypedData *)getFullPpgSignalWithError:(FlutterError *_Nullable *_Nonnull)error;
 /// @return `nil` only when `error != nil`.
+- (nullable HeartRateHistory *)getHeartRateHistory10sSinceSec:(nullable NSNumber *)sinceSec
+                                                        error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable HeartRateHistory *)getHeartRateHistory4sSinceSec:(nullable NSNumber *)sinceSec
+                                                       error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable Heartbeats *)getRealtimeHeartbeatsSinceSec:(nullable NSNumber *)sinceSec
+                                                 error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
 - (nullable NSString *)getTraceIDWithError:(FlutterError *_Nullable *_Nonnull)error;
 - (void)setLanguageLanguage:(NSString *)language error:(FlutterError *_Nullable *_Nonnull)error;
 /// @return `nil` only when `error != nil`.
@@ -483,6 +749,30 @@ NSObject<FlutterMessageCodec> *ShenaiSdkNativeApiGetCodec(void);
 /// @return `nil` only when `error != nil`.
 - (nullable HealthRisks *)getMaximalHealthRisksHealthRisksFactors:(RisksFactors *)healthRisksFactors
                                                             error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable HealthRisksBundle *)computeHealthRisksBundleHealthRisksFactors:(RisksFactors *)healthRisksFactors
+                                                                     error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable HealthRisksSensitivity *)computeHealthRisksSensitivityHealthRisksFactors:(RisksFactors *)healthRisksFactors
+                                                                               error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable FlutterStandardTypedData *)computeHealthRisksGridBaseFactors:(RisksFactors *)baseFactors
+                                                                   xAxis:(HealthRisksGridAxis *)xAxis
+                                                                   yAxis:(HealthRisksGridAxis *)yAxis
+                                                                  metric:(HealthRisksMetric)metric
+                                                                   error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable HealthRisksInterval *)computeHealthRisksUncertaintyHealthRisksFactors:(RisksFactors *)healthRisksFactors
+                                                                      uncertainty:(RisksFactorsUncertainty *)uncertainty
+                                                                          samples:(NSNumber *)samples
+                                                                             seed:(NSNumber *)seed
+                                                                            error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setHealthRisksCacheCapacityCapacity:(NSNumber *)capacity error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable HealthRisksCacheStats *)getHealthRisksCacheStatsWithError:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable PerformanceStats *)getPerformanceStatsReset:(NSNumber *)reset
+                                                  error:(FlutterError *_Nullable *_Nonnull)error;
 @end
 
 extern void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger,
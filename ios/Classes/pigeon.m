@@ -73,6 +73,16 @@
 }
 @end
 
+@implementation QualityTierBox
+- (instancetype)initWithValue:(QualityTier)value {
+  self = [super init];
+  if (self) {
+    _value = value;
+  }
+  return self;
+}
+@end
+
 @implementation FaceStateBox
 - (instancetype)initWithValue:(FaceState)value {
   self = [super init];
@@ -113,6 +123,36 @@
 }
 @end
 
+@implementation ModifiableRiskFactorBox
+- (instancetype)initWithValue:(ModifiableRiskFactor)value {
+  self = [super init];
+  if (self) {
+    _value = value;
+  }
+  return self;
+}
+@end
+
+@implementation HealthRisksGridFactorBox
+- (instancetype)initWithValue:(HealthRisksGridFactor)value {
+  self = [super init];
+  if (self) {
+    _value = value;
+  }
+  return self;
+}
+@end
+
+@implementation HealthRisksMetricBox
+- (instancetype)initWithValue:(HealthRisksMetric)value {
+  self = [super init];
+  if (self) {
+    _value = value;
+  }
+  return self;
+}
+@end
+
 static NSArray *wrapResult(id result, FlutterError *error) {
   if (error) {
     return @[
@@ -126,6 +166,12 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   return (result == [NSNull null]) ? nil : result;
 }
 
+@interface InitializationTimings ()
++ (InitializationTimings *)fromList:(NSArray *)list;
++ (nullable InitializationTimings *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
 @interface InitializeResponse ()
 + (InitializeResponse *)fromList:(NSArray *)list;
 + (nullable InitializeResponse *)nullableFromList:(NSArray *)list;
@@ -156,6 +202,12 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (NSArray *)toList;
 @end
 
+@interface QualityTierResponse ()
++ (QualityTierResponse *)fromList:(NSArray *)list;
++ (nullable QualityTierResponse *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
 @interface FaceStateResponse ()
 + (FaceStateResponse *)fromList:(NSArray *)list;
 + (nullable FaceStateResponse *)nullableFromList:(NSArray *)list;
@@ -180,6 +232,24 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (NSArray *)toList;
 @end
 
+@interface StateSnapshot ()
++ (StateSnapshot *)fromList:(NSArray *)list;
++ (nullable StateSnapshot *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface HeartRateHistory ()
++ (HeartRateHistory *)fromList:(NSArray *)list;
++ (nullable HeartRateHistory *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface Heartbeats ()
++ (Heartbeats *)fromList:(NSArray *)list;
++ (nullable Heartbeats *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
 @interface MeasurementResults ()
 + (MeasurementResults *)fromList:(NSArray *)list;
 + (nullable MeasurementResults *)nullableFromList:(NSArray *)list;
@@ -234,15 +304,99 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (NSArray *)toList;
 @end
 
+@interface HealthRisksBundle ()
++ (HealthRisksBundle *)fromList:(NSArray *)list;
++ (nullable HealthRisksBundle *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface RiskFactorSensitivity ()
++ (RiskFactorSensitivity *)fromList:(NSArray *)list;
++ (nullable RiskFactorSensitivity *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface HealthRisksSensitivity ()
++ (HealthRisksSensitivity *)fromList:(NSArray *)list;
++ (nullable HealthRisksSensitivity *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface HealthRisksGridAxis ()
++ (HealthRisksGridAxis *)fromList:(NSArray *)list;
++ (nullable HealthRisksGridAxis *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface RisksFactorsUncertainty ()
++ (RisksFactorsUncertainty *)fromList:(NSArray *)list;
++ (nullable RisksFactorsUncertainty *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface HealthRisksInterval ()
++ (HealthRisksInterval *)fromList:(NSArray *)list;
++ (nullable HealthRisksInterval *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface HealthRisksCacheStats ()
++ (HealthRisksCacheStats *)fromList:(NSArray *)list;
++ (nullable HealthRisksCacheStats *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface StagePerformance ()
++ (StagePerformance *)fromList:(NSArray *)list;
++ (nullable StagePerformance *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface PerformanceStats ()
++ (PerformanceStats *)fromList:(NSArray *)list;
++ (nullable PerformanceStats *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@implementation InitializationTimings
++ (instancetype)makeWithQueuedMs:(NSNumber *)queuedMs
+    initializeMs:(NSNumber *)initializeMs {
+  InitializationTimings* pigeonResult = [[InitializationTimings alloc] init];
+  pigeonResult.queuedMs = queuedMs;
+  pigeonResult.initializeMs = initializeMs;
+  return pigeonResult;
+}
++ (InitializationTimings *)fromList:(NSArray *)list {
+  InitializationTimings *pigeonResult = [[InitializationTimings alloc] init];
+  pigeonResult.queuedMs = GetNullableObjectAtIndex(list, 0);
+  NSAssert(pigeonResult.queuedMs != nil, @"");
+  pigeonResult.initializeMs = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.initializeMs != nil, @"");
+  return pigeonResult;
+}
++ (nullable InitializationTimings *)nullableFromList:(NSArray *)list {
+  return (list) ? [InitializationTimings fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.queuedMs ?: [NSNull null]),
+    (self.initializeMs ?: [NSNull null]),
+  ];
+}
+@end
+
 @implementation InitializeResponse
-+ (instancetype)makeWithResult:(InitializationResult)result {
++ (instancetype)makeWithResult:(InitializationResult)result
+    timings:(nullable InitializationTimings *)timings {
   InitializeResponse* pigeonResult = [[InitializeResponse alloc] init];
   pigeonResult.result = result;
+  pigeonResult.timings = timings;
   return pigeonResult;
 }
 + (InitializeResponse *)fromList:(NSArray *)list {
   InitializeResponse *pigeonResult = [[InitializeResponse alloc] init];
   pigeonResult.result = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.timings = [InitializationTimings nullableFromList:(GetNullableObjectAtIndex(list, 1))];
   return pigeonResult;
 }
 + (nullable InitializeResponse *)nullableFromList:(NSArray *)list {
@@ -251,6 +405,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (NSArray *)toList {
   return @[
     @(self.result),
+    (self.timings ? [self.timings toList] : [NSNull null]),
   ];
 }
 @end
@@ -339,6 +494,27 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 }
 @end
 
+@implementation QualityTierResponse
++ (instancetype)makeWithTier:(QualityTier)tier {
+  QualityTierResponse* pigeonResult = [[QualityTierResponse alloc] init];
+  pigeonResult.tier = tier;
+  return pigeonResult;
+}
++ (QualityTierResponse *)fromList:(NSArray *)list {
+  QualityTierResponse *pigeonResult = [[QualityTierResponse alloc] init];
+  pigeonResult.tier = [GetNullableObjectAtIndex(list, 0) integerValue];
+  return pigeonResult;
+}
++ (nullable QualityTierResponse *)nullableFromList:(NSArray *)list {
+  return (list) ? [QualityTierResponse fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.tier),
+  ];
+}
+@end
+
 @implementation FaceStateResponse
 + (instancetype)makeWithState:(FaceState)state {
   FaceStateResponse* pigeonResult = [[FaceStateResponse alloc] init];
@@ -450,6 +626,117 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 }
 @end
 
+@implementation StateSnapshot
++ (instancetype)makeWithFaceState:(FaceState)faceState
+    normalizedFaceBbox:(nullable NormalizedFaceBbox *)normalizedFaceBbox
+    measurementState:(MeasurementState)measurementState
+    measurementProgressPercentage:(NSNumber *)measurementProgressPercentage
+    heartRate4s:(nullable NSNumber *)heartRate4s
+    heartRate10s:(nullable NSNumber *)heartRate10s
+    signalQuality:(NSNumber *)signalQuality
+    totalBadSignalSeconds:(NSNumber *)totalBadSignalSeconds {
+  StateSnapshot* pigeonResult = [[StateSnapshot alloc] init];
+  pigeonResult.faceState = faceState;
+  pigeonResult.normalizedFaceBbox = normalizedFaceBbox;
+  pigeonResult.measurementState = measurementState;
+  pigeonResult.measurementProgressPercentage = measurementProgressPercentage;
+  pigeonResult.heartRate4s = heartRate4s;
+  pigeonResult.heartRate10s = heartRate10s;
+  pigeonResult.signalQuality = signalQuality;
+  pigeonResult.totalBadSignalSeconds = totalBadSignalSeconds;
+  return pigeonResult;
+}
++ (StateSnapshot *)fromList:(NSArray *)list {
+  StateSnapshot *pigeonResult = [[StateSnapshot alloc] init];
+  pigeonResult.faceState = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.normalizedFaceBbox = [NormalizedFaceBbox nullableFromList:(GetNullableObjectAtIndex(list, 1))];
+  pigeonResult.measurementState = [GetNullableObjectAtIndex(list, 2) integerValue];
+  pigeonResult.measurementProgressPercentage = GetNullableObjectAtIndex(list, 3);
+  NSAssert(pigeonResult.measurementProgressPercentage != nil, @"");
+  pigeonResult.heartRate4s = GetNullableObjectAtIndex(list, 4);
+  pigeonResult.heartRate10s = GetNullableObjectAtIndex(list, 5);
+  pigeonResult.signalQuality = GetNullableObjectAtIndex(list, 6);
+  NSAssert(pigeonResult.signalQuality != nil, @"");
+  pigeonResult.totalBadSignalSeconds = GetNullableObjectAtIndex(list, 7);
+  NSAssert(pigeonResult.totalBadSignalSeconds != nil, @"");
+  return pigeonResult;
+}
++ (nullable StateSnapshot *)nullableFromList:(NSArray *)list {
+  return (list) ? [StateSnapshot fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.faceState),
+    (self.normalizedFaceBbox ? [self.normalizedFaceBbox toList] : [NSNull null]),
+    @(self.measurementState),
+    (self.measurementProgressPercentage ?: [NSNull null]),
+    (self.heartRate4s ?: [NSNull null]),
+    (self.heartRate10s ?: [NSNull null]),
+    (self.signalQuality ?: [NSNull null]),
+    (self.totalBadSignalSeconds ?: [NSNull null]),
+  ];
+}
+@end
+
+@implementation HeartRateHistory
++ (instancetype)makeWithTimestampsSec:(FlutterStandardTypedData *)timestampsSec
+    heartRatesBpm:(FlutterStandardTypedData *)heartRatesBpm {
+  HeartRateHistory* pigeonResult = [[HeartRateHistory alloc] init];
+  pigeonResult.timestampsSec = timestampsSec;
+  pigeonResult.heartRatesBpm = heartRatesBpm;
+  return pigeonResult;
+}
++ (HeartRateHistory *)fromList:(NSArray *)list {
+  HeartRateHistory *pigeonResult = [[HeartRateHistory alloc] init];
+  pigeonResult.timestampsSec = GetNullableObjectAtIndex(list, 0);
+  NSAssert(pigeonResult.timestampsSec != nil, @"");
+  pigeonResult.heartRatesBpm = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.heartRatesBpm != nil, @"");
+  return pigeonResult;
+}
++ (nullable HeartRateHistory *)nullableFromList:(NSArray *)list {
+  return (list) ? [HeartRateHistory fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.timestampsSec ?: [NSNull null]),
+    (self.heartRatesBpm ?: [NSNull null]),
+  ];
+}
+@end
+
+@implementation Heartbeats
++ (instancetype)makeWithStartLocationsSec:(FlutterStandardTypedData *)startLocationsSec
+    endLocationsSec:(FlutterStandardTypedData *)endLocationsSec
+    durationsMs:(FlutterStandardTypedData *)durationsMs {
+  Heartbeats* pigeonResult = [[Heartbeats alloc] init];
+  pigeonResult.startLocationsSec = startLocationsSec;
+  pigeonResult.endLocationsSec = endLocationsSec;
+  pigeonResult.durationsMs = durationsMs;
+  return pigeonResult;
+}
++ (Heartbeats *)fromList:(NSArray *)list {
+  Heartbeats *pigeonResult = [[Heartbeats alloc] init];
+  pigeonResult.startLocationsSec = GetNullableObjectAtIndex(list, 0);
+  NSAssert(pigeonResult.startLocationsSec != nil, @"");
+  pigeonResult.endLocationsSec = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.endLocationsSec != nil, @"");
+  pigeonResult.durationsMs = GetNullableObjectAtIndex(list, 2);
+  NSAssert(pigeonResult.durationsMs != nil, @"");
+  return pigeonResult;
+}
++ (nullable Heartbeats *)nullableFromList:(NSArray *)list {
+  return (list) ? [Heartbeats fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.startLocationsSec ?: [NSNull null]),
+    (self.endLocationsSec ?: [NSNull null]),
+    (self.durationsMs ?: [NSNull null]),
+  ];
+}
+@end
+
 @implementation MeasurementResults
 + (instancetype)makeWithHeart_rate_bpm:(NSNumber *)heart_rate_bpm
     hrv_sdnn_ms:(nullable NSNumber *)hrv_sdnn_ms
@@ -458,7 +745,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     breathing_rate_bpm:(nullable NSNumber *)breathing_rate_bpm
     systolic_blood_pressure_mmhg:(nullable NSNumber *)systolic_blood_pressure_mmhg
     diastolic_blood_pressure_mmhg:(nullable NSNumber *)diastolic_blood_pressure_mmhg
-    heartbeats:(NSArray<Heartbeat *> *)heartbeats
+    heartbeats:(Heartbeats *)heartbeats
     average_signal_quality:(NSNumber *)average_signal_quality {
   MeasurementResults* pigeonResult = [[MeasurementResults alloc] init];
   pigeonResult.heart_rate_bpm = heart_rate_bpm;
@@ -482,7 +769,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   pigeonResult.breathing_rate_bpm = GetNullableObjectAtIndex(list, 4);
   pigeonResult.systolic_blood_pressure_mmhg = GetNullableObjectAtIndex(list, 5);
   pigeonResult.diastolic_blood_pressure_mmhg = GetNullableObjectAtIndex(list, 6);
-  pigeonResult.heartbeats = GetNullableObjectAtIndex(list, 7);
+  pigeonResult.heartbeats = [Heartbeats nullableFromList:(GetNullableObjectAtIndex(list, 7))];
   NSAssert(pigeonResult.heartbeats != nil, @"");
   pigeonResult.average_signal_quality = GetNullableObjectAtIndex(list, 8);
   NSAssert(pigeonResult.average_signal_quality != nil, @"");
@@ -500,7 +787,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     (self.breathing_rate_bpm ?: [NSNull null]),
     (self.systolic_blood_pressure_mmhg ?: [NSNull null]),
     (self.diastolic_blood_pressure_mmhg ?: [NSNull null]),
-    (self.heartbeats ?: [NSNull null]),
+    (self.heartbeats ? [self.heartbeats toList] : [NSNull null]),
     (self.average_signal_quality ?: [NSNull null]),
   ];
 }
@@ -519,7 +806,9 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     showFaceMask:(nullable NSNumber *)showFaceMask
     showBloodFlow:(nullable NSNumber *)showBloodFlow
     proVersionLock:(nullable NSNumber *)proVersionLock
-    hideShenaiLogo:(nullable NSNumber *)hideShenaiLogo {
+    hideShenaiLogo:(nullable NSNumber *)hideShenaiLogo
+    headless:(nullable NSNumber *)headless
+    qualityFloor:(nullable QualityTierBox *)qualityFloor {
   InitializationSettings* pigeonResult = [[InitializationSettings alloc] init];
   pigeonResult.precisionMode = precisionMode;
   pigeonResult.operatingMode = operatingMode;
@@ -534,6 +823,8 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   pigeonResult.showBloodFlow = showBloodFlow;
   pigeonResult.proVersionLock = proVersionLock;
   pigeonResult.hideShenaiLogo = hideShenaiLogo;
+  pigeonResult.headless = headless;
+  pigeonResult.qualityFloor = qualityFloor;
   return pigeonResult;
 }
 + (InitializationSettings *)fromList:(NSArray *)list {
@@ -561,6 +852,10 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   pigeonResult.showBloodFlow = GetNullableObjectAtIndex(list, 10);
   pigeonResult.proVersionLock = GetNullableObjectAtIndex(list, 11);
   pigeonResult.hideShenaiLogo = GetNullableObjectAtIndex(list, 12);
+  pigeonResult.headless = GetNullableObjectAtIndex(list, 13);
+  NSNumber *qualityFloorAsNumber = GetNullableObjectAtIndex(list, 14);
+  QualityTierBox *qualityFloor = qualityFloorAsNumber == nil ? nil : [[QualityTierBox alloc] initWithValue: [qualityFloorAsNumber integerValue]];
+  pigeonResult.qualityFloor = qualityFloor;
   return pigeonResult;
 }
 + (nullable InitializationSettings *)nullableFromList:(NSArray *)list {
@@ -581,6 +876,8 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     (self.showBloodFlow ?: [NSNull null]),
     (self.proVersionLock ?: [NSNull null]),
     (self.hideShenaiLogo ?: [NSNull null]),
+    (self.headless ?: [NSNull null]),
+    (self.qualityFloor == nil ? [NSNull null] : [NSNumber numberWithInteger:self.qualityFloor.value]),
   ];
 }
 @end
@@ -903,6 +1200,322 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 }
 @end
 
+@implementation HealthRisksBundle
++ (instancetype)makeWithActual:(HealthRisks *)actual
+    minimal:(HealthRisks *)minimal
+    maximal:(HealthRisks *)maximal {
+  HealthRisksBundle* pigeonResult = [[HealthRisksBundle alloc] init];
+  pigeonResult.actual = actual;
+  pigeonResult.minimal = minimal;
+  pigeonResult.maximal = maximal;
+  return pigeonResult;
+}
++ (HealthRisksBundle *)fromList:(NSArray *)list {
+  HealthRisksBundle *pigeonResult = [[HealthRisksBundle alloc] init];
+  pigeonResult.actual = [HealthRisks nullableFromList:(GetNullableObjectAtIndex(list, 0))];
+  NSAssert(pigeonResult.actual != nil, @"");
+  pigeonResult.minimal = [HealthRisks nullableFromList:(GetNullableObjectAtIndex(list, 1))];
+  NSAssert(pigeonResult.minimal != nil, @"");
+  pigeonResult.maximal = [HealthRisks nullableFromList:(GetNullableObjectAtIndex(list, 2))];
+  NSAssert(pigeonResult.maximal != nil, @"");
+  return pigeonResult;
+}
++ (nullable HealthRisksBundle *)nullableFromList:(NSArray *)list {
+  return (list) ? [HealthRisksBundle fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.actual ? [self.actual toList] : [NSNull null]),
+    (self.minimal ? [self.minimal toList] : [NSNull null]),
+    (self.maximal ? [self.maximal toList] : [NSNull null]),
+  ];
+}
+@end
+
+@implementation RiskFactorSensitivity
++ (instancetype)makeWithFactor:(ModifiableRiskFactor)factor
+    step:(NSNumber *)step
+    delta:(HealthRisks *)delta {
+  RiskFactorSensitivity* pigeonResult = [[RiskFactorSensitivity alloc] init];
+  pigeonResult.factor = factor;
+  pigeonResult.step = step;
+  pigeonResult.delta = delta;
+  return pigeonResult;
+}
++ (RiskFactorSensitivity *)fromList:(NSArray *)list {
+  RiskFactorSensitivity *pigeonResult = [[RiskFactorSensitivity alloc] init];
+  pigeonResult.factor = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.step = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.step != nil, @"");
+  pigeonResult.delta = [HealthRisks nullableFromList:(GetNullableObjectAtIndex(list, 2))];
+  NSAssert(pigeonResult.delta != nil, @"");
+  return pigeonResult;
+}
++ (nullable RiskFactorSensitivity *)nullableFromList:(NSArray *)list {
+  return (list) ? [RiskFactorSensitivity fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.factor),
+    (self.step ?: [NSNull null]),
+    (self.delta ? [self.delta toList] : [NSNull null]),
+  ];
+}
+@end
+
+@implementation HealthRisksSensitivity
++ (instancetype)makeWithRisks:(HealthRisks *)risks
+    sensitivities:(NSArray<RiskFactorSensitivity *> *)sensitivities {
+  HealthRisksSensitivity* pigeonResult = [[HealthRisksSensitivity alloc] init];
+  pigeonResult.risks = risks;
+  pigeonResult.sensitivities = sensitivities;
+  return pigeonResult;
+}
++ (HealthRisksSensitivity *)fromList:(NSArray *)list {
+  HealthRisksSensitivity *pigeonResult = [[HealthRisksSensitivity alloc] init];
+  pigeonResult.risks = [HealthRisks nullableFromList:(GetNullableObjectAtIndex(list, 0))];
+  NSAssert(pigeonResult.risks != nil, @"");
+  pigeonResult.sensitivities = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.sensitivities != nil, @"");
+  return pigeonResult;
+}
++ (nullable HealthRisksSensitivity *)nullableFromList:(NSArray *)list {
+  return (list) ? [HealthRisksSensitivity fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.risks ? [self.risks toList] : [NSNull null]),
+    (self.sensitivities ?: [NSNull null]),
+  ];
+}
+@end
+
+@implementation HealthRisksGridAxis
++ (instancetype)makeWithFactor:(HealthRisksGridFactor)factor
+    min:(NSNumber *)min
+    max:(NSNumber *)max
+    steps:(NSNumber *)steps {
+  HealthRisksGridAxis* pigeonResult = [[HealthRisksGridAxis alloc] init];
+  pigeonResult.factor = factor;
+  pigeonResult.min = min;
+  pigeonResult.max = max;
+  pigeonResult.steps = steps;
+  return pigeonResult;
+}
++ (HealthRisksGridAxis *)fromList:(NSArray *)list {
+  HealthRisksGridAxis *pigeonResult = [[HealthRisksGridAxis alloc] init];
+  pigeonResult.factor = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.min = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.min != nil, @"");
+  pigeonResult.max = GetNullableObjectAtIndex(list, 2);
+  NSAssert(pigeonResult.max != nil, @"");
+  pigeonResult.steps = GetNullableObjectAtIndex(list, 3);
+  NSAssert(pigeonResult.steps != nil, @"");
+  return pigeonResult;
+}
++ (nullable HealthRisksGridAxis *)nullableFromList:(NSArray *)list {
+  return (list) ? [HealthRisksGridAxis fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.factor),
+    (self.min ?: [NSNull null]),
+    (self.max ?: [NSNull null]),
+    (self.steps ?: [NSNull null]),
+  ];
+}
+@end
+
+@implementation RisksFactorsUncertainty
++ (instancetype)makeWithSbp:(nullable NSNumber *)sbp
+    cholesterol:(nullable NSNumber *)cholesterol
+    cholesterolHdl:(nullable NSNumber *)cholesterolHdl
+    bodyHeight:(nullable NSNumber *)bodyHeight
+    bodyWeight:(nullable NSNumber *)bodyWeight {
+  RisksFactorsUncertainty* pigeonResult = [[RisksFactorsUncertainty alloc] init];
+  pigeonResult.sbp = sbp;
+  pigeonResult.cholesterol = cholesterol;
+  pigeonResult.cholesterolHdl = cholesterolHdl;
+  pigeonResult.bodyHeight = bodyHeight;
+  pigeonResult.bodyWeight = bodyWeight;
+  return pigeonResult;
+}
++ (RisksFactorsUncertainty *)fromList:(NSArray *)list {
+  RisksFactorsUncertainty *pigeonResult = [[RisksFactorsUncertainty alloc] init];
+  pigeonResult.sbp = GetNullableObjectAtIndex(list, 0);
+  pigeonResult.cholesterol = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.cholesterolHdl = GetNullableObjectAtIndex(list, 2);
+  pigeonResult.bodyHeight = GetNullableObjectAtIndex(list, 3);
+  pigeonResult.bodyWeight = GetNullableObjectAtIndex(list, 4);
+  return pigeonResult;
+}
++ (nullable RisksFactorsUncertainty *)nullableFromList:(NSArray *)list {
+  return (list) ? [RisksFactorsUncertainty fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.sbp ?: [NSNull null]),
+    (self.cholesterol ?: [NSNull null]),
+    (self.cholesterolHdl ?: [NSNull null]),
+    (self.bodyHeight ?: [NSNull null]),
+    (self.bodyWeight ?: [NSNull null]),
+  ];
+}
+@end
+
+@implementation HealthRisksInterval
++ (instancetype)makeWithLower:(HealthRisks *)lower
+    median:(HealthRisks *)median
+    upper:(HealthRisks *)upper {
+  HealthRisksInterval* pigeonResult = [[HealthRisksInterval alloc] init];
+  pigeonResult.lower = lower;
+  pigeonResult.median = median;
+  pigeonResult.upper = upper;
+  return pigeonResult;
+}
++ (HealthRisksInterval *)fromList:(NSArray *)list {
+  HealthRisksInterval *pigeonResult = [[HealthRisksInterval alloc] init];
+  pigeonResult.lower = [HealthRisks nullableFromList:(GetNullableObjectAtIndex(list, 0))];
+  NSAssert(pigeonResult.lower != nil, @"");
+  pigeonResult.median = [HealthRisks nullableFromList:(GetNullableObjectAtIndex(list, 1))];
+  NSAssert(pigeonResult.median != nil, @"");
+  pigeonResult.upper = [HealthRisks nullableFromList:(GetNullableObjectAtIndex(list, 2))];
+  NSAssert(pigeonResult.upper != nil, @"");
+  return pigeonResult;
+}
++ (nullable HealthRisksInterval *)nullableFromList:(NSArray *)list {
+  return (list) ? [HealthRisksInterval fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.lower ? [self.lower toList] : [NSNull null]),
+    (self.median ? [self.median toList] : [NSNull null]),
+    (self.upper ? [self.upper toList] : [NSNull null]),
+  ];
+}
+@end
+
+@implementation HealthRisksCacheStats
++ (instancetype)makeWithHits:(NSNumber *)hits
+    misses:(NSNumber *)misses {
+  HealthRisksCacheStats* pigeonResult = [[HealthRisksCacheStats alloc] init];
+  pigeonResult.hits = hits;
+  pigeonResult.misses = misses;
+  return pigeonResult;
+}
++ (HealthRisksCacheStats *)fromList:(NSArray *)list {
+  HealthRisksCacheStats *pigeonResult = [[HealthRisksCacheStats alloc] init];
+  pigeonResult.hits = GetNullableObjectAtIndex(list, 0);
+  NSAssert(pigeonResult.hits != nil, @"");
+  pigeonResult.misses = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.misses != nil, @"");
+  return pigeonResult;
+}
++ (nullable HealthRisksCacheStats *)nullableFromList:(NSArray *)list {
+  return (list) ? [HealthRisksCacheStats fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.hits ?: [NSNull null]),
+    (self.misses ?: [NSNull null]),
+  ];
+}
+@end
+
+@implementation StagePerformance
++ (instancetype)makeWithCount:(NSNumber *)count
+    p50Ms:(NSNumber *)p50Ms
+    p95Ms:(NSNumber *)p95Ms
+    maxMs:(NSNumber *)maxMs
+    maxInFlight:(NSNumber *)maxInFlight {
+  StagePerformance* pigeonResult = [[StagePerformance alloc] init];
+  pigeonResult.count = count;
+  pigeonResult.p50Ms = p50Ms;
+  pigeonResult.p95Ms = p95Ms;
+  pigeonResult.maxMs = maxMs;
+  pigeonResult.maxInFlight = maxInFlight;
+  return pigeonResult;
+}
++ (StagePerformance *)fromList:(NSArray *)list {
+  StagePerformance *pigeonResult = [[StagePerformance alloc] init];
+  pigeonResult.count = GetNullableObjectAtIndex(list, 0);
+  NSAssert(pigeonResult.count != nil, @"");
+  pigeonResult.p50Ms = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.p50Ms != nil, @"");
+  pigeonResult.p95Ms = GetNullableObjectAtIndex(list, 2);
+  NSAssert(pigeonResult.p95Ms != nil, @"");
+  pigeonResult.maxMs = GetNullableObjectAtIndex(list, 3);
+  NSAssert(pigeonResult.maxMs != nil, @"");
+  pigeonResult.maxInFlight = GetNullableObjectAtIndex(list, 4);
+  NSAssert(pigeonResult.maxInFlight != nil, @"");
+  return pigeonResult;
+}
++ (nullable StagePerformance *)nullableFromList:(NSArray *)list {
+  return (list) ? [StagePerformance fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.count ?: [NSNull null]),
+    (self.p50Ms ?: [NSNull null]),
+    (self.p95Ms ?: [NSNull null]),
+    (self.maxMs ?: [NSNull null]),
+    (self.maxInFlight ?: [NSNull null]),
+  ];
+}
+@end
+
+@implementation PerformanceStats
++ (instancetype)makeWithWindowSec:(NSNumber *)windowSec
+    cpuTimeMs:(NSNumber *)cpuTimeMs
+    initialize:(StagePerformance *)initialize
+    stateSnapshot:(StagePerformance *)stateSnapshot
+    imageExport:(StagePerformance *)imageExport
+    signalExport:(StagePerformance *)signalExport
+    healthRisks:(StagePerformance *)healthRisks {
+  PerformanceStats* pigeonResult = [[PerformanceStats alloc] init];
+  pigeonResult.windowSec = windowSec;
+  pigeonResult.cpuTimeMs = cpuTimeMs;
+  pigeonResult.initialize = initialize;
+  pigeonResult.stateSnapshot = stateSnapshot;
+  pigeonResult.imageExport = imageExport;
+  pigeonResult.signalExport = signalExport;
+  pigeonResult.healthRisks = healthRisks;
+  return pigeonResult;
+}
++ (PerformanceStats *)fromList:(NSArray *)list {
+  PerformanceStats *pigeonResult = [[PerformanceStats alloc] init];
+  pigeonResult.windowSec = GetNullableObjectAtIndex(list, 0);
+  NSAssert(pigeonResult.windowSec != nil, @"");
+  pigeonResult.cpuTimeMs = GetNullableObjectAtIndex(list, 1);
+  NSAssert(pigeonResult.cpuTimeMs != nil, @"");
+  pigeonResult.initialize = [StagePerformance nullableFromList:(GetNullableObjectAtIndex(list, 2))];
+  NSAssert(pigeonResult.initialize != nil, @"");
+  pigeonResult.stateSnapshot = [StagePerformance nullableFromList:(GetNullableObjectAtIndex(list, 3))];
+  NSAssert(pigeonResult.stateSnapshot != nil, @"");
+  pigeonResult.imageExport = [StagePerformance nullableFromList:(GetNullableObjectAtIndex(list, 4))];
+  NSAssert(pigeonResult.imageExport != nil, @"");
+  pigeonResult.signalExport = [StagePerformance nullableFromList:(GetNullableObjectAtIndex(list, 5))];
+  NSAssert(pigeonResult.signalExport != nil, @"");
+  pigeonResult.healthRisks = [StagePerformance nullableFromList:(GetNullableObjectAtIndex(list, 6))];
+  NSAssert(pigeonResult.healthRisks != nil, @"");
+  return pigeonResult;
+}
++ (nullable PerformanceStats *)nullableFromList:(NSArray *)list {
+  return (list) ? [PerformanceStats fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    (self.windowSec ?: [NSNull null]),
+    (self.cpuTimeMs ?: [NSNull null]),
+    (self.initialize ? [self.initialize toList] : [NSNull null]),
+    (self.stateSnapshot ? [self.stateSnapshot toList] : [NSNull null]),
+    (self.imageExport ? [self.imageExport toList] : [NSNull null]),
+    (self.signalExport ? [self.signalExport toList] : [NSNull null]),
+    (self.healthRisks ? [self.healthRisks toList] : [NSNull null]),
+  ];
+}
+@end
+
 @interface ShenaiSdkNativeApiCodecReader : FlutterStandardReader
 @end
 @implementation ShenaiSdkNativeApiCodecReader
@@ -923,27 +1536,55 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     case 134: 
       return [HealthRisks fromList:[self readValue]];
     case 135: 
-      return [Heartbeat fromList:[self readValue]];
+      return [HealthRisksBundle fromList:[self readValue]];
     case 136: 
-      return [InitializationSettings fromList:[self readValue]];
+      return [HealthRisksCacheStats fromList:[self readValue]];
     case 137: 
-      return [InitializeResponse fromList:[self readValue]];
+      return [HealthRisksGridAxis fromList:[self readValue]];
     case 138: 
-      return [MeasurementPresetResponse fromList:[self readValue]];
+      return [HealthRisksInterval fromList:[self readValue]];
     case 139: 
-      return [MeasurementResults fromList:[self readValue]];
+      return [HealthRisksSensitivity fromList:[self readValue]];
     case 140: 
-      return [MeasurementStateResponse fromList:[self readValue]];
+      return [HeartRateHistory fromList:[self readValue]];
     case 141: 
-      return [NormalizedFaceBbox fromList:[self readValue]];
+      return [Heartbeat fromList:[self readValue]];
     case 142: 
-      return [OperatingModeResponse fromList:[self readValue]];
+      return [Heartbeats fromList:[self readValue]];
     case 143: 
-      return [PrecisionModeResponse fromList:[self readValue]];
+      return [InitializationSettings fromList:[self readValue]];
     case 144: 
-      return [RisksFactors fromList:[self readValue]];
+      return [InitializationTimings fromList:[self readValue]];
     case 145: 
+      return [InitializeResponse fromList:[self readValue]];
+    case 146: 
+      return [MeasurementPresetResponse fromList:[self readValue]];
+    case 147: 
+      return [MeasurementResults fromList:[self readValue]];
+    case 148: 
+      return [MeasurementStateResponse fromList:[self readValue]];
+    case 149: 
+      return [NormalizedFaceBbox fromList:[self readValue]];
+    case 150: 
+      return [OperatingModeResponse fromList:[self readValue]];
+    case 151: 
+      return [PerformanceStats fromList:[self readValue]];
+    case 152: 
+      return [PrecisionModeResponse fromList:[self readValue]];
+    case 153: 
+      return [QualityTierResponse fromList:[self readValue]];
+    case 154: 
+      return [RiskFactorSensitivity fromList:[self readValue]];
+    case 155: 
+      return [RisksFactors fromList:[self readValue]];
+    case 156: 
       return [RisksFactorsScores fromList:[self readValue]];
+    case 157: 
+      return [RisksFactorsUncertainty fromList:[self readValue]];
+    case 158: 
+      return [StagePerformance fromList:[self readValue]];
+    case 159: 
+      return [StateSnapshot fromList:[self readValue]];
     default:
       return [super readValueOfType:type];
   }
@@ -975,38 +1616,80 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   } else if ([value isKindOfClass:[HealthRisks class]]) {
     [self writeByte:134];
     [self writeValue:[value toList]];
-  } else if ([value isKindOfClass:[Heartbeat class]]) {
+  } else if ([value isKindOfClass:[HealthRisksBundle class]]) {
     [self writeByte:135];
     [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[HealthRisksCacheStats class]]) {
+    [self writeByte:136];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[HealthRisksGridAxis class]]) {
+    [self writeByte:137];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[HealthRisksInterval class]]) {
+    [self writeByte:138];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[HealthRisksSensitivity class]]) {
+    [self writeByte:139];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[HeartRateHistory class]]) {
+    [self writeByte:140];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[Heartbeat class]]) {
+    [self writeByte:141];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[Heartbeats class]]) {
+    [self writeByte:142];
+    [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[InitializationSettings class]]) {
-    [self writeByte:136];
+    [self writeByte:143];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[InitializationTimings class]]) {
+    [self writeByte:144];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[InitializeResponse class]]) {
-    [self writeByte:137];
+    [self writeByte:145];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[MeasurementPresetResponse class]]) {
-    [self writeByte:138];
+    [self writeByte:146];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[MeasurementResults class]]) {
-    [self writeByte:139];
+    [self writeByte:147];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[MeasurementStateResponse class]]) {
-    [self writeByte:140];
+    [self writeByte:148];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[NormalizedFaceBbox class]]) {
-    [self writeByte:141];
+    [self writeByte:149];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[OperatingModeResponse class]]) {
-    [self writeByte:142];
+    [self writeByte:150];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[PerformanceStats class]]) {
+    [self writeByte:151];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[PrecisionModeResponse class]]) {
-    [self writeByte:143];
+    [self writeByte:152];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[QualityTierResponse class]]) {
+    [self writeByte:153];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[RiskFactorSensitivity class]]) {
+    [self writeByte:154];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[RisksFactors class]]) {
-    [self writeByte:144];
+    [self writeByte:155];
     [self writeValue:[value toList]];
   } else if ([value isKindOfClass:[RisksFactorsScores class]]) {
-    [self writeByte:145];
+    [self writeByte:156];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[RisksFactorsUncertainty class]]) {
+    [self writeByte:157];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[StagePerformance class]]) {
+    [self writeByte:158];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[StateSnapshot class]]) {
+    [self writeByte:159];
     [self writeValue:[value toList]];
   } else {
     [super writeValue:value];
@@ -1043,15 +1726,32 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
         binaryMessenger:binaryMessenger
         codec:ShenaiSdkNativeApiGetCodec()];
     if (api) {
-      NSCAssert([api respondsToSelector:@selector(initializeApiKey:userId:settings:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(initializeApiKey:userId:settings:error:)", api);
+      NSCAssert([api respondsToSelector:@selector(initializeApiKey:userId:settings:completion:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(initializeApiKey:userId:settings:completion:)", api);
       [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
         NSArray *args = message;
         NSString *arg_apiKey = GetNullableObjectAtIndex(args, 0);
         NSString *arg_userId = GetNullableObjectAtIndex(args, 1);
         InitializationSettings *arg_settings = GetNullableObjectAtIndex(args, 2);
-        FlutterError *error;
-        InitializeResponse *output = [api initializeApiKey:arg_apiKey userId:arg_userId settings:arg_settings error:&error];
-        callback(wrapResult(output, error));
+        [api initializeApiKey:arg_apiKey userId:arg_userId settings:arg_settings completion:^(InitializeResponse *_Nullable output, FlutterError *_Nullable error) {
+          callback(wrapResult(output, error));
+        }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.cancelInitialization"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(cancelInitializationWithCompletion:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(cancelInitializationWithCompletion:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        [api cancelInitializationWithCompletion:^(FlutterError *_Nullable error) {
+          callback(wrapResult(nil, error));
+        }];
       }];
     } else {
       [channel setMessageHandler:nil];
@@ -1273,6 +1973,57 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.suspend"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(suspendWithCompletion:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(suspendWithCompletion:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        [api suspendWithCompletion:^(FlutterError *_Nullable error) {
+          callback(wrapResult(nil, error));
+        }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.resume"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(resumeWithCompletion:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(resumeWithCompletion:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        [api resumeWithCompletion:^(FlutterError *_Nullable error) {
+          callback(wrapResult(nil, error));
+        }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.isSuspended"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(isSuspendedWithError:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(isSuspendedWithError:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        FlutterError *error;
+        NSNumber *output = [api isSuspendedWithError:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
@@ -1489,6 +2240,23 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getQualityTier"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(getQualityTierWithError:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getQualityTierWithError:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        FlutterError *error;
+        QualityTierResponse *output = [api getQualityTierWithError:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
@@ -1627,6 +2395,23 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getStateSnapshot"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(getStateSnapshotWithError:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getStateSnapshotWithError:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        FlutterError *error;
+        StateSnapshot *output = [api getStateSnapshotWithError:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
@@ -1734,11 +2519,13 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
     }
   }
   {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
         initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getSignalQualityMapPng"
         binaryMessenger:binaryMessenger
-        codec:ShenaiSdkNativeApiGetCodec()];
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
     if (api) {
       NSCAssert([api respondsToSelector:@selector(getSignalQualityMapPngWithError:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getSignalQualityMapPngWithError:)", api);
       [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
@@ -1751,11 +2538,13 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
     }
   }
   {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
         initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFaceTexturePng"
         binaryMessenger:binaryMessenger
-        codec:ShenaiSdkNativeApiGetCodec()];
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
     if (api) {
       NSCAssert([api respondsToSelector:@selector(getFaceTexturePngWithError:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getFaceTexturePngWithError:)", api);
       [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
@@ -1768,11 +2557,13 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
     }
   }
   {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
         initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFullPpgSignal"
         binaryMessenger:binaryMessenger
-        codec:ShenaiSdkNativeApiGetCodec()];
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
     if (api) {
       NSCAssert([api respondsToSelector:@selector(getFullPpgSignalWithError:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getFullPpgSignalWithError:)", api);
       [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
@@ -1784,6 +2575,69 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
       [channel setMessageHandler:nil];
     }
   }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRateHistory10s"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(getHeartRateHistory10sSinceSec:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getHeartRateHistory10sSinceSec:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSNumber *arg_sinceSec = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        HeartRateHistory *output = [api getHeartRateHistory10sSinceSec:arg_sinceSec error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRateHistory4s"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(getHeartRateHistory4sSinceSec:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getHeartRateHistory4sSinceSec:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSNumber *arg_sinceSec = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        HeartRateHistory *output = [api getHeartRateHistory4sSinceSec:arg_sinceSec error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getRealtimeHeartbeats"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(getRealtimeHeartbeatsSinceSec:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getRealtimeHeartbeatsSinceSec:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSNumber *arg_sinceSec = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        Heartbeats *output = [api getRealtimeHeartbeatsSinceSec:arg_sinceSec error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
@@ -1821,11 +2675,13 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
     }
   }
   {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
         initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisks"
         binaryMessenger:binaryMessenger
-        codec:ShenaiSdkNativeApiGetCodec()];
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
     if (api) {
       NSCAssert([api respondsToSelector:@selector(computeHealthRisksHealthRisksFactors:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(computeHealthRisksHealthRisksFactors:error:)", api);
       [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
@@ -1840,11 +2696,13 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
     }
   }
   {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
         initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMinimalHealthRisks"
         binaryMessenger:binaryMessenger
-        codec:ShenaiSdkNativeApiGetCodec()];
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
     if (api) {
       NSCAssert([api respondsToSelector:@selector(getMinimalHealthRisksHealthRisksFactors:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getMinimalHealthRisksHealthRisksFactors:error:)", api);
       [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
@@ -1859,11 +2717,13 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
     }
   }
   {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
     FlutterBasicMessageChannel *channel =
       [[FlutterBasicMessageChannel alloc]
         initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getMaximalHealthRisks"
         binaryMessenger:binaryMessenger
-        codec:ShenaiSdkNativeApiGetCodec()];
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
     if (api) {
       NSCAssert([api respondsToSelector:@selector(getMaximalHealthRisksHealthRisksFactors:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getMaximalHealthRisksHealthRisksFactors:error:)", api);
       [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
@@ -1877,4 +2737,153 @@ void ShenaiSdkNativeApiSetup(id<FlutterBinaryMessenger> binaryMessenger, NSObjec
       [channel setMessageHandler:nil];
     }
   }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksBundle"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(computeHealthRisksBundleHealthRisksFactors:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(computeHealthRisksBundleHealthRisksFactors:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        RisksFactors *arg_healthRisksFactors = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        HealthRisksBundle *output = [api computeHealthRisksBundleHealthRisksFactors:arg_healthRisksFactors error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksSensitivity"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(computeHealthRisksSensitivityHealthRisksFactors:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(computeHealthRisksSensitivityHealthRisksFactors:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        RisksFactors *arg_healthRisksFactors = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        HealthRisksSensitivity *output = [api computeHealthRisksSensitivityHealthRisksFactors:arg_healthRisksFactors error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksGrid"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(computeHealthRisksGridBaseFactors:xAxis:yAxis:metric:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(computeHealthRisksGridBaseFactors:xAxis:yAxis:metric:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        RisksFactors *arg_baseFactors = GetNullableObjectAtIndex(args, 0);
+        HealthRisksGridAxis *arg_xAxis = GetNullableObjectAtIndex(args, 1);
+        HealthRisksGridAxis *arg_yAxis = GetNullableObjectAtIndex(args, 2);
+        HealthRisksMetric arg_metric = [GetNullableObjectAtIndex(args, 3) integerValue];
+        FlutterError *error;
+        FlutterStandardTypedData *output = [api computeHealthRisksGridBaseFactors:arg_baseFactors xAxis:arg_xAxis yAxis:arg_yAxis metric:arg_metric error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksUncertainty"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(computeHealthRisksUncertaintyHealthRisksFactors:uncertainty:samples:seed:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(computeHealthRisksUncertaintyHealthRisksFactors:uncertainty:samples:seed:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        RisksFactors *arg_healthRisksFactors = GetNullableObjectAtIndex(args, 0);
+        RisksFactorsUncertainty *arg_uncertainty = GetNullableObjectAtIndex(args, 1);
+        NSNumber *arg_samples = GetNullableObjectAtIndex(args, 2);
+        NSNumber *arg_seed = GetNullableObjectAtIndex(args, 3);
+        FlutterError *error;
+        HealthRisksInterval *output = [api computeHealthRisksUncertaintyHealthRisksFactors:arg_healthRisksFactors uncertainty:arg_uncertainty samples:arg_samples seed:arg_seed error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setHealthRisksCacheCapacity"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setHealthRisksCacheCapacityCapacity:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(setHealthRisksCacheCapacityCapacity:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSNumber *arg_capacity = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api setHealthRisksCacheCapacityCapacity:arg_capacity error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    NSObject<FlutterTaskQueue> *taskQueue = [binaryMessenger makeBackgroundTaskQueue];
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHealthRisksCacheStats"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()
+        taskQueue:taskQueue];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(getHealthRisksCacheStatsWithError:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getHealthRisksCacheStatsWithError:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        FlutterError *error;
+        HealthRisksCacheStats *output = [api getHealthRisksCacheStatsWithError:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel =
+      [[FlutterBasicMessageChannel alloc]
+        initWithName:@"dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getPerformanceStats"
+        binaryMessenger:binaryMessenger
+        codec:ShenaiSdkNativeApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(getPerformanceStatsReset:error:)], @"ShenaiSdkNativeApi api (%@) doesn't respond to @selector(getPerformanceStatsReset:error:)", api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSNumber *arg_reset = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        PerformanceStats *output = [api getPerformanceStatsReset:arg_reset error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
 }
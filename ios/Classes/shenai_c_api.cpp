@@ -0,0 +1,64 @@
+#include "shenai_c_api.h"
+
+#include <ShenaiSDK/shenai_api_cpp.h>
+
+namespace {
+
+ShenaiOptionalInt toOptionalInt(const std::optional<int>& value) {
+  return {.present = value.has_value(), .value = value.value_or(0)};
+}
+
+}  // namespace
+
+SHENAI_C_API int32_t shenai_is_initialized(void) {
+  return shen::IsInitialized();
+}
+
+SHENAI_C_API int32_t shenai_get_face_state(void) {
+  return static_cast<int32_t>(shen::GetFaceState());
+}
+
+SHENAI_C_API int32_t shenai_get_measurement_state(void) {
+  return static_cast<int32_t>(shen::GetMeasurementState());
+}
+
+SHENAI_C_API float shenai_get_measurement_progress_percentage(void) {
+  return shen::GetMeasurementProgressPercentage();
+}
+
+SHENAI_C_API ShenaiOptionalInt shenai_get_heart_rate_4s(void) {
+  return toOptionalInt(shen::GetHeartRate4s());
+}
+
+SHENAI_C_API ShenaiOptionalInt shenai_get_heart_rate_10s(void) {
+  return toOptionalInt(shen::GetHeartRate10s());
+}
+
+SHENAI_C_API float shenai_get_current_signal_quality_metric(void) {
+  return shen::GetCurrentSignalQualityMetric();
+}
+
+SHENAI_C_API float shenai_get_total_bad_signal_seconds(void) {
+  return shen::GetTotalBadSignalSeconds();
+}
+
+SHENAI_C_API ShenaiNormalizedFaceBbox shenai_get_normalized_face_bbox(void) {
+  const auto bbox = shen::GetNormalizedFaceBbox();
+  if (!bbox) {
+    return {};
+  }
+  return {.present = 1, .x = bbox->x, .y = bbox->y, .width = bbox->width, .height = bbox->height};
+}
+
+SHENAI_C_API ShenaiStateSnapshot shenai_get_state_snapshot(void) {
+  return {
+      .face_state = shenai_get_face_state(),
+      .measurement_state = shenai_get_measurement_state(),
+      .measurement_progress_percentage = shenai_get_measurement_progress_percentage(),
+      .signal_quality = shenai_get_current_signal_quality_metric(),
+      .total_bad_signal_seconds = shenai_get_total_bad_signal_seconds(),
+      .heart_rate_4s = shenai_get_heart_rate_4s(),
+      .heart_rate_10s = shenai_get_heart_rate_10s(),
+      .normalized_face_bbox = shenai_get_normalized_face_bbox(),
+  };
+}
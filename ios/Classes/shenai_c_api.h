@@ -0,0 +1,52 @@
+#pragma once
+
+// Plain C view of the read-only shen:: getters, called from Dart through dart:ffi (lib/shenai_ffi.dart).
+// Only fixed-size POD structs cross this boundary; keep the layouts in sync with the Dart Struct classes.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// used keeps the exports when nothing in the app references them, which is always the case for dart:ffi
+#define SHENAI_C_API __attribute__((used, visibility("default")))
+
+typedef struct {
+  int32_t present;  // 0 when the value is missing
+  int32_t value;
+} ShenaiOptionalInt;
+
+typedef struct {
+  int32_t present;  // 0 when no face is detected
+  float x;
+  float y;
+  float width;
+  float height;
+} ShenaiNormalizedFaceBbox;
+
+typedef struct {
+  int32_t face_state;         // shen::FaceState
+  int32_t measurement_state;  // shen::MeasurementState
+  float measurement_progress_percentage;
+  float signal_quality;
+  float total_bad_signal_seconds;
+  ShenaiOptionalInt heart_rate_4s;
+  ShenaiOptionalInt heart_rate_10s;
+  ShenaiNormalizedFaceBbox normalized_face_bbox;
+} ShenaiStateSnapshot;
+
+SHENAI_C_API int32_t shenai_is_initialized(void);
+SHENAI_C_API int32_t shenai_get_face_state(void);
+SHENAI_C_API int32_t shenai_get_measurement_state(void);
+SHENAI_C_API float shenai_get_measurement_progress_percentage(void);
+SHENAI_C_API ShenaiOptionalInt shenai_get_heart_rate_4s(void);
+SHENAI_C_API ShenaiOptionalInt shenai_get_heart_rate_10s(void);
+SHENAI_C_API float shenai_get_current_signal_quality_metric(void);
+SHENAI_C_API float shenai_get_total_bad_signal_seconds(void);
+SHENAI_C_API ShenaiNormalizedFaceBbox shenai_get_normalized_face_bbox(void);
+SHENAI_C_API ShenaiStateSnapshot shenai_get_state_snapshot(void);
+
+#ifdef __cplusplus
+}
+#endif
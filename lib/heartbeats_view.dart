@@ -0,0 +1,34 @@
+import 'dart:collection';
+
+import 'pigeon.dart';
+
+// Heartbeats arrive as parallel buffers; these views build Heartbeat objects only for the entries actually read.
+extension HeartbeatsView on Heartbeats {
+  int get length => startLocationsSec.length;
+
+  Heartbeat operator [](int index) => Heartbeat(
+        start_location_sec: startLocationsSec[index],
+        end_location_sec: endLocationsSec[index],
+        duration_ms: durationsMs[index],
+      );
+
+  List<Heartbeat> get asList => _HeartbeatsList(this);
+}
+
+class _HeartbeatsList extends ListBase<Heartbeat> {
+  _HeartbeatsList(this._heartbeats);
+
+  final Heartbeats _heartbeats;
+
+  @override
+  int get length => _heartbeats.length;
+
+  @override
+  set length(int newLength) => throw UnsupportedError('Cannot change the length of heartbeats');
+
+  @override
+  Heartbeat operator [](int index) => _heartbeats[index];
+
+  @override
+  void operator []=(int index, Heartbeat value) => throw UnsupportedError('Cannot modify heartbeats');
+}
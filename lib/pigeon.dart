@@ -13,6 +13,7 @@ enum InitializationResult {
   failInvalidApiKey,
   failConnectionError,
   failInternalError,
+  cancelled,
 }
 
 enum OperatingMode {
@@ -47,6 +48,12 @@ enum OnboardingMode {
   showAlways,
 }
 
+enum QualityTier {
+  full,
+  reducedOverlays,
+  minimalOverlays,
+}
+
 enum FaceState {
   ok,
   tooFar,
@@ -79,16 +86,86 @@ enum Race {
   other,
 }
 
+enum ModifiableRiskFactor {
+  sbp,
+  cholesterol,
+  cholesterolHdl,
+  smoking,
+  bmi,
+  diabetes,
+  hypertensionTreatment,
+}
+
+enum HealthRisksGridFactor {
+  age,
+  sbp,
+  cholesterol,
+  cholesterolHdl,
+  bodyWeight,
+  bodyHeight,
+}
+
+enum HealthRisksMetric {
+  coronaryDeathEventRisk,
+  fatalStrokeEventRisk,
+  totalCVMortalityRisk,
+  hardCVEventRisk,
+  overallRisk,
+  coronaryHeartDiseaseRisk,
+  strokeRisk,
+  heartFailureRisk,
+  peripheralVascularDiseaseRisk,
+  vascularAge,
+  ageScore,
+  sbpScore,
+  smokingScore,
+  diabetesScore,
+  bmiScore,
+  cholesterolScore,
+  cholesterolHdlScore,
+  totalScore,
+}
+
+class InitializationTimings {
+  InitializationTimings({
+    required this.queuedMs,
+    required this.initializeMs,
+  });
+
+  double queuedMs;
+
+  double initializeMs;
+
+  Object encode() {
+    return <Object?>[
+      queuedMs,
+      initializeMs,
+    ];
+  }
+
+  static InitializationTimings decode(Object result) {
+    result as List<Object?>;
+    return InitializationTimings(
+      queuedMs: result[0]! as double,
+      initializeMs: result[1]! as double,
+    );
+  }
+}
+
 class InitializeResponse {
   InitializeResponse({
     required this.result,
+    this.timings,
   });
 
   InitializationResult result;
 
+  InitializationTimings? timings;
+
   Object encode() {
     return <Object?>[
       result.index,
+      timings?.encode(),
     ];
   }
 
@@ -96,6 +173,9 @@ class InitializeResponse {
     result as List<Object?>;
     return InitializeResponse(
       result: InitializationResult.values[result[0]! as int],
+      timings: result[1] != null
+          ? InitializationTimings.decode(result[1]! as List<Object?>)
+          : null,
     );
   }
 }
@@ -184,6 +264,27 @@ class CameraModeResponse {
   }
 }
 
+class QualityTierResponse {
+  QualityTierResponse({
+    required this.tier,
+  });
+
+  QualityTier tier;
+
+  Object encode() {
+    return <Object?>[
+      tier.index,
+    ];
+  }
+
+  static QualityTierResponse decode(Object result) {
+    result as List<Object?>;
+    return QualityTierResponse(
+      tier: QualityTier.values[result[0]! as int],
+    );
+  }
+}
+
 class FaceStateResponse {
   FaceStateResponse({
     required this.state,
@@ -293,6 +394,121 @@ class Heartbeat {
   }
 }
 
+class StateSnapshot {
+  StateSnapshot({
+    required this.faceState,
+    this.normalizedFaceBbox,
+    required this.measurementState,
+    required this.measurementProgressPercentage,
+    this.heartRate4s,
+    this.heartRate10s,
+    required this.signalQuality,
+    required this.totalBadSignalSeconds,
+  });
+
+  FaceState faceState;
+
+  NormalizedFaceBbox? normalizedFaceBbox;
+
+  MeasurementState measurementState;
+
+  double measurementProgressPercentage;
+
+  int? heartRate4s;
+
+  int? heartRate10s;
+
+  double signalQuality;
+
+  double totalBadSignalSeconds;
+
+  Object encode() {
+    return <Object?>[
+      faceState.index,
+      normalizedFaceBbox?.encode(),
+      measurementState.index,
+      measurementProgressPercentage,
+      heartRate4s,
+      heartRate10s,
+      signalQuality,
+      totalBadSignalSeconds,
+    ];
+  }
+
+  static StateSnapshot decode(Object result) {
+    result as List<Object?>;
+    return StateSnapshot(
+      faceState: FaceState.values[result[0]! as int],
+      normalizedFaceBbox: result[1] != null
+          ? NormalizedFaceBbox.decode(result[1]! as List<Object?>)
+          : null,
+      measurementState: MeasurementState.values[result[2]! as int],
+      measurementProgressPercentage: result[3]! as double,
+      heartRate4s: result[4] as int?,
+      heartRate10s: result[5] as int?,
+      signalQuality: result[6]! as double,
+      totalBadSignalSeconds: result[7]! as double,
+    );
+  }
+}
+
+class HeartRateHistory {
+  HeartRateHistory({
+    required this.timestampsSec,
+    required this.heartRatesBpm,
+  });
+
+  Float64List timestampsSec;
+
+  Int32List heartRatesBpm;
+
+  Object encode() {
+    return <Object?>[
+      timestampsSec,
+      heartRatesBpm,
+    ];
+  }
+
+  static HeartRateHistory decode(Object result) {
+    result as List<Object?>;
+    return HeartRateHistory(
+      timestampsSec: result[0]! as Float64List,
+      heartRatesBpm: result[1]! as Int32List,
+    );
+  }
+}
+
+class Heartbeats {
+  Heartbeats({
+    required this.startLocationsSec,
+    required this.endLocationsSec,
+    required this.durationsMs,
+  });
+
+  Float64List startLocationsSec;
+
+  Float64List endLocationsSec;
+
+  Float64List durationsMs;
+
+  Object encode() {
+    return <Object?>[
+      startLocationsSec,
+      endLocationsSec,
+      durationsMs,
+    ];
+  }
+
+  static Heartbeats decode(Object result) {
+    result as List<Object?>;
+    return Heartbeats(
+      startLocationsSec: result[0]! as Float64List,
+      endLocationsSec: result[1]! as Float64List,
+      durationsMs: result[2]! as Float64List,
+    );
+  }
+}
+
 class MeasurementResults {
   MeasurementResults({
     required this.heart_rate_bpm,
@@ -320,7 +536,7 @@ class MeasurementResults {
 
   double? diastolic_blood_pressure_mmhg;
 
-  List<Heartbeat?> heartbeats;
+  Heartbeats heartbeats;
 
   double average_signal_quality;
 
@@ -333,7 +549,7 @@ class MeasurementResults {
       breathing_rate_bpm,
       systolic_blood_pressure_mmhg,
       diastolic_blood_pressure_mmhg,
-      heartbeats,
+      heartbeats.encode(),
       average_signal_quality,
     ];
   }
@@ -348,7 +564,7 @@ class MeasurementResults {
       breathing_rate_bpm: result[4] as double?,
       systolic_blood_pressure_mmhg: result[5] as double?,
       diastolic_blood_pressure_mmhg: result[6] as double?,
-      heartbeats: (result[7] as List<Object?>?)!.cast<Heartbeat?>(),
+      heartbeats: Heartbeats.decode(result[7]! as List<Object?>),
       average_signal_quality: result[8]! as double,
     );
   }
@@ -369,6 +585,8 @@ class InitializationSettings {
     this.showBloodFlow,
     this.proVersionLock,
     this.hideShenaiLogo,
+    this.headless,
+    this.qualityFloor,
   });
 
   PrecisionMode? precisionMode;
@@ -397,6 +615,10 @@ class InitializationSettings {
 
   bool? hideShenaiLogo;
 
+  bool? headless;
+
+  QualityTier? qualityFloor;
+
   Object encode() {
     return <Object?>[
       precisionMode?.index,
@@ -412,6 +634,8 @@ class InitializationSettings {
       showBloodFlow,
       proVersionLock,
       hideShenaiLogo,
+      headless,
+      qualityFloor?.index,
     ];
   }
 
@@ -441,6 +665,10 @@ class InitializationSettings {
       showBloodFlow: result[10] as bool?,
       proVersionLock: result[11] as bool?,
       hideShenaiLogo: result[12] as bool?,
+      headless: result[13] as bool?,
+      qualityFloor: result[14] != null
+          ? QualityTier.values[result[14]! as int]
+          : null,
     );
   }
 }
@@ -801,6 +1029,320 @@ class HealthRisks {
   }
 }
 
+class HealthRisksBundle {
+  HealthRisksBundle({
+    required this.actual,
+    required this.minimal,
+    required this.maximal,
+  });
+
+  HealthRisks actual;
+
+  HealthRisks minimal;
+
+  HealthRisks maximal;
+
+  Object encode() {
+    return <Object?>[
+      actual.encode(),
+      minimal.encode(),
+      maximal.encode(),
+    ];
+  }
+
+  static HealthRisksBundle decode(Object result) {
+    result as List<Object?>;
+    return HealthRisksBundle(
+      actual: HealthRisks.decode(result[0]! as List<Object?>),
+      minimal: HealthRisks.decode(result[1]! as List<Object?>),
+      maximal: HealthRisks.decode(result[2]! as List<Object?>),
+    );
+  }
+}
+
+class RiskFactorSensitivity {
+  RiskFactorSensitivity({
+    required this.factor,
+    required this.step,
+    required this.delta,
+  });
+
+  ModifiableRiskFactor factor;
+
+  double step;
+
+  HealthRisks delta;
+
+  Object encode() {
+    return <Object?>[
+      factor.index,
+      step,
+      delta.encode(),
+    ];
+  }
+
+  static RiskFactorSensitivity decode(Object result) {
+    result as List<Object?>;
+    return RiskFactorSensitivity(
+      factor: ModifiableRiskFactor.values[result[0]! as int],
+      step: result[1]! as double,
+      delta: HealthRisks.decode(result[2]! as List<Object?>),
+    );
+  }
+}
+
+class HealthRisksSensitivity {
+  HealthRisksSensitivity({
+    required this.risks,
+    required this.sensitivities,
+  });
+
+  HealthRisks risks;
+
+  List<RiskFactorSensitivity?> sensitivities;
+
+  Object encode() {
+    return <Object?>[
+      risks.encode(),
+      sensitivities,
+    ];
+  }
+
+  static HealthRisksSensitivity decode(Object result) {
+    result as List<Object?>;
+    return HealthRisksSensitivity(
+      risks: HealthRisks.decode(result[0]! as List<Object?>),
+      sensitivities: (result[1] as List<Object?>?)!.cast<RiskFactorSensitivity?>(),
+    );
+  }
+}
+
+class HealthRisksGridAxis {
+  HealthRisksGridAxis({
+    required this.factor,
+    required this.min,
+    required this.max,
+    required this.steps,
+  });
+
+  HealthRisksGridFactor factor;
+
+  double min;
+
+  double max;
+
+  int steps;
+
+  Object encode() {
+    return <Object?>[
+      factor.index,
+      min,
+      max,
+      steps,
+    ];
+  }
+
+  static HealthRisksGridAxis decode(Object result) {
+    result as List<Object?>;
+    return HealthRisksGridAxis(
+      factor: HealthRisksGridFactor.values[result[0]! as int],
+      min: result[1]! as double,
+      max: result[2]! as double,
+      steps: result[3]! as int,
+    );
+  }
+}
+
+class RisksFactorsUncertainty {
+  RisksFactorsUncertainty({
+    this.sbp,
+    this.cholesterol,
+    this.cholesterolHdl,
+    this.bodyHeight,
+    this.bodyWeight,
+  });
+
+  double? sbp;
+
+  double? cholesterol;
+
+  double? cholesterolHdl;
+
+  double? bodyHeight;
+
+  double? bodyWeight;
+
+  Object encode() {
+    return <Object?>[
+      sbp,
+      cholesterol,
+      cholesterolHdl,
+      bodyHeight,
+      bodyWeight,
+    ];
+  }
+
+  static RisksFactorsUncertainty decode(Object result) {
+    result as List<Object?>;
+    return RisksFactorsUncertainty(
+      sbp: result[0] as double?,
+      cholesterol: result[1] as double?,
+      cholesterolHdl: result[2] as double?,
+      bodyHeight: result[3] as double?,
+      bodyWeight: result[4] as double?,
+    );
+  }
+}
+
+class HealthRisksInterval {
+  HealthRisksInterval({
+    required this.lower,
+    required this.median,
+    required this.upper,
+  });
+
+  HealthRisks lower;
+
+  HealthRisks median;
+
+  HealthRisks upper;
+
+  Object encode() {
+    return <Object?>[
+      lower.encode(),
+      median.encode(),
+      upper.encode(),
+    ];
+  }
+
+  static HealthRisksInterval decode(Object result) {
+    result as List<Object?>;
+    return HealthRisksInterval(
+      lower: HealthRisks.decode(result[0]! as List<Object?>),
+      median: HealthRisks.decode(result[1]! as List<Object?>),
+      upper: HealthRisks.decode(result[2]! as List<Object?>),
+    );
+  }
+}
+
+class HealthRisksCacheStats {
+  HealthRisksCacheStats({
+    required this.hits,
+    required this.misses,
+  });
+
+  int hits;
+
+  int misses;
+
+  Object encode() {
+    return <Object?>[
+      hits,
+      misses,
+    ];
+  }
+
+  static HealthRisksCacheStats decode(Object result) {
+    result as List<Object?>;
+    return HealthRisksCacheStats(
+      hits: result[0]! as int,
+      misses: result[1]! as int,
+    );
+  }
+}
+
+class StagePerformance {
+  StagePerformance({
+    required this.count,
+    required this.p50Ms,
+    required this.p95Ms,
+    required this.maxMs,
+    required this.maxInFlight,
+  });
+
+  int count;
+
+  double p50Ms;
+
+  double p95Ms;
+
+  double maxMs;
+
+  int maxInFlight;
+
+  Object encode() {
+    return <Object?>[
+      count,
+      p50Ms,
+      p95Ms,
+      maxMs,
+      maxInFlight,
+    ];
+  }
+
+  static StagePerformance decode(Object result) {
+    result as List<Object?>;
+    return StagePerformance(
+      count: result[0]! as int,
+      p50Ms: result[1]! as double,
+      p95Ms: result[2]! as double,
+      maxMs: result[3]! as double,
+      maxInFlight: result[4]! as int,
+    );
+  }
+}
+
+class PerformanceStats {
+  PerformanceStats({
+    required this.windowSec,
+    required this.cpuTimeMs,
+    required this.initialize,
+    required this.stateSnapshot,
+    required this.imageExport,
+    required this.signalExport,
+    required this.healthRisks,
+  });
+
+  double windowSec;
+
+  double cpuTimeMs;
+
+  StagePerformance initialize;
+
+  StagePerformance stateSnapshot;
+
+  StagePerformance imageExport;
+
+  StagePerformance signalExport;
+
+  StagePerformance healthRisks;
+
+  Object encode() {
+    return <Object?>[
+      windowSec,
+      cpuTimeMs,
+      initialize.encode(),
+      stateSnapshot.encode(),
+      imageExport.encode(),
+      signalExport.encode(),
+      healthRisks.encode(),
+    ];
+  }
+
+  static PerformanceStats decode(Object result) {
+    result as List<Object?>;
+    return PerformanceStats(
+      windowSec: result[0]! as double,
+      cpuTimeMs: result[1]! as double,
+      initialize: StagePerformance.decode(result[2]! as List<Object?>),
+      stateSnapshot: StagePerformance.decode(result[3]! as List<Object?>),
+      imageExport: StagePerformance.decode(result[4]! as List<Object?>),
+      signalExport: StagePerformance.decode(result[5]! as List<Object?>),
+      healthRisks: StagePerformance.decode(result[6]! as List<Object?>),
+    );
+  }
+}
+
 class _ShenaiSdkNativeApiCodec extends StandardMessageCodec {
   const _ShenaiSdkNativeApiCodec();
   @override
@@ -826,39 +1368,81 @@ class _ShenaiSdkNativeApiCodec extends StandardMessageCodec {
     } else if (value is HealthRisks) {
       buffer.putUint8(134);
       writeValue(buffer, value.encode());
-    } else if (value is Heartbeat) {
+    } else if (value is HealthRisksBundle) {
       buffer.putUint8(135);
       writeValue(buffer, value.encode());
-    } else if (value is InitializationSettings) {
+    } else if (value is HealthRisksCacheStats) {
       buffer.putUint8(136);
       writeValue(buffer, value.encode());
-    } else if (value is InitializeResponse) {
+    } else if (value is HealthRisksGridAxis) {
       buffer.putUint8(137);
       writeValue(buffer, value.encode());
-    } else if (value is MeasurementPresetResponse) {
+    } else if (value is HealthRisksInterval) {
       buffer.putUint8(138);
       writeValue(buffer, value.encode());
-    } else if (value is MeasurementResults) {
+    } else if (value is HealthRisksSensitivity) {
       buffer.putUint8(139);
       writeValue(buffer, value.encode());
-    } else if (value is MeasurementStateResponse) {
+    } else if (value is HeartRateHistory) {
       buffer.putUint8(140);
       writeValue(buffer, value.encode());
-    } else if (value is NormalizedFaceBbox) {
+    } else if (value is Heartbeat) {
       buffer.putUint8(141);
       writeValue(buffer, value.encode());
-    } else if (value is OperatingModeResponse) {
+    } else if (value is Heartbeats) {
       buffer.putUint8(142);
       writeValue(buffer, value.encode());
-    } else if (value is PrecisionModeResponse) {
+    } else if (value is InitializationSettings) {
       buffer.putUint8(143);
       writeValue(buffer, value.encode());
-    } else if (value is RisksFactors) {
+    } else if (value is InitializationTimings) {
       buffer.putUint8(144);
       writeValue(buffer, value.encode());
-    } else if (value is RisksFactorsScores) {
+    } else if (value is InitializeResponse) {
       buffer.putUint8(145);
       writeValue(buffer, value.encode());
+    } else if (value is MeasurementPresetResponse) {
+      buffer.putUint8(146);
+      writeValue(buffer, value.encode());
+    } else if (value is MeasurementResults) {
+      buffer.putUint8(147);
+      writeValue(buffer, value.encode());
+    } else if (value is MeasurementStateResponse) {
+      buffer.putUint8(148);
+      writeValue(buffer, value.encode());
+    } else if (value is NormalizedFaceBbox) {
+      buffer.putUint8(149);
+      writeValue(buffer, value.encode());
+    } else if (value is OperatingModeResponse) {
+      buffer.putUint8(150);
+      writeValue(buffer, value.encode());
+    } else if (value is PerformanceStats) {
+      buffer.putUint8(151);
+      writeValue(buffer, value.encode());
+    } else if (value is PrecisionModeResponse) {
+      buffer.putUint8(152);
+      writeValue(buffer, value.encode());
+    } else if (value is QualityTierResponse) {
+      buffer.putUint8(153);
+      writeValue(buffer, value.encode());
+    } else if (value is RiskFactorSensitivity) {
+      buffer.putUint8(154);
+      writeValue(buffer, value.encode());
+    } else if (value is RisksFactors) {
+      buffer.putUint8(155);
+      writeValue(buffer, value.encode());
+    } else if (value is RisksFactorsScores) {
+      buffer.putUint8(156);
+      writeValue(buffer, value.encode());
+    } else if (value is RisksFactorsUncertainty) {
+      buffer.putUint8(157);
+      writeValue(buffer, value.encode());
+    } else if (value is StagePerformance) {
+      buffer.putUint8(158);
+      writeValue(buffer, value.encode());
+    } else if (value is StateSnapshot) {
+      buffer.putUint8(159);
+      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -882,27 +1466,55 @@ class _ShenaiSdkNativeApiCodec extends StandardMessageCodec {
       case 134: 
         return HealthRisks.decode(readValue(buffer)!);
       case 135: 
-        return Heartbeat.decode(readValue(buffer)!);
+        return HealthRisksBundle.decode(readValue(buffer)!);
       case 136: 
-        return InitializationSettings.decode(readValue(buffer)!);
+        return HealthRisksCacheStats.decode(readValue(buffer)!);
       case 137: 
-        return InitializeResponse.decode(readValue(buffer)!);
+        return HealthRisksGridAxis.decode(readValue(buffer)!);
       case 138: 
-        return MeasurementPresetResponse.decode(readValue(buffer)!);
+        return HealthRisksInterval.decode(readValue(buffer)!);
       case 139: 
-        return MeasurementResults.decode(readValue(buffer)!);
+        return HealthRisksSensitivity.decode(readValue(buffer)!);
       case 140: 
-        return MeasurementStateResponse.decode(readValue(buffer)!);
+        return HeartRateHistory.decode(readValue(buffer)!);
       case 141: 
-        return NormalizedFaceBbox.decode(readValue(buffer)!);
+        return Heartbeat.decode(readValue(buffer)!);
       case 142: 
-        return OperatingModeResponse.decode(readValue(buffer)!);
+        return Heartbeats.decode(readValue(buffer)!);
       case 143: 
-        return PrecisionModeResponse.decode(readValue(buffer)!);
+        return InitializationSettings.decode(readValue(buffer)!);
       case 144: 
-        return RisksFactors.decode(readValue(buffer)!);
+        return InitializationTimings.decode(readValue(buffer)!);
       case 145: 
+        return InitializeResponse.decode(readValue(buffer)!);
+      case 146: 
+        return MeasurementPresetResponse.decode(readValue(buffer)!);
+      case 147: 
+        return MeasurementResults.decode(readValue(buffer)!);
+      case 148: 
+        return MeasurementStateResponse.decode(readValue(buffer)!);
+      case 149: 
+        return NormalizedFaceBbox.decode(readValue(buffer)!);
+      case 150: 
+        return OperatingModeResponse.decode(readValue(buffer)!);
+      case 151: 
+        return PerformanceStats.decode(readValue(buffer)!);
+      case 152: 
+        return PrecisionModeResponse.decode(readValue(buffer)!);
+      case 153: 
+        return QualityTierResponse.decode(readValue(buffer)!);
+      case 154: 
+        return RiskFactorSensitivity.decode(readValue(buffer)!);
+      case 155: 
+        return RisksFactors.decode(readValue(buffer)!);
+      case 156: 
         return RisksFactorsScores.decode(readValue(buffer)!);
+      case 157: 
+        return RisksFactorsUncertainty.decode(readValue(buffer)!);
+      case 158: 
+        return StagePerformance.decode(readValue(buffer)!);
+      case 159: 
+        return StateSnapshot.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
@@ -946,6 +1558,28 @@ class ShenaiSdkNativeApi {
     }
   }
 
+  Future<void> cancelInitialization() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.cancelInitialization', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
   Future<bool> isInitialized() async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.isInitialized', codec,
@@ -1235,6 +1869,77 @@ class ShenaiSdkNativeApi {
     }
   }
 
+  Future<void> suspend() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.suspend', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> resume() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.resume', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<bool> isSuspended() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.isSuspended', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as bool?)!;
+    }
+  }
+
   Future<void> setShowUserInterface(bool arg_show) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setShowUserInterface', codec,
@@ -1529,6 +2234,33 @@ class ShenaiSdkNativeApi {
     }
   }
 
+  Future<QualityTierResponse> getQualityTier() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getQualityTier', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as QualityTierResponse?)!;
+    }
+  }
+
   Future<void> setEnableStartAfterSuccess(bool arg_enable) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setEnableStartAfterSuccess', codec,
@@ -1725,6 +2457,33 @@ class ShenaiSdkNativeApi {
     }
   }
 
+  Future<StateSnapshot> getStateSnapshot() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getStateSnapshot', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as StateSnapshot?)!;
+    }
+  }
+
   Future<MeasurementResults?> getRealtimeMetrics(double arg_period_sec) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getRealtimeMetrics', codec,
@@ -1916,7 +2675,7 @@ class ShenaiSdkNativeApi {
     }
   }
 
-  Future<Float64List?> getFullPpgSignal() async {
+  Future<Uint8List?> getFullPpgSignal() async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getFullPpgSignal', codec,
         binaryMessenger: _binaryMessenger);
@@ -1934,7 +2693,88 @@ class ShenaiSdkNativeApi {
         details: replyList[2],
       );
     } else {
-      return (replyList[0] as Float64List?);
+      return (replyList[0] as Uint8List?);
+    }
+  }
+
+  Future<HeartRateHistory> getHeartRateHistory10s(double? arg_sinceSec) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRateHistory10s', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_sinceSec]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as HeartRateHistory?)!;
+    }
+  }
+
+  Future<HeartRateHistory> getHeartRateHistory4s(double? arg_sinceSec) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHeartRateHistory4s', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_sinceSec]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as HeartRateHistory?)!;
+    }
+  }
+
+  Future<Heartbeats> getRealtimeHeartbeats(double? arg_sinceSec) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getRealtimeHeartbeats', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_sinceSec]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as Heartbeats?)!;
     }
   }
 
@@ -2067,4 +2907,188 @@ class ShenaiSdkNativeApi {
       return (replyList[0] as HealthRisks?)!;
     }
   }
+
+  Future<HealthRisksBundle> computeHealthRisksBundle(RisksFactors arg_healthRisksFactors) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksBundle', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_healthRisksFactors]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as HealthRisksBundle?)!;
+    }
+  }
+
+  Future<HealthRisksSensitivity> computeHealthRisksSensitivity(RisksFactors arg_healthRisksFactors) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksSensitivity', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_healthRisksFactors]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as HealthRisksSensitivity?)!;
+    }
+  }
+
+  Future<Uint8List> computeHealthRisksGrid(RisksFactors arg_baseFactors, HealthRisksGridAxis arg_xAxis, HealthRisksGridAxis arg_yAxis, HealthRisksMetric arg_metric) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksGrid', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_baseFactors, arg_xAxis, arg_yAxis, arg_metric.index]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as Uint8List?)!;
+    }
+  }
+
+  Future<HealthRisksInterval> computeHealthRisksUncertainty(RisksFactors arg_healthRisksFactors, RisksFactorsUncertainty arg_uncertainty, int arg_samples, int arg_seed) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.computeHealthRisksUncertainty', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_healthRisksFactors, arg_uncertainty, arg_samples, arg_seed]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as HealthRisksInterval?)!;
+    }
+  }
+
+  Future<void> setHealthRisksCacheCapacity(int arg_capacity) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.setHealthRisksCacheCapacity', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_capacity]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<HealthRisksCacheStats> getHealthRisksCacheStats() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getHealthRisksCacheStats', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as HealthRisksCacheStats?)!;
+    }
+  }
+
+  Future<PerformanceStats> getPerformanceStats(bool arg_reset) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.shenai_sdk.ShenaiSdkNativeApi.getPerformanceStats', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_reset]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as PerformanceStats?)!;
+    }
+  }
 }
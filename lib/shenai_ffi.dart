@@ -0,0 +1,126 @@
+import 'dart:ffi';
+import 'dart:io' show Platform;
+
+import 'pigeon.dart';
+
+// Layouts of ios/Classes/shenai_c_api.h
+class _OptionalInt extends Struct {
+  @Int32()
+  external int present;
+  @Int32()
+  external int value;
+}
+
+class _NormalizedFaceBbox extends Struct {
+  @Int32()
+  external int present;
+  @Float()
+  external double x;
+  @Float()
+  external double y;
+  @Float()
+  external double width;
+  @Float()
+  external double height;
+}
+
+class _StateSnapshot extends Struct {
+  @Int32()
+  external int faceState;
+  @Int32()
+  external int measurementState;
+  @Float()
+  external double measurementProgressPercentage;
+  @Float()
+  external double signalQuality;
+  @Float()
+  external double totalBadSignalSeconds;
+  external _OptionalInt heartRate4s;
+  external _OptionalInt heartRate10s;
+  external _NormalizedFaceBbox normalizedFaceBbox;
+}
+
+// Synchronous read-only getters calling the SDK directly from the Dart isolate, without a platform channel.
+// Only available where the plugin is linked into the process (iOS) and its symbols were kept; elsewhere `instance`
+// is null and the asynchronous ShenaiSdk getters have to be used.
+class ShenaiSdkFfi {
+  ShenaiSdkFfi._(DynamicLibrary library)
+      : _isInitialized = library.lookupFunction<Int32 Function(), int Function()>('shenai_is_initialized'),
+        _getFaceState = library.lookupFunction<Int32 Function(), int Function()>('shenai_get_face_state'),
+        _getMeasurementState =
+            library.lookupFunction<Int32 Function(), int Function()>('shenai_get_measurement_state'),
+        _getMeasurementProgressPercentage = library
+            .lookupFunction<Float Function(), double Function()>('shenai_get_measurement_progress_percentage'),
+        _getHeartRate4s =
+            library.lookupFunction<_OptionalInt Function(), _OptionalInt Function()>('shenai_get_heart_rate_4s'),
+        _getHeartRate10s =
+            library.lookupFunction<_OptionalInt Function(), _OptionalInt Function()>('shenai_get_heart_rate_10s'),
+        _getCurrentSignalQualityMetric = library
+            .lookupFunction<Float Function(), double Function()>('shenai_get_current_signal_quality_metric'),
+        _getTotalBadSignalSeconds =
+            library.lookupFunction<Float Function(), double Function()>('shenai_get_total_bad_signal_seconds'),
+        _getNormalizedFaceBbox = library.lookupFunction<_NormalizedFaceBbox Function(),
+            _NormalizedFaceBbox Function()>('shenai_get_normalized_face_bbox'),
+        _getStateSnapshot = library
+            .lookupFunction<_StateSnapshot Function(), _StateSnapshot Function()>('shenai_get_state_snapshot');
+
+  static final ShenaiSdkFfi? instance = Platform.isIOS ? _load() : null;
+
+  // A release build stripping all symbols (STRIP_STYLE=all) leaves nothing to look up
+  static ShenaiSdkFfi? _load() {
+    try {
+      return ShenaiSdkFfi._(DynamicLibrary.process());
+    } on ArgumentError {
+      return null;
+    }
+  }
+
+  final int Function() _isInitialized;
+  final int Function() _getFaceState;
+  final int Function() _getMeasurementState;
+  final double Function() _getMeasurementProgressPercentage;
+  final _OptionalInt Function() _getHeartRate4s;
+  final _OptionalInt Function() _getHeartRate10s;
+  final double Function() _getCurrentSignalQualityMetric;
+  final double Function() _getTotalBadSignalSeconds;
+  final _NormalizedFaceBbox Function() _getNormalizedFaceBbox;
+  final _StateSnapshot Function() _getStateSnapshot;
+
+  bool isInitialized() => _isInitialized() != 0;
+
+  FaceState getFaceState() => FaceState.values[_getFaceState()];
+
+  MeasurementState getMeasurementState() => MeasurementState.values[_getMeasurementState()];
+
+  double getMeasurementProgressPercentage() => _getMeasurementProgressPercentage();
+
+  int? getHeartRate4s() => _optionalInt(_getHeartRate4s());
+
+  int? getHeartRate10s() => _optionalInt(_getHeartRate10s());
+
+  double getCurrentSignalQualityMetric() => _getCurrentSignalQualityMetric();
+
+  double getTotalBadSignalSeconds() => _getTotalBadSignalSeconds();
+
+  NormalizedFaceBbox? getNormalizedFaceBbox() => _faceBbox(_getNormalizedFaceBbox());
+
+  StateSnapshot getStateSnapshot() {
+    final _StateSnapshot snapshot = _getStateSnapshot();
+    return StateSnapshot(
+      faceState: FaceState.values[snapshot.faceState],
+      normalizedFaceBbox: _faceBbox(snapshot.normalizedFaceBbox),
+      measurementState: MeasurementState.values[snapshot.measurementState],
+      measurementProgressPercentage: snapshot.measurementProgressPercentage,
+      heartRate4s: _optionalInt(snapshot.heartRate4s),
+      heartRate10s: _optionalInt(snapshot.heartRate10s),
+      signalQuality: snapshot.signalQuality,
+      totalBadSignalSeconds: snapshot.totalBadSignalSeconds,
+    );
+  }
+
+  static int? _optionalInt(_OptionalInt value) => value.present != 0 ? value.value : null;
+
+  static NormalizedFaceBbox? _faceBbox(_NormalizedFaceBbox bbox) => bbox.present != 0
+      ? NormalizedFaceBbox(x: bbox.x, y: bbox.y, width: bbox.width, height: bbox.height)
+      : null;
+}
@@ -1,22 +1,49 @@
 
 import 'pigeon.dart';
+import 'shenai_state.dart';
 import 'dart:developer';
 
-import 'dart:typed_data' show Uint8List, Float64List;
+import 'dart:typed_data' show Uint8List, Float32List;
+import 'package:flutter/services.dart' show EventChannel;
+
+export 'heartbeats_view.dart';
 
 class ShenaiSdk {
 
+  // Whether the SDK was initialized headless, ShenaiView then creates no platform view
+  static bool get isHeadless => _headless;
+  static bool _headless = false;
+
+  /// Initializes the SDK.
+  ///
+  /// [initialize], [deinitialize], [suspend] and [resume] run one after another in the order they were called.
+  /// Other calls don't wait for them: getters and setters issued meanwhile reach the SDK in whatever state it is in
+  /// at that moment, for example [isInitialized] returns false until this future completes.
   static Future<InitializationResult> initialize(String apiKey, String userId, {InitializationSettings? settings}) async {
-    var response = await _api.initialize(apiKey, userId, settings);
+    var response = await initializeAsync(apiKey, userId, settings: settings);
     return response.result;
   }
 
+  static Future<InitializeResponse> initializeAsync(String apiKey, String userId,
+      {InitializationSettings? settings}) async {
+    var response = await _api.initialize(apiKey, userId, settings);
+    if (response.result == InitializationResult.success) {
+      _headless = settings?.headless ?? false;
+    }
+    return response;
+  }
+
+  static Future cancelInitialization() async {
+    return _api.cancelInitialization();
+  }
+
   static Future<bool> isInitialized() async {
     return _api.isInitialized();
   }
 
   static Future deinitialize() async {
-    return _api.deinitialize();
+    await _api.deinitialize();
+    _headless = false;
   }
 
   static Future setOperatingMode(OperatingMode mode) async {
@@ -54,6 +81,18 @@ class ShenaiSdk {
     var res = await _api.getCameraMode();
     return res.mode;
   }
+
+  static Future suspend() async {
+    return _api.suspend();
+  }
+
+  static Future resume() async {
+    return _api.resume();
+  }
+
+  static Future<bool> isSuspended() async {
+    return _api.isSuspended();
+  }
   static Future setCameraMode(CameraMode mode) async {
     return _api.setCameraMode(mode);
   }
@@ -100,6 +139,11 @@ class ShenaiSdk {
     return _api.getShowBloodFlow();
   }
 
+  static Future<QualityTier> getQualityTier() async {
+    var res = await _api.getQualityTier();
+    return res.tier;
+  }
+
   static Future setEnableStartAfterSuccess(bool enable) async {
     return _api.setEnableStartAfterSuccess(enable);
   }
@@ -132,6 +176,10 @@ class ShenaiSdk {
     return _api.getHeartRate4s();
   }
 
+  static Future<StateSnapshot> getStateSnapshot() async {
+    return _api.getStateSnapshot();
+  }
+
   static Future<MeasurementResults?> getRealtimeMetrics(double period_sec) async {
     return _api.getRealtimeMetrics(period_sec);
   }
@@ -162,8 +210,33 @@ class ShenaiSdk {
     return _api.getSignalQualityMapPng();
   }
 
-  static Future<Float64List?> getFullPpgSignal() async {
-    return _api.getFullPpgSignal();
+  static Future<Float32List?> getFullPpgSignal() async {
+    var bytes = await _api.getFullPpgSignal();
+    return bytes != null ? _asFloat32List(bytes) : null;
+  }
+
+  /// Heart rate history of the current measurement, optionally only the entries after [sinceSec].
+  ///
+  /// [sinceSec] only trims what is sent over the platform channel: the native side still copies the whole history
+  /// out of the SDK on every call, so each call costs more the longer the session runs. Not available on Android,
+  /// where it throws a `PlatformException` with code `unsupported`.
+  static Future<HeartRateHistory> getHeartRateHistory10s({double? sinceSec}) async {
+    return _api.getHeartRateHistory10s(sinceSec);
+  }
+
+  /// Same as [getHeartRateHistory10s] for the 4 second heart rate, with the same costs and the same
+  /// `unsupported` error on Android.
+  static Future<HeartRateHistory> getHeartRateHistory4s({double? sinceSec}) async {
+    return _api.getHeartRateHistory4s(sinceSec);
+  }
+
+  /// Heartbeats detected so far, optionally only the ones ending after [sinceSec].
+  ///
+  /// As with [getHeartRateHistory10s], [sinceSec] only trims what crosses the platform channel; the native side
+  /// still copies every heartbeat of the session on each call. Throws a `PlatformException` with code `unsupported`
+  /// on Android.
+  static Future<Heartbeats> getRealtimeHeartbeats({double? sinceSec}) async {
+    return _api.getRealtimeHeartbeats(sinceSec);
   }
 
   static Future<String> getTraceID() async {
@@ -186,6 +259,58 @@ class ShenaiSdk {
     return _api.getMaximalHealthRisks(healthRisksFactors);
   }
 
+  static Future<HealthRisksBundle> computeHealthRisksBundle(RisksFactors healthRisksFactors) async {
+    return _api.computeHealthRisksBundle(healthRisksFactors);
+  }
+
+  static Future<HealthRisksSensitivity> computeHealthRisksSensitivity(RisksFactors healthRisksFactors) async {
+    return _api.computeHealthRisksSensitivity(healthRisksFactors);
+  }
+
+  static Future<Float32List> computeHealthRisksGrid(RisksFactors baseFactors, HealthRisksGridAxis xAxis,
+      HealthRisksGridAxis yAxis, HealthRisksMetric metric) async {
+    return _asFloat32List(await _api.computeHealthRisksGrid(baseFactors, xAxis, yAxis, metric));
+  }
+
+  static Future<HealthRisksInterval> computeHealthRisksUncertainty(RisksFactors healthRisksFactors,
+      RisksFactorsUncertainty uncertainty, {int samples = 2000, int seed = 0}) async {
+    return _api.computeHealthRisksUncertainty(healthRisksFactors, uncertainty, samples, seed);
+  }
+
+  // Applied on a background queue of its own: health risks calls already in flight, or issued without awaiting this,
+  // may still run against the previous cache
+  static Future setHealthRisksCacheCapacity(int capacity) async {
+    return _api.setHealthRisksCacheCapacity(capacity);
+  }
+
+  static Future<HealthRisksCacheStats> getHealthRisksCacheStats() async {
+    return _api.getHealthRisksCacheStats();
+  }
+
+  static Future<PerformanceStats> getPerformanceStats({bool reset = false}) async {
+    return _api.getPerformanceStats(reset);
+  }
+
+  /// State changes of the SDK, sent only when a field changed or an SDK event was raised.
+  ///
+  /// This is not free while listened to: the platform side still polls six state getters ten times a second on the
+  /// main thread and compares them with the last sent values, so cancel the subscription when the state is not
+  /// shown. Signal quality only counts as changed once it moved by 0.1, and [ShenaiStateChange.events] is always
+  /// empty on Android, where the SDK reports no events.
+  static Stream<ShenaiStateChange> get stateChanges =>
+      _stateChannel.receiveBroadcastStream().map((dynamic message) => ShenaiStateChange.decode(message as Object));
+
+  static const EventChannel _stateChannel = EventChannel('shenai_sdk/state_changes');
+
+  // Float arrays cross the platform channel as native-order bytes, pigeon has no Float32List type
+  static Float32List _asFloat32List(Uint8List bytes) {
+    // the codec doesn't align byte buffers, and a float view needs an aligned offset
+    if (bytes.offsetInBytes % Float32List.bytesPerElement != 0) {
+      bytes = Uint8List.fromList(bytes);
+    }
+    return bytes.buffer.asFloat32List(bytes.offsetInBytes, bytes.lengthInBytes ~/ Float32List.bytesPerElement);
+  }
+
   static late ShenaiSdkNativeApi _api = ShenaiSdkNativeApi();
   static ShenaiSdkNativeApi get api => _api;
 }
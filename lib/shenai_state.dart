@@ -0,0 +1,63 @@
+import 'pigeon.dart';
+
+enum ShenaiStateField {
+  measurementState,
+  faceState,
+  normalizedFaceBbox,
+  measurementProgressPercentage,
+  heartRate4s,
+  signalQuality,
+}
+
+enum ShenaiEvent {
+  startButtonClicked,
+  stopButtonClicked,
+  measurementFinished,
+}
+
+class ShenaiStateChange {
+  ShenaiStateChange({
+    required this.measurementState,
+    required this.faceState,
+    this.normalizedFaceBbox,
+    this.measurementProgressPercentage,
+    this.heartRate4s,
+    this.signalQuality,
+    required this.changed,
+    required this.events,
+  });
+
+  MeasurementState measurementState;
+  FaceState faceState;
+  NormalizedFaceBbox? normalizedFaceBbox;
+  double? measurementProgressPercentage;
+  int? heartRate4s;
+  double? signalQuality;
+
+  // Fields that differ from the previous change, all of them for the first one
+  Set<ShenaiStateField> changed;
+
+  // SDK events raised since the previous change
+  List<ShenaiEvent> events;
+
+  static ShenaiStateChange decode(Object message) {
+    final Map<Object?, Object?> map = message as Map<Object?, Object?>;
+    final List<Object?>? bbox = map['normalizedFaceBbox'] as List<Object?>?;
+    return ShenaiStateChange(
+      measurementState: MeasurementState.values[map['measurementState']! as int],
+      faceState: FaceState.values[map['faceState']! as int],
+      normalizedFaceBbox: bbox != null
+          ? NormalizedFaceBbox(
+              x: (bbox[0]! as num).toDouble(),
+              y: (bbox[1]! as num).toDouble(),
+              width: (bbox[2]! as num).toDouble(),
+              height: (bbox[3]! as num).toDouble())
+          : null,
+      measurementProgressPercentage: (map['measurementProgressPercentage'] as num?)?.toDouble(),
+      heartRate4s: map['heartRate4s'] as int?,
+      signalQuality: (map['signalQuality'] as num?)?.toDouble(),
+      changed: (map['changed']! as List<Object?>).map((Object? field) => ShenaiStateField.values[field! as int]).toSet(),
+      events: (map['events']! as List<Object?>).map((Object? event) => ShenaiEvent.values[event! as int]).toList(),
+    );
+  }
+}
@@ -4,9 +4,16 @@ import 'package:flutter/material.dart';
 import 'package:flutter/rendering.dart';
 import 'package:flutter/services.dart';
 
+import 'shenai_sdk.dart';
+
 class ShenaiView extends StatelessWidget {
     @override
     Widget build(BuildContext context) {
+    // Headless SDK: nothing to show, and no platform view or render resources are created
+    if (ShenaiSdk.isHeadless) {
+        return const SizedBox.shrink();
+    }
+
     // This is used in the platform side to register the view.
     const String viewType = 'ShenaiSdkView';
     // Pass parameters to the platform side.
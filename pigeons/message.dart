@@ -1,9 +1,15 @@
 import 'package:pigeon/pigeon.dart';
 
-enum InitializationResult { success, failInvalidApiKey, failConnectionError, failInternalError }
+enum InitializationResult { success, failInvalidApiKey, failConnectionError, failInternalError, cancelled }
+
+class InitializationTimings {
+  double queuedMs;                // Waiting for earlier initialize/deinitialize calls
+  double initializeMs;            // SDK initialization (license check, model loading, camera start)
+}
 
 class InitializeResponse {
    InitializationResult result;
+   InitializationTimings? timings;
 }
 
 enum OperatingMode {
@@ -54,6 +60,16 @@ enum OnboardingMode {
   showAlways
 }
 
+enum QualityTier {
+  full,
+  reducedOverlays,
+  minimalOverlays
+}
+
+class QualityTierResponse {
+  QualityTier tier;
+}
+
 enum FaceState {
   ok,
   tooFar,
@@ -95,6 +111,28 @@ class Heartbeat {
   double duration_ms;
 }
 
+class StateSnapshot {
+  FaceState faceState;
+  NormalizedFaceBbox? normalizedFaceBbox;
+  MeasurementState measurementState;
+  double measurementProgressPercentage;
+  int? heartRate4s;
+  int? heartRate10s;
+  double signalQuality;
+  double totalBadSignalSeconds;
+}
+
+class HeartRateHistory {
+  Float64List timestampsSec;
+  Int32List heartRatesBpm;
+}
+
+class Heartbeats {
+  Float64List startLocationsSec;
+  Float64List endLocationsSec;
+  Float64List durationsMs;
+}
+
 class MeasurementResults {
   double heart_rate_bpm;                   // Heart rate, rounded to 1 BPM   
   double? hrv_sdnn_ms;                     // Heart rate variability, SDNN metric, rounded to 1 ms
@@ -103,7 +141,7 @@ class MeasurementResults {
   double? breathing_rate_bpm;              // Breathing rate, rounded to 1 BPM       
   double? systolic_blood_pressure_mmhg;    // Systolic blood pressure, rounded to 1 mmHg                 
   double? diastolic_blood_pressure_mmhg;   // Diastolic blood pressure, rounded to 1 mmHg                   
-  List<Heartbeat?> heartbeats;             // Heartbeat locations       
+  Heartbeats heartbeats;                   // Heartbeat locations       
   double average_signal_quality;           // Average signal quality metric
 }
 
@@ -122,6 +160,9 @@ class InitializationSettings {
   bool? showBloodFlow;
   bool? proVersionLock;
   bool? hideShenaiLogo;
+  bool? headless;
+
+  QualityTier? qualityFloor;
 }
 
 class CustomMeasurementConfig {
@@ -174,6 +215,46 @@ class RisksFactors {
   Race? race;
 }
 
+enum ModifiableRiskFactor {
+  sbp,
+  cholesterol,
+  cholesterolHdl,
+  smoking,
+  bmi,
+  diabetes,
+  hypertensionTreatment
+}
+
+enum HealthRisksGridFactor {
+  age,
+  sbp,
+  cholesterol,
+  cholesterolHdl,
+  bodyWeight,
+  bodyHeight
+}
+
+enum HealthRisksMetric {
+  coronaryDeathEventRisk,
+  fatalStrokeEventRisk,
+  totalCVMortalityRisk,
+  hardCVEventRisk,
+  overallRisk,
+  coronaryHeartDiseaseRisk,
+  strokeRisk,
+  heartFailureRisk,
+  peripheralVascularDiseaseRisk,
+  vascularAge,
+  ageScore,
+  sbpScore,
+  smokingScore,
+  diabetesScore,
+  bmiScore,
+  cholesterolScore,
+  cholesterolHdlScore,
+  totalScore
+}
+
 class HardAndFatalEventsRisks {
   double? coronaryDeathEventRisk;
   double? fatalStrokeEventRisk;
@@ -207,9 +288,74 @@ class HealthRisks {
   RisksFactorsScores scores;
 }
 
+class HealthRisksBundle {
+  HealthRisks actual;
+  HealthRisks minimal;
+  HealthRisks maximal;
+}
+
+class RiskFactorSensitivity {
+  ModifiableRiskFactor factor;
+  double step;
+  HealthRisks delta;
+}
+
+class HealthRisksSensitivity {
+  HealthRisks risks;
+  List<RiskFactorSensitivity?> sensitivities;
+}
+
+class HealthRisksGridAxis {
+  HealthRisksGridFactor factor;
+  double min;
+  double max;
+  int steps;
+}
+
+class RisksFactorsUncertainty {
+  double? sbp;
+  double? cholesterol;
+  double? cholesterolHdl;
+  double? bodyHeight;
+  double? bodyWeight;
+}
+
+class HealthRisksInterval {
+  HealthRisks lower;
+  HealthRisks median;
+  HealthRisks upper;
+}
+
+class HealthRisksCacheStats {
+  int hits;
+  int misses;
+}
+
+class StagePerformance {
+  int count;
+  double p50Ms;
+  double p95Ms;
+  double maxMs;
+  int maxInFlight;
+}
+
+class PerformanceStats {
+  double windowSec;
+  double cpuTimeMs;
+  StagePerformance initialize;
+  StagePerformance stateSnapshot;
+  StagePerformance imageExport;
+  StagePerformance signalExport;
+  StagePerformance healthRisks;
+}
+
 @HostApi()
 abstract class ShenaiSdkNativeApi {
+  // Lifecycle calls are received on the platform thread in call order and run one after another on a plugin queue
+  @async
   InitializeResponse initialize(String apiKey, String userId, InitializationSettings? settings);
+  @async
+  void cancelInitialization();
   bool isInitialized();
   @async
   void deinitialize();
@@ -229,6 +375,12 @@ abstract class ShenaiSdkNativeApi {
   void setCameraMode(CameraMode mode);
   CameraModeResponse getCameraMode();
 
+  @async
+  void suspend();
+  @async
+  void resume();
+  bool isSuspended();
+
   void setShowUserInterface(bool show);
   bool getShowUserInterface();
 
@@ -247,6 +399,8 @@ abstract class ShenaiSdkNativeApi {
   void setShowBloodFlow(bool show);
   bool getShowBloodFlow();
 
+  QualityTierResponse getQualityTier();
+
   void setEnableStartAfterSuccess(bool enable);
   bool getEnableStartAfterSuccess();
 
@@ -258,6 +412,8 @@ abstract class ShenaiSdkNativeApi {
   int? getHeartRate10s();
   int? getHeartRate4s();
 
+  StateSnapshot getStateSnapshot();
+
   MeasurementResults? getRealtimeMetrics(double period_sec);
   MeasurementResults? getMeasurementResults();
 
@@ -267,16 +423,47 @@ abstract class ShenaiSdkNativeApi {
   double getTotalBadSignalSeconds();
   double getCurrentSignalQualityMetric();
 
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
   Uint8List? getSignalQualityMapPng();
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
   Uint8List? getFaceTexturePng();
 
-  Float64List? getFullPpgSignal();
+  // float32 samples in native byte order, pigeon has no Float32List type
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  Uint8List? getFullPpgSignal();
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  HeartRateHistory getHeartRateHistory10s(double? sinceSec);
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  HeartRateHistory getHeartRateHistory4s(double? sinceSec);
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  Heartbeats getRealtimeHeartbeats(double? sinceSec);
 
   String getTraceID();
 
   void setLanguage(String language);
 
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
   HealthRisks computeHealthRisks(RisksFactors healthRisksFactors);
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
   HealthRisks getMinimalHealthRisks(RisksFactors healthRisksFactors);
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
   HealthRisks getMaximalHealthRisks(RisksFactors healthRisksFactors);
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  HealthRisksBundle computeHealthRisksBundle(RisksFactors healthRisksFactors);
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  HealthRisksSensitivity computeHealthRisksSensitivity(RisksFactors healthRisksFactors);
+  // float32 cells in native byte order, see getFullPpgSignal
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  Uint8List computeHealthRisksGrid(
+      RisksFactors baseFactors, HealthRisksGridAxis xAxis, HealthRisksGridAxis yAxis, HealthRisksMetric metric);
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  HealthRisksInterval computeHealthRisksUncertainty(
+      RisksFactors healthRisksFactors, RisksFactorsUncertainty uncertainty, int samples, int seed);
+
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  void setHealthRisksCacheCapacity(int capacity);
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  HealthRisksCacheStats getHealthRisksCacheStats();
+
+  PerformanceStats getPerformanceStats(bool reset);
 }
@@ -0,0 +1,87 @@
+#include "population_scoring.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+void printUsage(const char* program) {
+  std::fprintf(stderr,
+               "usage: %s [--format auto|binary|csv] [--threads N] [--chunk-records N] [--chunk-bytes N] "
+               "INPUT OUTPUT\n",
+               program);
+}
+
+bool parseCount(const char* text, std::size_t& value) {
+  char* end = nullptr;
+  const unsigned long long number = std::strtoull(text, &end, 10);
+  if (end == text || *end != '\0') {
+    return false;
+  }
+  value = static_cast<std::size_t>(number);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  using namespace mx::health_risks;
+
+  PopulationScoringOptions options;
+  const char* paths[2] = {nullptr, nullptr};
+  int num_paths = 0;
+  for (int i = 1; i < argc; ++i) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    std::size_t count = 0;
+    if (std::strcmp(arg, "--format") == 0 && value != nullptr) {
+      if (std::strcmp(value, "auto") == 0) {
+        options.format = PopulationFileFormat::automatic;
+      } else if (std::strcmp(value, "binary") == 0) {
+        options.format = PopulationFileFormat::binary;
+      } else if (std::strcmp(value, "csv") == 0) {
+        options.format = PopulationFileFormat::csv;
+      } else {
+        printUsage(argv[0]);
+        return 2;
+      }
+      ++i;
+    } else if (std::strcmp(arg, "--threads") == 0 && value != nullptr && parseCount(value, count)) {
+      options.num_threads = static_cast<unsigned>(count);
+      ++i;
+    } else if (std::strcmp(arg, "--chunk-records") == 0 && value != nullptr && parseCount(value, count)) {
+      options.chunk_records = count;
+      ++i;
+    } else if (std::strcmp(arg, "--chunk-bytes") == 0 && value != nullptr && parseCount(value, count)) {
+      options.chunk_bytes = count;
+      ++i;
+    } else if (arg[0] != '-' && num_paths < 2) {
+      paths[num_paths++] = arg;
+    } else {
+      printUsage(argv[0]);
+      return 2;
+    }
+  }
+  if (num_paths != 2) {
+    printUsage(argv[0]);
+    return 2;
+  }
+
+  const PopulationScoringResult result = scorePopulationFile(paths[0], paths[1], options);
+  if (!result.error.empty()) {
+    std::fprintf(stderr, "%s\n", result.error.c_str());
+    return 1;
+  }
+
+  const PopulationScoringStats& stats = result.stats;
+  std::printf("records:         %zu in %zu chunks\n", stats.records, stats.chunks);
+  std::printf("invalid values:  %zu\n", stats.invalid_values);
+  std::printf("wall time:       %.3f s (%.0f records/s)\n", stats.wall_seconds, stats.records_per_second);
+  std::printf("peak RSS:        %.1f MiB\n", static_cast<double>(stats.peak_rss_bytes) / (1 << 20));
+  for (std::size_t thread = 0; thread < stats.thread_utilization.size(); ++thread) {
+    std::printf("worker %-8zu %.0f%% busy\n", thread, stats.thread_utilization[thread] * 100);
+  }
+  return 0;
+}
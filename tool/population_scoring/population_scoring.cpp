@@ -0,0 +1,485 @@
+#include "population_scoring.h"
+
+#include "health_risks_batch.h"
+#include "health_risks_packed.h"
+#include "work_stealing_pool.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <string_view>
+
+namespace mx::health_risks {
+
+namespace {
+
+class MappedFile {
+ public:
+  ~MappedFile() {
+    if (data_ != nullptr) {
+      munmap(const_cast<char*>(data_), size_);
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  bool open(const std::string& path, std::string& error) {
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    struct stat info;
+    if (fd_ < 0 || fstat(fd_, &info) != 0) {
+      error = "cannot open " + path + ": " + std::strerror(errno);
+      return false;
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    if (size_ == 0) {
+      return true;
+    }
+    void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapped == MAP_FAILED) {
+      error = "cannot map " + path + ": " + std::strerror(errno);
+      return false;
+    }
+    data_ = static_cast<const char*>(mapped);
+    madvise(mapped, size_, MADV_SEQUENTIAL);
+    return true;
+  }
+
+  const char* data() const { return data_; }
+  std::size_t size() const { return size_; }
+
+ private:
+  int fd_ = -1;
+  const char* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+class OutputFile {
+ public:
+  ~OutputFile() {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  bool open(const std::string& path, std::size_t size, std::string& error) {
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0 || ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+      error = "cannot create " + path + ": " + std::strerror(errno);
+      return false;
+    }
+    return true;
+  }
+
+  bool writeAt(const void* data, std::size_t size, std::size_t offset) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+      const ssize_t written = pwrite(fd_, bytes, size, static_cast<off_t>(offset));
+      if (written < 0 && errno == EINTR) {
+        continue;
+      }
+      if (written <= 0) {
+        return false;
+      }
+      bytes += written;
+      size -= static_cast<std::size_t>(written);
+      offset += static_cast<std::size_t>(written);
+    }
+    return true;
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+std::size_t peakRssBytes() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+std::string_view trim(std::string_view text) {
+  while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) {
+    text.remove_prefix(1);
+  }
+  while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')) {
+    text.remove_suffix(1);
+  }
+  return text;
+}
+
+// Calls `line` for every non-empty line of [begin, end)
+template <typename Line>
+void forEachLine(const char* begin, const char* end, const Line& line) {
+  while (begin < end) {
+    const char* newline = static_cast<const char*>(std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)));
+    const char* line_end = newline != nullptr ? newline : end;
+    const std::string_view text = trim({begin, static_cast<std::size_t>(line_end - begin)});
+    if (!text.empty()) {
+      line(text);
+    }
+    begin = line_end + 1;
+  }
+}
+
+enum class CsvField {
+  unknown,
+  age,
+  cholesterol,
+  cholesterol_hdl,
+  sbp,
+  is_smoker,
+  hypertension_treatment,
+  has_diabetes,
+  body_height,
+  body_weight,
+  gender,
+  country,
+  race,
+};
+
+CsvField csvField(std::string_view name) {
+  static constexpr std::pair<std::string_view, CsvField> kFields[] = {
+      {"age", CsvField::age},
+      {"cholesterol", CsvField::cholesterol},
+      {"cholesterol_hdl", CsvField::cholesterol_hdl},
+      {"sbp", CsvField::sbp},
+      {"is_smoker", CsvField::is_smoker},
+      {"hypertension_treatment", CsvField::hypertension_treatment},
+      {"has_diabetes", CsvField::has_diabetes},
+      {"body_height", CsvField::body_height},
+      {"body_weight", CsvField::body_weight},
+      {"gender", CsvField::gender},
+      {"country", CsvField::country},
+      {"race", CsvField::race},
+  };
+  for (const auto& [field_name, field] : kFields) {
+    if (field_name == name) {
+      return field;
+    }
+  }
+  return CsvField::unknown;
+}
+
+template <typename Cell>
+void forEachCell(std::string_view line, const Cell& cell) {
+  std::size_t column = 0;
+  while (true) {
+    const std::size_t comma = line.find(',');
+    cell(column++, trim(line.substr(0, comma)));
+    if (comma == std::string_view::npos) {
+      return;
+    }
+    line.remove_prefix(comma + 1);
+  }
+}
+
+bool parseDouble(std::string_view text, double& value) {
+  char buffer[64];
+  if (text.size() >= sizeof(buffer)) {
+    return false;
+  }
+  std::memcpy(buffer, text.data(), text.size());
+  buffer[text.size()] = '\0';
+  char* end = nullptr;
+  value = std::strtod(buffer, &end);
+  return end == buffer + text.size();
+}
+
+bool parseFloat(std::string_view text, std::optional<float>& value) {
+  double number = 0;
+  if (!parseDouble(text, number)) {
+    return false;
+  }
+  value = static_cast<float>(number);
+  return true;
+}
+
+bool parseBool(std::string_view text, std::optional<bool>& value) {
+  if (text == "1" || text == "true" || text == "True" || text == "TRUE") {
+    value = true;
+    return true;
+  }
+  if (text == "0" || text == "false" || text == "False" || text == "FALSE") {
+    value = false;
+    return true;
+  }
+  return false;
+}
+
+template <typename Enum, std::size_t N>
+bool parseEnum(std::string_view text, const std::string_view (&names)[N], std::optional<Enum>& value) {
+  for (std::size_t i = 0; i < N; ++i) {
+    if (text == names[i] || (text.size() == 1 && text[0] == static_cast<char>('0' + i))) {
+      value = static_cast<Enum>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Parses one CSV row into `packed`, returns the number of cells that had to be treated as missing
+std::size_t parseCsvRecord(std::string_view line, const std::vector<CsvField>& layout, PackedRisksFactors& packed) {
+  static constexpr std::string_view kGenders[] = {"male", "female", "other"};
+  static constexpr std::string_view kRaces[] = {"white", "african_american", "other"};
+  // parseEnum only produces indices of these tables, so they must cover the enums exactly
+  static_assert(std::size(kGenders) == static_cast<std::size_t>(Gender::other) + 1);
+  static_assert(std::size(kRaces) == static_cast<std::size_t>(Race::other) + 1);
+
+  RisksFactors factors;
+  std::size_t invalid = 0;
+  forEachCell(line, [&](std::size_t column, std::string_view cell) {
+    if (column >= layout.size() || cell.empty()) {
+      return;
+    }
+    double number = 0;
+    bool ok = true;
+    switch (layout[column]) {
+      case CsvField::unknown:
+        break;
+      case CsvField::age:
+        ok = parseDouble(cell, number) && std::fabs(number) < 1e9 && number == static_cast<int>(number);
+        if (ok) {
+          factors.age = static_cast<int>(number);
+        }
+        break;
+      case CsvField::cholesterol:
+        ok = parseFloat(cell, factors.cholesterol);
+        break;
+      case CsvField::cholesterol_hdl:
+        ok = parseFloat(cell, factors.cholesterol_hdl);
+        break;
+      case CsvField::sbp:
+        ok = parseFloat(cell, factors.sbp);
+        break;
+      case CsvField::body_height:
+        ok = parseFloat(cell, factors.body_height);
+        break;
+      case CsvField::body_weight:
+        ok = parseFloat(cell, factors.body_weight);
+        break;
+      case CsvField::is_smoker:
+        ok = parseBool(cell, factors.is_smoker);
+        break;
+      case CsvField::hypertension_treatment:
+        ok = parseBool(cell, factors.hypertension_treatment);
+        break;
+      case CsvField::has_diabetes:
+        ok = parseBool(cell, factors.has_diabetes);
+        break;
+      case CsvField::gender:
+        ok = parseEnum(cell, kGenders, factors.gender);
+        break;
+      case CsvField::race:
+        ok = parseEnum(cell, kRaces, factors.race);
+        break;
+      case CsvField::country:
+        ok = cell.size() == 2 && cell.find('\0') == std::string_view::npos;
+        if (ok) {
+          factors.country.assign(cell.data(), cell.size());
+        }
+        break;
+    }
+    invalid += ok ? 0 : 1;
+  });
+
+  packed = *packRisksFactors(factors);
+  return invalid;
+}
+
+struct Range {
+  const char* begin;
+  const char* end;
+};
+
+// Splits [begin, end) into pieces of about `chunk_bytes`, each ending right after a line break
+std::vector<Range> splitLines(const char* begin, const char* end, std::size_t chunk_bytes) {
+  std::vector<Range> ranges;
+  chunk_bytes = std::max<std::size_t>(chunk_bytes, 1);
+  while (begin < end) {
+    const char* split = begin + std::min(chunk_bytes, static_cast<std::size_t>(end - begin));
+    const void* newline =
+        split < end ? std::memchr(split, '\n', static_cast<std::size_t>(end - split)) : nullptr;
+    const char* chunk_end = newline != nullptr ? static_cast<const char*>(newline) + 1 : end;
+    ranges.push_back({begin, chunk_end});
+    begin = chunk_end;
+  }
+  return ranges;
+}
+
+class ErrorSink {
+ public:
+  void set(std::string error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (error_.empty()) {
+      error_ = std::move(error);
+    }
+    failed_.store(true, std::memory_order_relaxed);
+  }
+  bool failed() const { return failed_.load(std::memory_order_relaxed); }
+  std::string take() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::move(error_);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::string error_;
+  std::atomic<bool> failed_{false};
+};
+
+bool endsWith(const std::string& text, std::string_view suffix) {
+  return text.size() >= suffix.size() && std::string_view(text).substr(text.size() - suffix.size()) == suffix;
+}
+
+}  // namespace
+
+PopulationScoringResult scorePopulationFile(const std::string& input_path, const std::string& output_path,
+                                            const PopulationScoringOptions& options) {
+  PopulationScoringResult result;
+  PopulationScoringStats& stats = result.stats;
+
+  MappedFile input;
+  if (!input.open(input_path, result.error)) {
+    return result;
+  }
+  PopulationFileFormat format = options.format;
+  if (format == PopulationFileFormat::automatic) {
+    format = endsWith(input_path, ".csv") ? PopulationFileFormat::csv : PopulationFileFormat::binary;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  WorkStealingPool pool(options.num_threads);
+  OutputFile output;
+  ErrorSink errors;
+  // every chunk is scored on a single worker, parallelism comes from the pool
+  const BatchOptions chunk_options{.num_threads = 1};
+
+  if (format == PopulationFileFormat::binary) {
+    if (input.size() % sizeof(PackedRisksFactors) != 0) {
+      result.error = input_path + " is not an array of PackedRisksFactors records";
+      return result;
+    }
+    stats.records = input.size() / sizeof(PackedRisksFactors);
+    if (!output.open(output_path, stats.records * sizeof(PackedHealthRisks), result.error)) {
+      return result;
+    }
+    const auto* records = reinterpret_cast<const PackedRisksFactors*>(input.data());
+    const std::size_t chunk_records = std::max<std::size_t>(options.chunk_records, 1);
+    stats.chunks = (stats.records + chunk_records - 1) / chunk_records;
+
+    pool.parallelFor(stats.chunks, [&](std::size_t chunk) {
+      const std::size_t begin = chunk * chunk_records;
+      const std::size_t count = std::min(chunk_records, stats.records - begin);
+      std::vector<PackedHealthRisks> risks(count);
+      computeHealthRisksBatch(records + begin, risks.data(), count, chunk_options);
+      if (!output.writeAt(risks.data(), count * sizeof(PackedHealthRisks), begin * sizeof(PackedHealthRisks))) {
+        errors.set("cannot write " + output_path + ": " + std::strerror(errno));
+      }
+    });
+  } else {
+    const char* data = input.data();
+    const char* data_end = data + input.size();
+    const char* newline =
+        data != nullptr ? static_cast<const char*>(std::memchr(data, '\n', input.size())) : nullptr;
+    const char* header_end = newline != nullptr ? newline : data_end;
+    const char* records_begin = newline != nullptr ? newline + 1 : data_end;
+
+    const std::string_view header = trim({data, static_cast<std::size_t>(header_end - data)});
+    if (header.empty()) {
+      result.error = input_path + " has no header row";
+      return result;
+    }
+    if (header.find('"') != std::string_view::npos) {
+      result.error = input_path + ": quoted CSV fields are not supported";
+      return result;
+    }
+    std::vector<CsvField> layout;
+    forEachCell(header, [&](std::size_t column, std::string_view name) {
+      layout.push_back(csvField(name));
+      // a misspelled column would otherwise be scored as missing without a trace
+      if (layout.back() == CsvField::unknown && result.error.empty()) {
+        result.error = input_path + ": column " + std::to_string(column + 1) +
+                       (name.empty() ? " has no name" : " '" + std::string(name) + "' is not a risks factor");
+      }
+    });
+    if (!result.error.empty()) {
+      return result;
+    }
+
+    // first pass counts the records of every chunk so the second one knows where its results go
+    const std::vector<Range> ranges = splitLines(records_begin, data_end, options.chunk_bytes);
+    std::vector<std::size_t> first_record(ranges.size() + 1, 0);
+    pool.parallelFor(ranges.size(), [&](std::size_t chunk) {
+      std::size_t lines = 0;
+      forEachLine(ranges[chunk].begin, ranges[chunk].end, [&lines](std::string_view) { ++lines; });
+      first_record[chunk + 1] = lines;
+    });
+    for (std::size_t chunk = 0; chunk < ranges.size(); ++chunk) {
+      first_record[chunk + 1] += first_record[chunk];
+    }
+    stats.records = first_record.back();
+    stats.chunks = ranges.size();
+    if (!output.open(output_path, stats.records * sizeof(PackedHealthRisks), result.error)) {
+      return result;
+    }
+
+    std::atomic<std::size_t> invalid_values{0};
+    pool.parallelFor(ranges.size(), [&](std::size_t chunk) {
+      const std::size_t count = first_record[chunk + 1] - first_record[chunk];
+      std::vector<PackedRisksFactors> factors(count);
+      std::size_t record = 0;
+      std::size_t invalid = 0;
+      forEachLine(ranges[chunk].begin, ranges[chunk].end, [&](std::string_view line) {
+        // a quoted cell may hide a comma, splitting it naively would shift every column after it
+        if (line.find('"') != std::string_view::npos) {
+          errors.set(input_path + ": record " + std::to_string(first_record[chunk] + record + 1) +
+                     ": quoted CSV fields are not supported");
+        }
+        invalid += parseCsvRecord(line, layout, factors[record++]);
+      });
+      invalid_values.fetch_add(invalid, std::memory_order_relaxed);
+
+      std::vector<PackedHealthRisks> risks(count);
+      computeHealthRisksBatch(factors.data(), risks.data(), count, chunk_options);
+      if (!output.writeAt(risks.data(), count * sizeof(PackedHealthRisks),
+                          first_record[chunk] * sizeof(PackedHealthRisks))) {
+        errors.set("cannot write " + output_path + ": " + std::strerror(errno));
+      }
+    });
+    stats.invalid_values = invalid_values.load();
+  }
+
+  if (errors.failed()) {
+    result.error = errors.take();
+    return result;
+  }
+
+  stats.wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  stats.records_per_second = stats.wall_seconds > 0 ? static_cast<double>(stats.records) / stats.wall_seconds : 0;
+  for (double busy : pool.busySeconds()) {
+    stats.thread_utilization.push_back(stats.wall_seconds > 0 ? busy / stats.wall_seconds : 0);
+  }
+  stats.peak_rss_bytes = peakRssBytes();
+  return result;
+}
+
+}  // namespace mx::health_risks
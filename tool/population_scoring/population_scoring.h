@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace mx::health_risks {
+
+enum class PopulationFileFormat {
+  automatic,  // by extension: ".csv" is CSV, anything else binary
+  binary,     // array of PackedRisksFactors
+  csv,        // header row naming the RisksFactors fields, empty cells are missing values
+};
+
+struct PopulationScoringOptions {
+  PopulationFileFormat format = PopulationFileFormat::automatic;
+  // 0 means std::thread::hardware_concurrency()
+  unsigned num_threads = 0;
+  // records per chunk of a binary input
+  std::size_t chunk_records = 16384;
+  // approximate bytes per chunk of a CSV input, chunks always end on a line break
+  std::size_t chunk_bytes = 1 << 20;
+};
+
+struct PopulationScoringStats {
+  std::size_t records = 0;
+  std::size_t chunks = 0;
+  // CSV cells that could not be parsed and were scored as missing
+  std::size_t invalid_values = 0;
+  double wall_seconds = 0;
+  double records_per_second = 0;
+  // fraction of the wall time every worker spent scoring
+  std::vector<double> thread_utilization;
+  std::size_t peak_rss_bytes = 0;
+};
+
+struct PopulationScoringResult {
+  // empty on success
+  std::string error;
+  PopulationScoringStats stats;
+};
+
+// Score every record of a memory-mapped risk factors file.
+// The output file receives one PackedHealthRisks per input record, in input order. Chunks are scored on a
+// work-stealing pool and written at their final offset as soon as they are done, so memory use stays bounded
+// by the chunk size regardless of the input size.
+//
+// CSV columns: age, cholesterol, cholesterol_hdl, sbp, is_smoker, hypertension_treatment, has_diabetes,
+// body_height, body_weight, gender (male/female/other), country, race (white/african_american/other).
+// Unknown or unnamed columns fail the file, booleans are 0/1 or true/false. Quoted fields are not supported and
+// fail the file too.
+PopulationScoringResult scorePopulationFile(const std::string& input_path, const std::string& output_path,
+                                            const PopulationScoringOptions& options = {});
+
+}  // namespace mx::health_risks
@@ -0,0 +1,104 @@
+#include "population_scoring.h"
+
+#include "health_risks_packed.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace mx::health_risks;
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+  if (!condition) {
+    std::fprintf(stderr, "FAILED: %s\n", what);
+    ++failures;
+  }
+}
+
+std::string tempPath(const char* name) {
+  const char* dir = std::getenv("TMPDIR");
+  return std::string(dir != nullptr && dir[0] != '\0' ? dir : "/tmp") + "/population_scoring_test_" + name;
+}
+
+std::string writeCsv(const char* name, const std::string& content) {
+  const std::string path = tempPath(name);
+  std::ofstream(path, std::ios::binary) << content;
+  return path;
+}
+
+std::vector<PackedHealthRisks> readResults(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  const std::string bytes{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  std::vector<PackedHealthRisks> risks(bytes.size() / sizeof(PackedHealthRisks));
+  bytes.copy(reinterpret_cast<char*>(risks.data()), risks.size() * sizeof(PackedHealthRisks));
+  return risks;
+}
+
+bool sameFloat(float a, float b) {
+  return (std::isnan(a) && std::isnan(b)) || a == b;
+}
+
+bool sameRisks(const PackedHealthRisks& a, const PackedHealthRisks& b) {
+  return a.presence == b.presence && sameFloat(a.overall_risk, b.overall_risk) &&
+         sameFloat(a.coronary_heart_disease_risk, b.coronary_heart_disease_risk) &&
+         sameFloat(a.stroke_risk, b.stroke_risk) && a.vascular_age == b.vascular_age &&
+         a.total_score == b.total_score;
+}
+
+PackedHealthRisks expectedRisks(const RisksFactors& factors) {
+  return *packHealthRisks(computeHealthRisks(factors));
+}
+
+// The header's last column is followed by the line break, it must still be scored
+void testLastColumnIsScored() {
+  const std::string output = tempPath("last_column.out");
+  PopulationScoringResult result = scorePopulationFile(
+      writeCsv("last_column.csv", "age,sbp,country\n50,140,PL\n61,120,US\r\n"), output, {.num_threads = 2});
+  check(result.error.empty(), "last column CSV is scored");
+  check(result.stats.records == 2, "last column CSV has two records");
+  check(result.stats.invalid_values == 0, "last column CSV has no invalid values");
+
+  RisksFactors first;
+  first.age = 50;
+  first.sbp = 140.0f;
+  first.country = "PL";
+  RisksFactors second;
+  second.age = 61;
+  second.sbp = 120.0f;
+  second.country = "US";
+  const std::vector<PackedHealthRisks> risks = readResults(output);
+  check(risks.size() == 2, "last column output has two records");
+  check(risks.size() == 2 && sameRisks(risks[0], expectedRisks(first)), "first record uses its country");
+  check(risks.size() == 2 && sameRisks(risks[1], expectedRisks(second)), "CRLF record uses its country");
+}
+
+void testUnknownColumnsFail() {
+  const std::string output = tempPath("unknown_column.out");
+  check(!scorePopulationFile(writeCsv("unknown_column.csv", "age,sbp,contry\n50,140,PL\n"), output).error.empty(),
+        "misspelled column fails the file");
+  check(!scorePopulationFile(writeCsv("empty_column.csv", "age,,sbp\n50,1,140\n"), output).error.empty(),
+        "unnamed column fails the file");
+  check(!scorePopulationFile(writeCsv("trailing_comma.csv", "age,sbp,\n50,140,\n"), output).error.empty(),
+        "trailing comma in the header fails the file");
+  check(!scorePopulationFile(writeCsv("no_header.csv", ""), output).error.empty(), "file without header fails");
+}
+
+}  // namespace
+
+int main() {
+  testLastColumnIsScored();
+  testUnknownColumnsFail();
+  if (failures != 0) {
+    return EXIT_FAILURE;
+  }
+  std::printf("population_scoring_test passed\n");
+  return EXIT_SUCCESS;
+}